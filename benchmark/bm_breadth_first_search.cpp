@@ -0,0 +1,343 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/breadth_first_view.h"
+#include "modern_cpp_template/breadth_first_visit.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/direction_optimizing_bfs.h"
+#include "modern_cpp_template/multi_source_bfs.h"
+#include "modern_cpp_template/parallel_bfs.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Node = Graph::Node;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::breadth_first_view;
+using modern_cpp_template::algorithms::undirected_graph::breadth_first_visit;
+using modern_cpp_template::algorithms::undirected_graph::
+    direction_optimizing_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::
+    multi_source_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::
+    parallel_breadth_first_search;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 10};
+static constexpr int64_t kMaxNodes{1 << 18};
+static constexpr int64_t kRmatEdgeFactor{16};
+static constexpr int64_t kMinScale{10};
+static constexpr int64_t kMaxScale{18};
+static constexpr int64_t kScaleStep{4};
+static constexpr int64_t kParallelScale{18};
+static constexpr int64_t kMaxThreads{16};
+static constexpr int64_t kMultiSourceScale{16};
+static constexpr int64_t kMinSources{8};
+static constexpr int64_t kMaxSources{256};
+static constexpr int64_t kMinPrefix{16};
+static constexpr int64_t kMaxPrefix{1 << 14};
+
+Graph make_uniform_graph(int64_t num_nodes) {
+  return make_graph<Graph>(
+      num_nodes,
+      make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2));
+}
+
+Graph make_rmat_graph(int64_t scale) {
+  return make_graph<Graph>(int64_t{1} << scale,
+                           make_rmat_edges(scale, kRmatEdgeFactor));
+}
+
+void run_undirected_graph_bfs(benchmark::State& state, Graph& graph) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto& [node_index, node] : graph.node_map()) {
+      node.is_visited = false;
+    }
+    state.ResumeTiming();
+    int64_t visited{0};
+    graph.breadth_first_search(0, [&visited](Node const&) {
+      ++visited;
+      return false;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+
+void run_undirected_graph_bfs_context(benchmark::State& state,
+                                      Graph const& graph) {
+  Graph::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    graph.breadth_first_search(0, context, [&visited](Node const&) {
+      ++visited;
+      return false;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+
+void run_csr_graph_bfs(benchmark::State& state, CsrGraph const& csr_graph) {
+  for (auto _ : state) {
+    int64_t visited{0};
+    csr_graph.breadth_first_search(0, [&visited](Node const&) {
+      ++visited;
+      return false;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(csr_graph.number_of_nodes()));
+}
+
+///\brief the same search as run_undirected_graph_bfs_context, with the
+/// counter inlined into the traversal instead of behind a std::function
+template <typename GraphType>
+void run_breadth_first_visit(benchmark::State& state, GraphType const& graph) {
+  typename GraphType::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    breadth_first_visit(graph, 0, context,
+                        [&visited](auto /*vertex*/) { ++visited; });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+
+void run_direction_optimizing_bfs(benchmark::State& state,
+                                  CsrGraph const& csr_graph) {
+  for (auto _ : state) {
+    auto tree = direction_optimizing_breadth_first_search(csr_graph, 0);
+    benchmark::DoNotOptimize(tree);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(csr_graph.number_of_nodes()));
+}
+
+void run_parallel_bfs(benchmark::State& state, CsrGraph const& csr_graph) {
+  WorkerPool pool(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    std::atomic<int64_t> visited{0};
+    parallel_breadth_first_search(csr_graph, 0, pool, [&visited](Node const&) {
+      visited.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(csr_graph.number_of_nodes()));
+}
+
+}  // namespace
+
+static void BM_bfs_undirected_graph(benchmark::State& state) {
+  auto graph = make_uniform_graph(state.range(0));
+  run_undirected_graph_bfs(state, graph);
+}
+// clang-format off
+BENCHMARK(BM_bfs_undirected_graph)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_undirected_graph_context(benchmark::State& state) {
+  run_undirected_graph_bfs_context(state, make_uniform_graph(state.range(0)));
+}
+// clang-format off
+BENCHMARK(BM_bfs_undirected_graph_context)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_csr_graph(benchmark::State& state) {
+  run_csr_graph_bfs(state, freeze(make_uniform_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_csr_graph)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_undirected_graph_visitor(benchmark::State& state) {
+  run_breadth_first_visit(state, make_uniform_graph(state.range(0)));
+}
+// clang-format off
+BENCHMARK(BM_bfs_undirected_graph_visitor)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_csr_graph_visitor(benchmark::State& state) {
+  run_breadth_first_visit(state, freeze(make_uniform_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_csr_graph_visitor)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief a whole search pulled through breadth_first_view
+static void BM_bfs_undirected_graph_view(benchmark::State& state) {
+  auto const graph = make_uniform_graph(state.range(0));
+  Graph::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    for (auto step : breadth_first_view(graph, 0, context)) {
+      visited += static_cast<int64_t>(step.depth != 0);
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+// clang-format off
+BENCHMARK(BM_bfs_undirected_graph_view)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: n; the first n nodes reached from node 0, by a callback
+/// that stops the search once it has seen n of them
+static void BM_bfs_prefix_callback(benchmark::State& state) {
+  auto const graph = make_uniform_graph(kMaxNodes);
+  auto const prefix = state.range(0);
+  Graph::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    graph.breadth_first_search(0, context,
+                               [&visited, prefix](Node const& /*node*/) {
+                                 return ++visited == prefix;
+                               });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * prefix);
+}
+// clang-format off
+BENCHMARK(BM_bfs_prefix_callback)->RangeMultiplier(16)->Range(kMinPrefix, kMaxPrefix);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the same prefix taken from breadth_first_view
+static void BM_bfs_prefix_view(benchmark::State& state) {
+  auto const graph = make_uniform_graph(kMaxNodes);
+  auto const prefix = state.range(0);
+  Graph::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    for (auto step : breadth_first_view(graph, 0, context) |
+                         std::views::take(prefix)) {
+      benchmark::DoNotOptimize(step);
+      ++visited;
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * prefix);
+}
+// clang-format off
+BENCHMARK(BM_bfs_prefix_view)->RangeMultiplier(16)->Range(kMinPrefix, kMaxPrefix);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_direction_optimizing(benchmark::State& state) {
+  run_direction_optimizing_bfs(state,
+                               freeze(make_uniform_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_direction_optimizing)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_undirected_graph_rmat(benchmark::State& state) {
+  auto graph = make_rmat_graph(state.range(0));
+  run_undirected_graph_bfs(state, graph);
+}
+// clang-format off
+BENCHMARK(BM_bfs_undirected_graph_rmat)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_csr_graph_rmat(benchmark::State& state) {
+  run_csr_graph_bfs(state, freeze(make_rmat_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_csr_graph_rmat)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_direction_optimizing_rmat(benchmark::State& state) {
+  run_direction_optimizing_bfs(state, freeze(make_rmat_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_direction_optimizing_rmat)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_parallel(benchmark::State& state) {
+  run_parallel_bfs(state, freeze(make_uniform_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_parallel)->ArgsProduct({{kMaxNodes}, benchmark::CreateRange(1, kMaxThreads, 2)})->Unit(benchmark::kMicrosecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_parallel_rmat(benchmark::State& state) {
+  run_parallel_bfs(state, freeze(make_rmat_graph(state.range(0))));
+}
+// clang-format off
+BENCHMARK(BM_bfs_parallel_rmat)->ArgsProduct({{kParallelScale}, benchmark::CreateRange(1, kMaxThreads, 2)})->Unit(benchmark::kMicrosecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_bfs_many_sources_sequential(benchmark::State& state) {
+  auto csr_graph = freeze(make_rmat_graph(kMultiSourceScale));
+  auto num_sources = static_cast<CsrGraph::LocalIndex>(state.range(0));
+  CsrGraph::VisitationContext context;
+  for (auto _ : state) {
+    for (CsrGraph::LocalIndex source = 0; source < num_sources; ++source) {
+      int64_t visited{0};
+      csr_graph.breadth_first_search(csr_graph.original_id(source), context,
+                                     [&visited](Node const&) {
+                                       ++visited;
+                                       return false;
+                                     });
+      benchmark::DoNotOptimize(visited);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_bfs_many_sources_sequential)->RangeMultiplier(2)->Range(kMinSources, kMaxSources)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+template <std::size_t kBatchWidth>
+static void BM_bfs_many_sources_batched(benchmark::State& state) {
+  auto csr_graph = freeze(make_rmat_graph(kMultiSourceScale));
+  std::vector<CsrGraph::NodeIndex> sources;
+  for (int64_t source = 0; source < state.range(0); ++source) {
+    sources.push_back(
+        csr_graph.original_id(static_cast<CsrGraph::LocalIndex>(source)));
+  }
+  for (auto _ : state) {
+    auto distances = multi_source_breadth_first_search<kBatchWidth>(
+        csr_graph, std::span<CsrGraph::NodeIndex const>(sources));
+    benchmark::DoNotOptimize(distances);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// clang-format off
+BENCHMARK_TEMPLATE(BM_bfs_many_sources_batched, 64)->RangeMultiplier(2)->Range(kMinSources, kMaxSources)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+BENCHMARK_TEMPLATE(BM_bfs_many_sources_batched, 256)->RangeMultiplier(2)->Range(kMinSources, kMaxSources)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_freeze(benchmark::State& state) {
+  auto graph = make_uniform_graph(state.range(0));
+  for (auto _ : state) {
+    auto csr_graph = freeze(graph);
+    benchmark::DoNotOptimize(csr_graph);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_freeze)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/columnar_graph.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using ColumnarGraph =
+    modern_cpp_template::algorithms::undirected_graph::ColumnarGraph<
+        std::string, int64_t>;
+using ArenaGraph =
+    modern_cpp_template::algorithms::undirected_graph::ColumnarGraph<
+        std::string, int64_t,
+        modern_cpp_template::algorithms::undirected_graph::StringArena>;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 10};
+static constexpr int64_t kMaxNodes{1 << 20};
+
+template <typename GraphType>
+GraphType make_columnar_graph(int64_t num_nodes,
+                              std::vector<SyntheticEdge> const& edges) {
+  GraphType graph(static_cast<std::size_t>(num_nodes));
+  for (auto const& edge : edges) {
+    graph.add_edge(edge.head, std::to_string(edge.head), edge.tail,
+                   std::to_string(edge.tail), edge.cost);
+  }
+  return graph;
+}
+
+///\brief BFS over the visited flags stored in the graph, resetting them
+/// between iterations outside of the timed region
+template <typename GraphType, typename ResetVisited>
+void run_bfs(benchmark::State& state, GraphType& graph,
+             ResetVisited const& reset_visited) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    reset_visited(graph);
+    state.ResumeTiming();
+    int64_t visited{0};
+    graph.breadth_first_search(0,
+                               [&visited](typename GraphType::Node const&) {
+                                 ++visited;
+                                 return false;
+                               });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+
+template <typename GraphType>
+void run_columnar_bfs(benchmark::State& state) {
+  auto const num_nodes = state.range(0);
+  auto graph = make_columnar_graph<GraphType>(
+      num_nodes,
+      make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2));
+  run_bfs(state, graph, [](GraphType& graph_to_reset) {
+    graph_to_reset.clear_visited();
+  });
+}
+
+}  // namespace
+
+static void BM_columnar_bfs_undirected_graph(benchmark::State& state) {
+  auto const num_nodes = state.range(0);
+  auto graph = modern_cpp_template::benchmarks::make_graph<Graph>(
+      num_nodes,
+      make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2));
+  run_bfs(state, graph, [](Graph& graph_to_reset) {
+    for (auto& [node_index, node] : graph_to_reset.node_map()) {
+      node.is_visited = false;
+    }
+  });
+}
+// clang-format off
+BENCHMARK(BM_columnar_bfs_undirected_graph)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_columnar_bfs_value_vector(benchmark::State& state) {
+  run_columnar_bfs<ColumnarGraph>(state);
+}
+// clang-format off
+BENCHMARK(BM_columnar_bfs_value_vector)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_columnar_bfs_string_arena(benchmark::State& state) {
+  run_columnar_bfs<ArenaGraph>(state);
+}
+// clang-format off
+BENCHMARK(BM_columnar_bfs_string_arena)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/compressed_csr_graph.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using CompressedCsrGraph =
+    modern_cpp_template::algorithms::undirected_graph::CompressedCsrGraph<
+        std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::compress;
+using modern_cpp_template::benchmarks::make_grid_edges;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 12};
+static constexpr int64_t kMaxNodes{1 << 20};
+
+CsrGraph make_csr_graph(int64_t num_nodes,
+                        std::vector<SyntheticEdge> const& edges) {
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+  }
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+///\brief a uniform random graph when grid is 0, otherwise a square grid,
+/// whose neighbors have nearby ids
+CsrGraph make_graph(benchmark::State const& state) {
+  auto const num_nodes = state.range(0);
+  if (state.range(1) == 0) {
+    return make_csr_graph(
+        num_nodes,
+        make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2));
+  }
+  auto const side =
+      static_cast<int64_t>(std::sqrt(static_cast<double>(num_nodes)));
+  return make_csr_graph(side * side, make_grid_edges(side));
+}
+
+template <typename GraphType>
+void run_bfs(benchmark::State& state, GraphType const& graph) {
+  typename GraphType::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    graph.breadth_first_search(
+        0, context, [&visited](typename GraphType::Node const&) {
+          ++visited;
+          return false;
+        });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+
+}  // namespace
+
+///\brief arguments: number of nodes, grid (1) or uniform random (0) graph
+static void BM_compressed_bfs_csr_graph(benchmark::State& state) {
+  auto const graph = make_graph(state);
+  run_bfs(state, graph);
+  state.counters["target_bytes_per_edge"] =
+      static_cast<double>(sizeof(CsrGraph::LocalIndex));
+}
+// clang-format off
+BENCHMARK(BM_compressed_bfs_csr_graph)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 16), {0, 1}})->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief arguments: number of nodes, grid (1) or uniform random (0) graph
+static void BM_compressed_bfs_compressed_graph(benchmark::State& state) {
+  auto const graph = compress(make_graph(state));
+  run_bfs(state, graph);
+  state.counters["target_bytes_per_edge"] =
+      static_cast<double>(graph.encoded_bytes()) /
+      static_cast<double>(graph.number_of_edges());
+}
+// clang-format off
+BENCHMARK(BM_compressed_bfs_compressed_graph)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 16), {0, 1}})->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief Dijkstra decodes the targets through GraphTraits::for_each_neighbor
+static void BM_compressed_decode_all(benchmark::State& state) {
+  auto const graph = compress(make_graph(state));
+  for (auto _ : state) {
+    uint64_t sum{0};
+    for (CompressedCsrGraph::LocalIndex local = 0;
+         local < graph.number_of_nodes(); ++local) {
+      graph.for_each_neighbor(local, [&sum](auto target, auto /*cost*/) {
+        sum += target;
+      });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_compressed_decode_all)->ArgsProduct({{kMaxNodes}, {0, 1}})->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/concurrent_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using ConcurrentGraph =
+    modern_cpp_template::algorithms::undirected_graph::ConcurrentGraph<
+        std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kNodes{1 << 16};
+static constexpr int64_t kEdges{kNodes * 8};
+static constexpr int64_t kMaxThreads{8};
+///\brief the writer publishes after this many add_edge calls
+static constexpr int64_t kBatchSize{4096};
+
+std::vector<Entry> make_entries() {
+  auto const edges = make_uniform_edges(kNodes, kEdges);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+  }
+  return entries;
+}
+
+///\brief shared by all threads and runs; writers only add edges between
+/// existing nodes, so the node count stays fixed
+ConcurrentGraph& shared_concurrent_graph() {
+  static ConcurrentGraph graph(
+      build_csr_graph(std::span<Entry const>(make_entries()),
+                      std::vector<std::string>(kNodes)));
+  return graph;
+}
+
+struct LockedGraph {
+  std::mutex mutex{};
+  Graph graph{};
+};
+
+LockedGraph& shared_locked_graph() {
+  static LockedGraph locked_graph{
+      {},
+      build_undirected_graph(std::span<Entry const>(make_entries()),
+                             std::vector<std::string>(kNodes))};
+  return locked_graph;
+}
+
+}  // namespace
+
+///\brief threads: thread 0 writes, the others query the two-hop degree of
+/// random nodes from a pinned version; items are queries
+static void BM_concurrent_graph_mixed(benchmark::State& state) {
+  auto& graph = shared_concurrent_graph();
+  std::mt19937_64 generator{kGraphSeed +
+                            static_cast<uint64_t>(state.thread_index())};
+  std::uniform_int_distribution<int64_t> node_distribution{0, kNodes - 1};
+  bool const is_writer = state.thread_index() == 0;
+  std::optional<ConcurrentGraph::Reader> reader;
+  if (!is_writer) {
+    reader.emplace(graph.make_reader());
+  }
+  int64_t writes{0};
+  for (auto _ : state) {
+    if (is_writer) {
+      graph.add_edge(node_distribution(generator), "",
+                     node_distribution(generator), "");
+      if (++writes % kBatchSize == 0) {
+        graph.publish();
+      }
+      continue;
+    }
+    auto const guard = reader->pin();
+    auto const node =
+        static_cast<ConcurrentGraph::LocalIndex>(node_distribution(generator));
+    std::size_t two_hop{0};
+    for (auto neighbor : guard->neighbors(node)) {
+      two_hop += guard->degree(neighbor);
+    }
+    benchmark::DoNotOptimize(two_hop);
+  }
+  if (!is_writer) {
+    state.SetItemsProcessed(state.iterations());
+  }
+  state.counters["writes"] = benchmark::Counter(static_cast<double>(writes),
+                                                benchmark::Counter::kIsRate);
+}
+// clang-format off
+BENCHMARK(BM_concurrent_graph_mixed)->ThreadRange(2, kMaxThreads)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the baseline: the same load on an UndirectedGraph behind one mutex
+static void BM_concurrent_graph_mixed_mutex(benchmark::State& state) {
+  auto& [mutex, graph] = shared_locked_graph();
+  std::mt19937_64 generator{kGraphSeed +
+                            static_cast<uint64_t>(state.thread_index())};
+  std::uniform_int_distribution<int64_t> node_distribution{0, kNodes - 1};
+  bool const is_writer = state.thread_index() == 0;
+  int64_t writes{0};
+  for (auto _ : state) {
+    std::lock_guard lock(mutex);
+    if (is_writer) {
+      graph.add_edge(node_distribution(generator), "",
+                     node_distribution(generator), "");
+      ++writes;
+      continue;
+    }
+    std::size_t two_hop{0};
+    for (auto const& edge : graph.get_edges(node_distribution(generator))) {
+      two_hop += graph.degree(edge.tail_node_index);
+    }
+    benchmark::DoNotOptimize(two_hop);
+  }
+  if (!is_writer) {
+    state.SetItemsProcessed(state.iterations());
+  }
+  state.counters["writes"] = benchmark::Counter(static_cast<double>(writes),
+                                                benchmark::Counter::kIsRate);
+}
+// clang-format off
+BENCHMARK(BM_concurrent_graph_mixed_mutex)->ThreadRange(2, kMaxThreads)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
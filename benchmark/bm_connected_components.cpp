@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/connected_components.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::connected_components;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+
+static constexpr int64_t kScale{20};
+static constexpr int64_t kEdgeFactor{8};
+static constexpr int64_t kMaxThreads{8};
+
+///\brief an R-MAT graph: one giant component plus many tiny ones
+CsrGraph make_graph() {
+  auto const edges = make_rmat_edges(kScale, kEdgeFactor);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  int64_t num_nodes{0};
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+}  // namespace
+
+///\brief the baseline: one BFS from every node not yet labeled
+static void BM_connected_components_bfs(benchmark::State& state) {
+  auto const graph = make_graph();
+  CsrGraph::VisitationContext context;
+  std::vector<CsrGraph::LocalIndex> labels;
+  for (auto _ : state) {
+    labels.assign(graph.number_of_nodes(), CsrGraph::kInvalidLocalIndex);
+    CsrGraph::LocalIndex components{0};
+    for (CsrGraph::LocalIndex local = 0; local < graph.number_of_nodes();
+         ++local) {
+      if (labels[local] != CsrGraph::kInvalidLocalIndex) {
+        continue;
+      }
+      graph.breadth_first_search(
+          graph.original_id(local), context,
+          [&graph, &labels, components](CsrGraph::Node const& node) {
+            labels[graph.find_local(node.id)] = components;
+            return false;
+          });
+      ++components;
+    }
+    benchmark::DoNotOptimize(labels.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_connected_components_bfs)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads
+static void BM_connected_components_afforest(benchmark::State& state) {
+  auto const graph = make_graph();
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto components = connected_components(graph, pool);
+    benchmark::DoNotOptimize(components);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_connected_components_afforest)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
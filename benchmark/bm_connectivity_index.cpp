@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kMinNodes{1 << 12};
+static constexpr int64_t kMaxNodes{1 << 18};
+static constexpr int64_t kQueryNodes{1 << 16};
+static constexpr std::size_t kQueries{1024};
+
+///\brief random edges between num_nodes nodes, 0.75 edges per node: a giant
+/// component plus many small ones
+std::vector<SyntheticEdge> make_edges(int64_t num_nodes) {
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  std::vector<SyntheticEdge> edges;
+  for (int64_t node = 0; node < num_nodes; ++node) {
+    edges.push_back({node, node, 1});
+  }
+  for (int64_t edge = 0; edge < num_nodes * 3 / 4; ++edge) {
+    edges.push_back(
+        {node_distribution(generator), node_distribution(generator), 1});
+  }
+  return edges;
+}
+
+std::vector<std::pair<NodeIndex, NodeIndex>> make_queries(int64_t num_nodes) {
+  std::mt19937_64 generator{kGraphSeed + 1};
+  std::uniform_int_distribution<NodeIndex> node_distribution{0, num_nodes - 1};
+  std::vector<std::pair<NodeIndex, NodeIndex>> queries(kQueries);
+  for (auto& query : queries) {
+    query = {node_distribution(generator), node_distribution(generator)};
+  }
+  return queries;
+}
+
+}  // namespace
+
+///\brief arguments: number of nodes, connectivity index disabled (0) or
+/// maintained by add_edge (1)
+static void BM_connectivity_add_edge(benchmark::State& state) {
+  auto const num_nodes = state.range(0);
+  auto const edges = make_edges(num_nodes);
+  for (auto _ : state) {
+    Graph graph(static_cast<std::size_t>(num_nodes),
+                static_cast<std::size_t>(num_nodes));
+    if (state.range(1) != 0) {
+      graph.enable_connectivity_index();
+    }
+    for (auto const& edge : edges) {
+      graph.add_edge(edge.head, std::string{}, edge.tail, std::string{},
+                     edge.cost);
+    }
+    benchmark::DoNotOptimize(graph);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(edges.size()));
+}
+// clang-format off
+BENCHMARK(BM_connectivity_add_edge)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {0, 1}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief "are A and B connected?" answered by a BFS from A that stops at B
+static void BM_connectivity_query_bfs(benchmark::State& state) {
+  auto const graph = make_graph<Graph>(kQueryNodes, make_edges(kQueryNodes));
+  auto const queries = make_queries(kQueryNodes);
+  Graph::VisitationContext context;
+  for (auto _ : state) {
+    std::size_t connected{0};
+    for (auto const& [first, second] : queries) {
+      graph.breadth_first_search(first, context,
+                                 [&connected, second](Graph::Node const& node) {
+                                   if (node.id == second) {
+                                     ++connected;
+                                     return true;
+                                   }
+                                   return false;
+                                 });
+    }
+    benchmark::DoNotOptimize(connected);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(queries.size()));
+}
+// clang-format off
+BENCHMARK(BM_connectivity_query_bfs)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the same queries answered by the connectivity index
+static void BM_connectivity_query_index(benchmark::State& state) {
+  auto graph = make_graph<Graph>(kQueryNodes, make_edges(kQueryNodes));
+  graph.enable_connectivity_index();
+  auto const queries = make_queries(kQueryNodes);
+  for (auto _ : state) {
+    std::size_t connected{0};
+    for (auto const& [first, second] : queries) {
+      connected += graph.is_connected(first, second) ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(connected);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(queries.size()));
+}
+// clang-format off
+BENCHMARK(BM_connectivity_query_index)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
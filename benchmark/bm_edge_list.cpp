@@ -0,0 +1,183 @@
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/edge_list_parser.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::algorithms::undirected_graph::EdgeListFormat;
+using modern_cpp_template::algorithms::undirected_graph::EdgeListParseOptions;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::parse_edge_list;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 14};
+static constexpr int64_t kMaxNodes{1 << 20};
+static constexpr int64_t kLoadNodes{1 << 20};
+static constexpr int64_t kMaxThreads{16};
+static constexpr int64_t kParseNodes{1 << 18};
+
+std::vector<SyntheticEdge> make_edges(int64_t num_nodes) {
+  return make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2);
+}
+
+std::vector<Entry> to_edge_list(std::vector<SyntheticEdge> const& edges) {
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+  }
+  return entries;
+}
+
+std::vector<std::string> make_values(int64_t num_nodes) {
+  std::vector<std::string> values;
+  values.reserve(static_cast<std::size_t>(num_nodes));
+  for (int64_t node = 0; node < num_nodes; ++node) {
+    values.push_back(std::to_string(node));
+  }
+  return values;
+}
+
+std::string to_text(std::vector<SyntheticEdge> const& edges, char separator) {
+  std::string text;
+  for (auto const& edge : edges) {
+    text += std::to_string(edge.head);
+    text += separator;
+    text += std::to_string(edge.tail);
+    text += separator;
+    text += std::to_string(edge.cost);
+    text += '\n';
+  }
+  return text;
+}
+
+void run_parse(benchmark::State& state, EdgeListFormat format,
+               char separator) {
+  auto const text = to_text(make_edges(kParseNodes), separator);
+  EdgeListParseOptions<int64_t> options;
+  options.format = format;
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  std::istringstream input(text);
+  for (auto _ : state) {
+    input.clear();
+    input.seekg(0);
+    std::size_t edges{0};
+    auto number_of_nodes = parse_edge_list(
+        input, options, pool,
+        [&edges](std::span<Entry const> chunk) { edges += chunk.size(); });
+    benchmark::DoNotOptimize(number_of_nodes);
+    benchmark::DoNotOptimize(edges);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(text.size()));
+}
+
+template <typename Build>
+void run_bulk_load(benchmark::State& state, int64_t num_nodes,
+                   Build const& build) {
+  auto edges = to_edge_list(make_edges(num_nodes));
+  auto values = make_values(num_nodes);
+  WorkerPool pool(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto node_values = values;
+    state.ResumeTiming();
+    auto graph =
+        build(std::span<Entry const>(edges), std::move(node_values), pool);
+    benchmark::DoNotOptimize(graph);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(edges.size()));
+}
+
+}  // namespace
+
+static void BM_load_add_edge(benchmark::State& state) {
+  auto edges = make_edges(state.range(0));
+  for (auto _ : state) {
+    auto graph = make_graph<Graph>(state.range(0), edges);
+    benchmark::DoNotOptimize(graph);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(edges.size()));
+}
+// clang-format off
+BENCHMARK(BM_load_add_edge)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of nodes, number of threads
+static void BM_load_bulk_undirected_graph(benchmark::State& state) {
+  run_bulk_load(state, state.range(0),
+                [](auto edges, auto node_values, WorkerPool& pool) {
+                  return build_undirected_graph(edges, std::move(node_values),
+                                                pool);
+                });
+}
+// clang-format off
+BENCHMARK(BM_load_bulk_undirected_graph)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {1}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+BENCHMARK(BM_load_bulk_undirected_graph)->ArgsProduct({{kLoadNodes}, benchmark::CreateRange(2, kMaxThreads, 2)})->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_load_add_edge_and_freeze(benchmark::State& state) {
+  auto edges = make_edges(state.range(0));
+  for (auto _ : state) {
+    auto csr_graph = freeze(make_graph<Graph>(state.range(0), edges));
+    benchmark::DoNotOptimize(csr_graph);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(edges.size()));
+}
+// clang-format off
+BENCHMARK(BM_load_add_edge_and_freeze)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of nodes, number of threads
+static void BM_load_bulk_csr_graph(benchmark::State& state) {
+  run_bulk_load(state, state.range(0),
+                [](auto edges, auto node_values, WorkerPool& pool) {
+                  return build_csr_graph(edges, std::move(node_values), pool);
+                });
+}
+// clang-format off
+BENCHMARK(BM_load_bulk_csr_graph)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {1}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+BENCHMARK(BM_load_bulk_csr_graph)->ArgsProduct({{kLoadNodes}, benchmark::CreateRange(2, kMaxThreads, 2)})->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of threads
+static void BM_parse_edge_list_whitespace(benchmark::State& state) {
+  run_parse(state, EdgeListFormat::kWhitespace, ' ');
+}
+// clang-format off
+BENCHMARK(BM_parse_edge_list_whitespace)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of threads
+static void BM_parse_edge_list_csv(benchmark::State& state) {
+  run_parse(state, EdgeListFormat::kCsv, ',');
+}
+// clang-format off
+BENCHMARK(BM_parse_edge_list_csv)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
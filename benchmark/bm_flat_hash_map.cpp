@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/flat_hash_map.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using FlatGraph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t, std::allocator<std::byte>,
+        modern_cpp_template::algorithms::FlatHashMap>;
+using modern_cpp_template::algorithms::FlatHashMap;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 10};
+static constexpr int64_t kMaxNodes{1 << 20};
+static constexpr int64_t kLookups{1 << 16};
+
+///\brief Look up random keys of a map holding the keys [0, num_keys)
+template <typename Map>
+void run_lookup(benchmark::State& state) {
+  auto const num_keys = state.range(0);
+  Map map;
+  for (int64_t key = 0; key < num_keys; ++key) {
+    map.emplace(key, key);
+  }
+  std::mt19937_64 generator{7};
+  std::uniform_int_distribution<int64_t> key_distribution{0, num_keys - 1};
+  std::vector<int64_t> keys(static_cast<std::size_t>(kLookups));
+  for (auto& key : keys) {
+    key = key_distribution(generator);
+  }
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (auto key : keys) {
+      if (auto found = map.find(key); found != map.end()) {
+        sum += found->second;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kLookups);
+}
+
+///\brief Insert the keys [0, num_keys) into an empty map
+template <typename Map>
+void run_insert(benchmark::State& state) {
+  auto const num_keys = state.range(0);
+  for (auto _ : state) {
+    Map map;
+    for (int64_t key = 0; key < num_keys; ++key) {
+      map.emplace(key, key);
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * num_keys);
+}
+
+template <typename GraphType>
+void run_bfs(benchmark::State& state) {
+  auto const num_nodes = state.range(0);
+  auto const graph = make_graph<GraphType>(
+      num_nodes,
+      make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2));
+  typename GraphType::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    graph.breadth_first_search(
+        0, context, [&visited](typename GraphType::Node const&) {
+          ++visited;
+          return false;
+        });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+
+}  // namespace
+
+static void BM_map_lookup_unordered_map(benchmark::State& state) {
+  run_lookup<std::unordered_map<int64_t, int64_t>>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_lookup_unordered_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_map_lookup_flat_hash_map(benchmark::State& state) {
+  run_lookup<FlatHashMap<int64_t, int64_t>>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_lookup_flat_hash_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_map_insert_unordered_map(benchmark::State& state) {
+  run_insert<std::unordered_map<int64_t, int64_t>>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_insert_unordered_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_map_insert_flat_hash_map(benchmark::State& state) {
+  run_insert<FlatHashMap<int64_t, int64_t>>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_insert_flat_hash_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_map_bfs_unordered_map(benchmark::State& state) {
+  run_bfs<Graph>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_bfs_unordered_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_map_bfs_flat_hash_map(benchmark::State& state) {
+  run_bfs<FlatGraph>(state);
+}
+// clang-format off
+BENCHMARK(BM_map_bfs_flat_hash_map)->RangeMultiplier(8)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
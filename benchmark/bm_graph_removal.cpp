@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kScale{16};
+static constexpr int64_t kNodes{int64_t{1} << kScale};
+static constexpr int64_t kEdgeFactor{8};
+///\brief churn steps applied before BM_graph_churn_bfs searches the graph
+static constexpr int64_t kWarmupSteps{kNodes * kEdgeFactor};
+
+///\brief graph 0 is uniform, graph 1 is R-MAT with a few high degree hubs
+std::vector<SyntheticEdge> make_edges(int64_t graph_kind) {
+  if (graph_kind == 0) {
+    return make_uniform_edges(kNodes, kNodes * kEdgeFactor);
+  }
+  return make_rmat_edges(kScale, kEdgeFactor);
+}
+
+int64_t count_nodes(std::vector<SyntheticEdge> const& edges) {
+  int64_t num_nodes{0};
+  for (auto const& edge : edges) {
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  return num_nodes;
+}
+
+///\brief A sliding window churn: every step removes a random live edge and
+/// adds a new one between random nodes, keeping the edge count constant
+class Churn {
+ public:
+  explicit Churn(std::vector<SyntheticEdge> edges)
+      : edges_(std::move(edges)),
+        edge_distribution_(0, edges_.size() - 1),
+        node_distribution_(0, count_nodes(edges_) - 1) {}
+
+  template <typename RemoveEdge>
+  void step(Graph& graph, RemoveEdge&& remove_edge) {
+    auto& edge = edges_[edge_distribution_(generator_)];
+    remove_edge(graph, edge.head, edge.tail);
+    edge.head = node_distribution_(generator_);
+    edge.tail = node_distribution_(generator_);
+    graph.add_edge(edge.head, std::string{}, edge.tail, std::string{},
+                   edge.cost);
+  }
+
+ private:
+  std::vector<SyntheticEdge> edges_;
+  std::mt19937_64 generator_{kGraphSeed + 1};
+  std::uniform_int_distribution<std::size_t> edge_distribution_;
+  std::uniform_int_distribution<int64_t> node_distribution_;
+};
+
+void remove_by_tombstone(Graph& graph, NodeIndex head, NodeIndex tail) {
+  graph.remove_edge(head, tail);
+}
+
+///\brief the baseline: erase both entries, shifting the rest of each list
+void remove_by_erase(Graph& graph, NodeIndex head, NodeIndex tail) {
+  auto erase_first = [&graph](NodeIndex node, NodeIndex neighbor) {
+    auto& node_edges = graph.get_edges(node);
+    auto const edge_iterator =
+        std::find_if(node_edges.begin(), node_edges.end(),
+                     [neighbor](auto const& edge) {
+                       return edge.tail_node_index == neighbor;
+                     });
+    if (edge_iterator != node_edges.end()) {
+      node_edges.erase(edge_iterator);
+    }
+  };
+  erase_first(head, tail);
+  erase_first(tail, head);
+}
+
+}  // namespace
+
+///\brief arguments: graph (0 uniform, 1 R-MAT), compaction threshold in
+/// percent (100 turns automatic compaction off); items are churn steps
+static void BM_graph_churn(benchmark::State& state) {
+  auto const edges = make_edges(state.range(0));
+  auto graph = make_graph<Graph>(count_nodes(edges), edges);
+  graph.set_compaction_threshold(static_cast<double>(state.range(1)) / 100.0);
+  Churn churn(edges);
+  for (auto _ : state) {
+    churn.step(graph, remove_by_tombstone);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["removed_edges"] =
+      static_cast<double>(graph.number_of_removed_edges());
+}
+// clang-format off
+BENCHMARK(BM_graph_churn)->ArgsProduct({{0, 1}, {25, 50, 100}});  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the same churn with removal by std::vector::erase
+static void BM_graph_churn_erase(benchmark::State& state) {
+  auto const edges = make_edges(state.range(0));
+  auto graph = make_graph<Graph>(count_nodes(edges), edges);
+  Churn churn(edges);
+  for (auto _ : state) {
+    churn.step(graph, remove_by_erase);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+// clang-format off
+BENCHMARK(BM_graph_churn_erase)->Arg(0)->Arg(1);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief a BFS over a graph after heavy churn: what the removed entries left
+/// behind cost the traversal; arguments as BM_graph_churn, items are nodes
+static void BM_graph_churn_bfs(benchmark::State& state) {
+  auto const edges = make_edges(state.range(0));
+  auto graph = make_graph<Graph>(count_nodes(edges), edges);
+  graph.set_compaction_threshold(static_cast<double>(state.range(1)) / 100.0);
+  Churn churn(edges);
+  for (int64_t step = 0; step < kWarmupSteps; ++step) {
+    churn.step(graph, remove_by_tombstone);
+  }
+  Graph::VisitationContext context;
+  int64_t reached{0};
+  for (auto _ : state) {
+    reached = 0;
+    graph.breadth_first_search(0, context, [&reached](auto const& /*node*/) {
+      ++reached;
+      return false;
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * reached);
+  state.counters["removed_edges"] =
+      static_cast<double>(graph.number_of_removed_edges());
+}
+// clang-format off
+BENCHMARK(BM_graph_churn_bfs)->ArgsProduct({{0, 1}, {25, 50, 100}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
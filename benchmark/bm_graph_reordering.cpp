@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/graph_reordering.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::undirected_graph::bandwidth;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::reorder;
+using modern_cpp_template::algorithms::undirected_graph::ReorderingStrategy;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_grid_edges;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+
+static constexpr int64_t kRmatScale{18};
+static constexpr int64_t kRmatEdgeFactor{8};
+static constexpr int64_t kGridSide{512};
+static constexpr int64_t kUnordered{3};
+
+///\brief Build a CsrGraph whose node ids are a random permutation, the
+/// way ids arrive from an external source
+CsrGraph make_scrambled_graph(std::vector<SyntheticEdge> const& edges) {
+  int64_t num_nodes{0};
+  for (auto const& edge : edges) {
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  std::vector<int64_t> ids(static_cast<std::size_t>(num_nodes));
+  for (std::size_t node = 0; node < ids.size(); ++node) {
+    ids[node] = static_cast<int64_t>(node);
+  }
+  std::shuffle(ids.begin(), ids.end(), std::mt19937_64{kGraphSeed});
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({ids[static_cast<std::size_t>(edge.head)],
+                       ids[static_cast<std::size_t>(edge.tail)], edge.cost});
+  }
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+///\brief a scale-free R-MAT graph when mesh is 0, otherwise a square grid
+CsrGraph make_graph(int64_t mesh) {
+  return make_scrambled_graph(mesh == 0
+                                  ? make_rmat_edges(kRmatScale, kRmatEdgeFactor)
+                                  : make_grid_edges(kGridSide));
+}
+
+}  // namespace
+
+///\brief arguments: R-MAT (0) or grid (1) graph, ReorderingStrategy or 3
+/// for the scrambled ids
+static void BM_reordered_bfs(benchmark::State& state) {
+  auto graph = make_graph(state.range(0));
+  // every strategy starts at the same node: the one with scrambled id 0
+  auto start = graph.original_id(0);
+  if (state.range(1) != kUnordered) {
+    auto reordered =
+        reorder(graph, static_cast<ReorderingStrategy>(state.range(1)));
+    start = reordered.old_to_new[0];
+    graph = std::move(reordered.graph);
+  }
+  CsrGraph::VisitationContext context;
+  for (auto _ : state) {
+    int64_t visited{0};
+    graph.breadth_first_search(start, context,
+                               [&visited](CsrGraph::Node const&) {
+                                 ++visited;
+                                 return false;
+                               });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+  state.counters["bandwidth"] = static_cast<double>(bandwidth(graph));
+}
+// clang-format off
+BENCHMARK(BM_reordered_bfs)->ArgsProduct({{0, 1}, {3, 0, 1, 2}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief arguments: R-MAT (0) or grid (1) graph, ReorderingStrategy
+static void BM_reorder(benchmark::State& state) {
+  auto const graph = make_graph(state.range(0));
+  auto const strategy = static_cast<ReorderingStrategy>(state.range(1));
+  for (auto _ : state) {
+    auto reordered = reorder(graph, strategy);
+    benchmark::DoNotOptimize(reordered);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_reorder)->ArgsProduct({{0, 1}, {0, 1, 2}})->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/k_core.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::algorithms::undirected_graph::core_decomposition;
+using modern_cpp_template::algorithms::undirected_graph::degree_statistics;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+
+static constexpr int64_t kRmatEdgeFactor{16};
+static constexpr int64_t kMinScale{12};
+static constexpr int64_t kMaxScale{20};
+static constexpr int64_t kScaleStep{2};
+static constexpr int64_t kParallelScale{18};
+static constexpr int64_t kMaxThreads{8};
+
+std::vector<Entry> make_rmat_entries(int64_t scale, int64_t& num_nodes) {
+  auto const edges = make_rmat_edges(scale, kRmatEdgeFactor);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  num_nodes = 0;
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  return entries;
+}
+
+CsrGraph make_rmat_graph(int64_t scale) {
+  int64_t num_nodes{0};
+  auto const entries = make_rmat_entries(scale, num_nodes);
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+Graph make_rmat_undirected_graph(int64_t scale) {
+  int64_t num_nodes{0};
+  auto const entries = make_rmat_entries(scale, num_nodes);
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_undirected_graph(std::span<Entry const>(entries),
+                                std::move(values));
+}
+
+}  // namespace
+
+///\brief argument: R-MAT scale; the bucket algorithm
+static void BM_k_core(benchmark::State& state) {
+  auto const graph = make_rmat_graph(state.range(0));
+  for (auto _ : state) {
+    auto decomposition = core_decomposition(graph);
+    benchmark::DoNotOptimize(decomposition);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_k_core)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads; level-synchronous peeling
+static void BM_k_core_parallel(benchmark::State& state) {
+  auto const graph = make_rmat_graph(kParallelScale);
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto decomposition = core_decomposition(graph, pool);
+    benchmark::DoNotOptimize(decomposition);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_k_core_parallel)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief one adjacency lookup per node of an UndirectedGraph
+static void BM_k_core_degree_statistics(benchmark::State& state) {
+  auto const graph = make_rmat_undirected_graph(kParallelScale);
+  for (auto _ : state) {
+    auto statistics = degree_statistics(graph);
+    benchmark::DoNotOptimize(statistics);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+// clang-format off
+BENCHMARK(BM_k_core_degree_statistics)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the row offsets of a CsrGraph
+static void BM_k_core_degree_statistics_csr(benchmark::State& state) {
+  auto const graph = make_rmat_graph(kParallelScale);
+  for (auto _ : state) {
+    auto statistics = degree_statistics(graph);
+    benchmark::DoNotOptimize(statistics);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_nodes()));
+}
+// clang-format off
+BENCHMARK(BM_k_core_degree_statistics_csr)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/mapped_graph.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using MappedGraph =
+    modern_cpp_template::algorithms::undirected_graph::MappedGraph<
+        std::string, int64_t>;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::write_graph_file;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 12};
+static constexpr int64_t kMaxNodes{1 << 20};
+
+std::vector<modern_cpp_template::benchmarks::SyntheticEdge> make_edges(
+    int64_t num_nodes) {
+  return make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2);
+}
+
+std::filesystem::path graph_file_path(int64_t num_nodes) {
+  return std::filesystem::temp_directory_path() /
+         ("bm_mapped_graph_" + std::to_string(num_nodes) + "_" +
+          std::to_string(::getpid()) + ".graph");
+}
+
+std::filesystem::path write_uniform_graph_file(int64_t num_nodes) {
+  auto path = graph_file_path(num_nodes);
+  write_graph_file(make_graph<Graph>(num_nodes, make_edges(num_nodes)), path);
+  return path;
+}
+
+}  // namespace
+
+// startup by replaying the edges through add_edge and freezing the result
+static void BM_startup_rebuild(benchmark::State& state) {
+  auto edges = make_edges(state.range(0));
+  for (auto _ : state) {
+    auto csr_graph = freeze(make_graph<Graph>(state.range(0), edges));
+    benchmark::DoNotOptimize(csr_graph);
+  }
+}
+// clang-format off
+BENCHMARK(BM_startup_rebuild)->RangeMultiplier(16)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// startup by mapping a graph file
+static void BM_startup_mapped(benchmark::State& state) {
+  auto path = write_uniform_graph_file(state.range(0));
+  for (auto _ : state) {
+    MappedGraph mapped_graph(path);
+    benchmark::DoNotOptimize(mapped_graph);
+  }
+  std::filesystem::remove(path);
+}
+// clang-format off
+BENCHMARK(BM_startup_mapped)->RangeMultiplier(16)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_breadth_first_search_csr(benchmark::State& state) {
+  auto csr_graph =
+      freeze(make_graph<Graph>(state.range(0), make_edges(state.range(0))));
+  decltype(csr_graph)::VisitationContext context;
+  for (auto _ : state) {
+    csr_graph.breadth_first_search(0, context);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_breadth_first_search_csr)->RangeMultiplier(16)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_breadth_first_search_mapped(benchmark::State& state) {
+  auto path = write_uniform_graph_file(state.range(0));
+  MappedGraph mapped_graph(path);
+  MappedGraph::VisitationContext context;
+  for (auto _ : state) {
+    mapped_graph.breadth_first_search(0, context);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::filesystem::remove(path);
+}
+// clang-format off
+BENCHMARK(BM_breadth_first_search_mapped)->RangeMultiplier(16)->Range(kMinNodes, kMaxNodes)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
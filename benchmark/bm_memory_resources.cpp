@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/memory_resources.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using PmrGraph =
+    modern_cpp_template::algorithms::undirected_graph::pmr::UndirectedGraph<
+        std::string, int64_t>;
+using modern_cpp_template::algorithms::ArenaResource;
+using modern_cpp_template::algorithms::SizeClassPoolResource;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::algorithms::undirected_graph::EdgeListEntry;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+using modern_cpp_template::benchmarks::SyntheticEdge;
+using Clock = std::chrono::steady_clock;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kMinNodes{1 << 14};
+static constexpr int64_t kMaxNodes{1 << 20};
+
+///\brief bytes currently handed out by malloc, including mmap-ed chunks
+std::size_t heap_in_use() {
+  auto const info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+template <typename GraphType>
+GraphType build_graph(bool bulk, int64_t num_nodes,
+                      std::vector<SyntheticEdge> const& edges,
+                      typename GraphType::Allocator const& allocator) {
+  if (!bulk) {
+    return make_graph<GraphType>(num_nodes, edges, allocator);
+  }
+  std::vector<EdgeListEntry<int64_t>> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+  }
+  std::vector<std::string> values;
+  values.reserve(static_cast<std::size_t>(num_nodes));
+  for (int64_t node = 0; node < num_nodes; ++node) {
+    values.push_back(std::to_string(node));
+  }
+  WorkerPool pool(1);
+  return build_undirected_graph(
+      std::span<EdgeListEntry<int64_t> const>(entries), std::move(values),
+      pool, allocator);
+}
+
+///\brief Build a graph and destroy it, timing the two phases separately.
+/// The graph is built with add_edge, or with build_undirected_graph when
+/// the second argument is 1.  Reports the wall time of both phases together
+/// as the iteration time, build_ms / destroy_ms per phase, and heap_mb, the
+/// heap held by the built graph.
+///\param make_resource creates the memory resource for one iteration, or
+/// returns nullptr for the default allocator
+template <typename MakeResource>
+void run_build_destroy(benchmark::State& state,
+                       MakeResource const& make_resource) {
+  // arguments: number of nodes, bulk build
+  auto const num_nodes = state.range(0);
+  auto edges = make_uniform_edges(num_nodes, num_nodes * kAverageDegree / 2);
+  double build_seconds{0.0};
+  double destroy_seconds{0.0};
+  double heap_bytes{0.0};
+  for (auto _ : state) {
+    auto const heap_before = heap_in_use();
+    auto const build_start = Clock::now();
+    auto resource = make_resource();
+    std::optional<Graph> graph;
+    std::optional<PmrGraph> pmr_graph;
+    auto const bulk = state.range(1) != 0;
+    if (resource == nullptr) {
+      graph.emplace(build_graph<Graph>(bulk, num_nodes, edges, {}));
+    } else {
+      pmr_graph.emplace(
+          build_graph<PmrGraph>(bulk, num_nodes, edges, resource.get()));
+    }
+    auto const build_end = Clock::now();
+    // the heap may also shrink, e.g. when malloc trims freed chunks
+    heap_bytes += std::max(static_cast<double>(heap_in_use()) -
+                               static_cast<double>(heap_before),
+                           0.0);
+    graph.reset();
+    pmr_graph.reset();
+    resource.reset();
+    auto const destroy_end = Clock::now();
+
+    std::chrono::duration<double> build = build_end - build_start;
+    std::chrono::duration<double> destroy = destroy_end - build_end;
+    build_seconds += build.count();
+    destroy_seconds += destroy.count();
+    state.SetIterationTime(build.count() + destroy.count());
+  }
+  auto const iterations = static_cast<double>(state.iterations());
+  state.counters["build_ms"] = build_seconds * 1e3 / iterations;
+  state.counters["destroy_ms"] = destroy_seconds * 1e3 / iterations;
+  state.counters["heap_mb"] = heap_bytes / iterations / (1 << 20);
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(edges.size()));
+}
+
+}  // namespace
+
+static void BM_graph_memory_default_allocator(benchmark::State& state) {
+  run_build_destroy(state, [] {
+    return std::unique_ptr<std::pmr::memory_resource>{};
+  });
+}
+// clang-format off
+BENCHMARK(BM_graph_memory_default_allocator)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {0, 1}})->ArgNames({"nodes", "bulk"})->Unit(benchmark::kMillisecond)->UseManualTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_graph_memory_arena(benchmark::State& state) {
+  run_build_destroy(state, [] {
+    return std::unique_ptr<std::pmr::memory_resource>{
+        std::make_unique<ArenaResource>()};
+  });
+}
+// clang-format off
+BENCHMARK(BM_graph_memory_arena)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {0, 1}})->ArgNames({"nodes", "bulk"})->Unit(benchmark::kMillisecond)->UseManualTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_graph_memory_size_class_pool(benchmark::State& state) {
+  run_build_destroy(state, [] {
+    return std::unique_ptr<std::pmr::memory_resource>{
+        std::make_unique<SizeClassPoolResource>()};
+  });
+}
+// clang-format off
+BENCHMARK(BM_graph_memory_size_class_pool)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {0, 1}})->ArgNames({"nodes", "bulk"})->Unit(benchmark::kMillisecond)->UseManualTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_graph_memory_std_pool(benchmark::State& state) {
+  run_build_destroy(state, [] {
+    return std::unique_ptr<std::pmr::memory_resource>{
+        std::make_unique<std::pmr::unsynchronized_pool_resource>()};
+  });
+}
+// clang-format off
+BENCHMARK(BM_graph_memory_std_pool)->ArgsProduct({benchmark::CreateRange(kMinNodes, kMaxNodes, 8), {0, 1}})->ArgNames({"nodes", "bulk"})->Unit(benchmark::kMillisecond)->UseManualTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
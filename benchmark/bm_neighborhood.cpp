@@ -0,0 +1,173 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/neighborhood.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::k_hop_neighborhood;
+using modern_cpp_template::algorithms::undirected_graph::k_hop_neighborhoods;
+using modern_cpp_template::algorithms::undirected_graph::Neighborhood;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kAverageDegree{8};
+static constexpr int64_t kNumNodes{1 << 18};
+static constexpr int64_t kRmatScale{18};
+static constexpr int64_t kRmatEdgeFactor{16};
+static constexpr int64_t kMinRadius{1};
+static constexpr int64_t kMaxRadius{4};
+static constexpr int64_t kNumSources{1024};
+static constexpr int64_t kBatchRadius{2};
+static constexpr int64_t kMaxThreads{8};
+
+Graph make_uniform_graph() {
+  return make_graph<Graph>(
+      kNumNodes, make_uniform_edges(kNumNodes, kNumNodes * kAverageDegree / 2));
+}
+
+///\brief an R-MAT CsrGraph with every node id of the scale, isolated nodes
+/// included, so that any id is a valid source
+CsrGraph make_rmat_graph() {
+  auto const edges = make_rmat_edges(kRmatScale, kRmatEdgeFactor);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+  }
+  std::vector<std::string> values(std::size_t{1} << kRmatScale);
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+///\brief random query sources, the same for every benchmark
+std::vector<NodeIndex> make_sources(int64_t num_nodes) {
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_int_distribution<NodeIndex> node_distribution{0, num_nodes - 1};
+  std::vector<NodeIndex> sources(static_cast<std::size_t>(kNumSources));
+  for (auto& source : sources) {
+    source = node_distribution(generator);
+  }
+  return sources;
+}
+
+///\brief one k-hop query per iteration, cycling through random sources;
+/// reports the average neighborhood size
+template <typename GraphType>
+void run_k_hop_neighborhood(benchmark::State& state, GraphType const& graph,
+                            int64_t num_nodes) {
+  auto const sources = make_sources(num_nodes);
+  auto const radius = static_cast<std::size_t>(state.range(0));
+  typename GraphType::VisitationContext context;
+  Neighborhood<GraphType> neighborhood;
+  std::size_t next_source{0};
+  int64_t reached{0};
+  for (auto _ : state) {
+    k_hop_neighborhood(graph, sources[next_source], radius, context,
+                       neighborhood);
+    reached += static_cast<int64_t>(neighborhood.size());
+    next_source = (next_source + 1) % sources.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["neighborhood"] = benchmark::Counter(
+      static_cast<double>(reached), benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+///\brief argument: radius; uniform random CsrGraph, 2^18 nodes
+static void BM_k_hop_neighborhood_csr_graph(benchmark::State& state) {
+  auto const graph = freeze(make_uniform_graph());
+  run_k_hop_neighborhood(state, graph, kNumNodes);
+}
+// clang-format off
+BENCHMARK(BM_k_hop_neighborhood_csr_graph)->DenseRange(kMinRadius, kMaxRadius)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: radius; uniform random UndirectedGraph, 2^18 nodes
+static void BM_k_hop_neighborhood_undirected_graph(benchmark::State& state) {
+  auto const graph = make_uniform_graph();
+  run_k_hop_neighborhood(state, graph, kNumNodes);
+}
+// clang-format off
+BENCHMARK(BM_k_hop_neighborhood_undirected_graph)->DenseRange(kMinRadius, kMaxRadius)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: radius; R-MAT CsrGraph, scale 18, where a few hops from
+/// a hub reach most of the graph
+static void BM_k_hop_neighborhood_rmat(benchmark::State& state) {
+  auto const graph = make_rmat_graph();
+  run_k_hop_neighborhood(state, graph, int64_t{1} << kRmatScale);
+}
+// clang-format off
+BENCHMARK(BM_k_hop_neighborhood_rmat)->DenseRange(kMinRadius, kMaxRadius)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the baseline: a full breadth_first_search that collects the
+/// reached nodes, since its callback cannot see depth to stop at a radius
+static void BM_k_hop_full_search(benchmark::State& state) {
+  auto const graph = make_uniform_graph();
+  auto const sources = make_sources(kNumNodes);
+  Graph::VisitationContext context;
+  std::vector<NodeIndex> reached;
+  std::size_t next_source{0};
+  for (auto _ : state) {
+    reached.clear();
+    graph.breadth_first_search(sources[next_source], context,
+                               [&reached](Node const& node) {
+                                 reached.push_back(node.id);
+                                 return false;
+                               });
+    benchmark::DoNotOptimize(reached.data());
+    next_source = (next_source + 1) % sources.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+// clang-format off
+BENCHMARK(BM_k_hop_full_search)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads; a batch of 2-hop queries on a
+/// uniform random CsrGraph, reusing the output buffers
+static void BM_k_hop_neighborhoods_batch(benchmark::State& state) {
+  auto const graph = freeze(make_uniform_graph());
+  auto const sources = make_sources(kNumNodes);
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  std::vector<CsrGraph::VisitationContext> contexts(pool.size());
+  std::vector<Neighborhood<CsrGraph>> neighborhoods;
+  for (auto _ : state) {
+    k_hop_neighborhoods(graph, std::span<NodeIndex const>(sources),
+                        static_cast<std::size_t>(kBatchRadius), pool,
+                        std::span<CsrGraph::VisitationContext>(contexts),
+                        neighborhoods);
+    benchmark::DoNotOptimize(neighborhoods.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSources);
+}
+// clang-format off
+BENCHMARK(BM_k_hop_neighborhoods_batch)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
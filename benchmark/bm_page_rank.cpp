@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/page_rank.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::page_rank;
+using modern_cpp_template::algorithms::undirected_graph::PageRankParameters;
+using modern_cpp_template::algorithms::undirected_graph::
+    sparse_matrix_vector_product;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+
+static constexpr int64_t kRmatEdgeFactor{16};
+static constexpr int64_t kMinScale{12};
+static constexpr int64_t kMaxScale{20};
+static constexpr int64_t kScaleStep{2};
+static constexpr int64_t kParallelScale{18};
+static constexpr int64_t kMaxThreads{16};
+static constexpr std::size_t kIterations{20};
+
+CsrGraph make_rmat_graph(int64_t scale) {
+  auto const edges = make_rmat_edges(scale, kRmatEdgeFactor);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  int64_t num_nodes{0};
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+///\brief a fixed number of iterations, so that every run does the same work
+PageRankParameters fixed_iterations() {
+  PageRankParameters parameters;
+  parameters.tolerance = 0.0;
+  parameters.max_iterations = kIterations;
+  return parameters;
+}
+
+}  // namespace
+
+///\brief argument: R-MAT scale
+template <typename Real>
+static void BM_page_rank(benchmark::State& state) {
+  auto const graph = make_rmat_graph(state.range(0));
+  WorkerPool pool(1);
+  for (auto _ : state) {
+    auto result = page_rank<Real>(graph, pool, fixed_iterations());
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(kIterations) *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK_TEMPLATE(BM_page_rank, double)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+BENCHMARK_TEMPLATE(BM_page_rank, float)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads
+template <typename Real>
+static void BM_page_rank_parallel(benchmark::State& state) {
+  auto const graph = make_rmat_graph(kParallelScale);
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto result = page_rank<Real>(graph, pool, fixed_iterations());
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(kIterations) *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK_TEMPLATE(BM_page_rank_parallel, double)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+BENCHMARK_TEMPLATE(BM_page_rank_parallel, float)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads; one product with the edge costs
+static void BM_sparse_matrix_vector_product(benchmark::State& state) {
+  auto const graph = make_rmat_graph(kParallelScale);
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> input(graph.number_of_nodes(), 1.0);
+  std::vector<double> output(graph.number_of_nodes());
+  for (auto _ : state) {
+    sparse_matrix_vector_product(graph, std::span<double const>(input),
+                                 std::span<double>(output), pool);
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_sparse_matrix_vector_product)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,180 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/delta_stepping.h"
+#include "modern_cpp_template/priority_queues.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using modern_cpp_template::algorithms::BinaryHeap;
+using modern_cpp_template::algorithms::PairingHeap;
+using modern_cpp_template::algorithms::RadixHeap;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::
+    bidirectional_dijkstra_shortest_path;
+using modern_cpp_template::algorithms::undirected_graph::
+    delta_stepping_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::dijkstra_shortest_path;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::kMaxEdgeCost;
+using modern_cpp_template::benchmarks::make_graph;
+using modern_cpp_template::benchmarks::make_grid_edges;
+using modern_cpp_template::benchmarks::make_uniform_edges;
+
+static constexpr int64_t kMinSide{32};
+static constexpr int64_t kMaxSide{512};
+static constexpr int64_t kQueryPairs{64};
+static constexpr int64_t kUniformNodes{1 << 18};
+static constexpr int64_t kUniformAverageDegree{8};
+static constexpr int64_t kMaxThreads{16};
+
+Graph make_grid_graph(int64_t side) {
+  return make_graph<Graph>(side * side, make_grid_edges(side));
+}
+
+CsrGraph make_uniform_csr_graph() {
+  return freeze(make_graph<Graph>(
+      kUniformNodes, make_uniform_edges(kUniformNodes,
+                                        kUniformNodes * kUniformAverageDegree /
+                                            2)));
+}
+
+std::vector<std::pair<int64_t, int64_t>> make_query_pairs(int64_t num_nodes) {
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  std::vector<std::pair<int64_t, int64_t>> pairs;
+  for (int64_t pair = 0; pair < kQueryPairs; ++pair) {
+    pairs.emplace_back(node_distribution(generator),
+                       node_distribution(generator));
+  }
+  return pairs;
+}
+
+template <template <typename, typename> class Queue, typename GraphType>
+void run_single_source(benchmark::State& state, GraphType const& graph,
+                       int64_t num_nodes) {
+  for (auto _ : state) {
+    auto tree = dijkstra_shortest_paths<Queue>(graph, 0);
+    benchmark::DoNotOptimize(tree);
+  }
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+void run_delta_stepping(benchmark::State& state, CsrGraph const& csr_graph) {
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto distances =
+        delta_stepping_shortest_paths(csr_graph, 0, state.range(1), pool);
+    benchmark::DoNotOptimize(distances);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(csr_graph.number_of_nodes()));
+}
+
+}  // namespace
+
+static void BM_dijkstra_undirected_graph(benchmark::State& state) {
+  auto graph = make_grid_graph(state.range(0));
+  run_single_source<BinaryHeap>(state, graph, state.range(0) * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_undirected_graph)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_csr_binary_heap(benchmark::State& state) {
+  auto csr_graph = freeze(make_grid_graph(state.range(0)));
+  run_single_source<BinaryHeap>(state, csr_graph,
+                                state.range(0) * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_csr_binary_heap)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_csr_radix_heap(benchmark::State& state) {
+  auto csr_graph = freeze(make_grid_graph(state.range(0)));
+  run_single_source<RadixHeap>(state, csr_graph,
+                               state.range(0) * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_csr_radix_heap)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_csr_pairing_heap(benchmark::State& state) {
+  auto csr_graph = freeze(make_grid_graph(state.range(0)));
+  run_single_source<PairingHeap>(state, csr_graph,
+                                 state.range(0) * state.range(0));
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_csr_pairing_heap)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMicrosecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_point_to_point(benchmark::State& state) {
+  auto csr_graph = freeze(make_grid_graph(state.range(0)));
+  auto pairs = make_query_pairs(state.range(0) * state.range(0));
+  for (auto _ : state) {
+    for (auto const& [source, target] : pairs) {
+      auto path = dijkstra_shortest_path<RadixHeap>(csr_graph, source, target);
+      benchmark::DoNotOptimize(path);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryPairs);
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_point_to_point)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_bidirectional(benchmark::State& state) {
+  auto csr_graph = freeze(make_grid_graph(state.range(0)));
+  auto pairs = make_query_pairs(state.range(0) * state.range(0));
+  for (auto _ : state) {
+    for (auto const& [source, target] : pairs) {
+      auto path = bidirectional_dijkstra_shortest_path<RadixHeap>(
+          csr_graph, source, target);
+      benchmark::DoNotOptimize(path);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryPairs);
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_bidirectional)->RangeMultiplier(4)->Range(kMinSide, kMaxSide)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+static void BM_dijkstra_uniform(benchmark::State& state) {
+  run_single_source<RadixHeap>(state, make_uniform_csr_graph(), kUniformNodes);
+}
+// clang-format off
+BENCHMARK(BM_dijkstra_uniform)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of threads, delta
+static void BM_delta_stepping_uniform(benchmark::State& state) {
+  run_delta_stepping(state, make_uniform_csr_graph());
+}
+// clang-format off
+BENCHMARK(BM_delta_stepping_uniform)->ArgsProduct({benchmark::CreateRange(1, kMaxThreads, 2), {kMaxEdgeCost / kUniformAverageDegree, kMaxEdgeCost}})->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+// arguments: number of threads, delta
+static void BM_delta_stepping_grid(benchmark::State& state) {
+  run_delta_stepping(state, freeze(make_grid_graph(kMaxSide)));
+}
+// clang-format off
+BENCHMARK(BM_delta_stepping_grid)->ArgsProduct({benchmark::CreateRange(1, kMaxThreads, 2), {kMaxEdgeCost / 4, kMaxEdgeCost}})->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
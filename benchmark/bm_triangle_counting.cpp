@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_generators.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/triangle_counting.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::
+    clustering_coefficients;
+using modern_cpp_template::algorithms::undirected_graph::count_triangles;
+using modern_cpp_template::algorithms::undirected_graph::internal::
+    intersect_sorted;
+using modern_cpp_template::benchmarks::kGraphSeed;
+using modern_cpp_template::benchmarks::make_rmat_edges;
+
+static constexpr int64_t kRmatEdgeFactor{16};
+static constexpr int64_t kMinScale{12};
+static constexpr int64_t kMaxScale{18};
+static constexpr int64_t kScaleStep{2};
+static constexpr int64_t kParallelScale{16};
+static constexpr int64_t kMaxThreads{8};
+static constexpr std::size_t kListSize{1024};
+
+CsrGraph make_rmat_graph(int64_t scale) {
+  auto const edges = make_rmat_edges(scale, kRmatEdgeFactor);
+  std::vector<Entry> entries;
+  entries.reserve(edges.size());
+  int64_t num_nodes{0};
+  for (auto const& edge : edges) {
+    entries.push_back({edge.head, edge.tail, edge.cost});
+    num_nodes = std::max({num_nodes, edge.head + 1, edge.tail + 1});
+  }
+  std::vector<std::string> values(static_cast<std::size_t>(num_nodes));
+  return build_csr_graph(std::span<Entry const>(entries), std::move(values));
+}
+
+///\brief two sorted lists drawn from a range four times their size, so about
+/// a quarter of the values are common
+std::vector<uint32_t> make_sorted_list(uint64_t seed) {
+  std::mt19937 generator{static_cast<uint32_t>(seed)};
+  std::uniform_int_distribution<uint32_t> distribution{
+      0, static_cast<uint32_t>(4 * kListSize)};
+  std::vector<uint32_t> list(kListSize);
+  for (auto& value : list) {
+    value = distribution(generator);
+  }
+  std::sort(list.begin(), list.end());
+  list.erase(std::unique(list.begin(), list.end()), list.end());
+  return list;
+}
+
+}  // namespace
+
+///\brief argument: R-MAT scale
+static void BM_triangle_count(benchmark::State& state) {
+  auto const graph = make_rmat_graph(state.range(0));
+  WorkerPool pool(1);
+  uint64_t triangles{0};
+  for (auto _ : state) {
+    triangles = count_triangles(graph, pool);
+    benchmark::DoNotOptimize(triangles);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+  state.counters["triangles"] = static_cast<double>(triangles);
+}
+// clang-format off
+BENCHMARK(BM_triangle_count)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: number of threads
+static void BM_triangle_count_parallel(benchmark::State& state) {
+  auto const graph = make_rmat_graph(kParallelScale);
+  WorkerPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(count_triangles(graph, pool));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_triangle_count_parallel)->RangeMultiplier(2)->Range(1, kMaxThreads)->Unit(benchmark::kMillisecond)->UseRealTime();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief argument: R-MAT scale
+static void BM_triangle_clustering_coefficients(benchmark::State& state) {
+  auto const graph = make_rmat_graph(state.range(0));
+  WorkerPool pool(1);
+  for (auto _ : state) {
+    auto clustering = clustering_coefficients(graph, pool);
+    benchmark::DoNotOptimize(clustering);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(graph.number_of_edges()));
+}
+// clang-format off
+BENCHMARK(BM_triangle_clustering_coefficients)->DenseRange(kMinScale, kMaxScale, kScaleStep)->Unit(benchmark::kMillisecond);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the block merge kernel used by the triangle counts
+static void BM_triangle_intersect_sorted(benchmark::State& state) {
+  auto const lhs = make_sorted_list(kGraphSeed);
+  auto const rhs = make_sorted_list(kGraphSeed + 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(intersect_sorted(lhs, rhs));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(lhs.size() + rhs.size()));
+}
+// clang-format off
+BENCHMARK(BM_triangle_intersect_sorted);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
+
+///\brief the baseline: a branchy scalar merge counting the common values
+static void BM_triangle_intersect_std(benchmark::State& state) {
+  auto const lhs = make_sorted_list(kGraphSeed);
+  auto const rhs = make_sorted_list(kGraphSeed + 1);
+  std::vector<uint32_t> common;
+  common.reserve(kListSize);
+  for (auto _ : state) {
+    common.clear();
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                          std::back_inserter(common));
+    benchmark::DoNotOptimize(common.size());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(lhs.size() + rhs.size()));
+}
+// clang-format off
+BENCHMARK(BM_triangle_intersect_std);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory,clang-diagnostic-global-constructors)
+// clang-format on
@@ -0,0 +1,153 @@
+///\file graph_generators.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Deterministic synthetic graphs used by the graph benchmarks
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstdint>
+#include <gsl/gsl>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace modern_cpp_template::benchmarks {
+
+///\brief One undirected edge of a synthetic graph
+struct SyntheticEdge {
+  gsl::index head{0};
+  gsl::index tail{0};
+  int64_t cost{0};
+};
+
+///\brief Fixed seed so every benchmark run sees the same graph
+static constexpr uint64_t kGraphSeed{0x5eed'2026ULL};
+
+///\brief Largest edge cost generated by the synthetic graphs
+static constexpr int64_t kMaxEdgeCost{100};
+
+///\brief Generate a uniform random (Erdos-Renyi style) multigraph
+/// Node ids are in [0, num_nodes).  A spanning path 0 - 1 - ... - (n - 1) is
+/// added first so that every node is reachable from node 0.
+///\param num_nodes the number of nodes
+///\param num_edges the number of random edges on top of the spanning path
+///\return std::vector<SyntheticEdge>
+inline std::vector<SyntheticEdge> make_uniform_edges(int64_t num_nodes,
+                                                     int64_t num_edges) {
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, kMaxEdgeCost};
+  std::vector<SyntheticEdge> edges;
+  edges.reserve(static_cast<std::size_t>(num_nodes + num_edges));
+  for (int64_t node = 1; node < num_nodes; ++node) {
+    edges.push_back({node - 1, node, cost_distribution(generator)});
+  }
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    edges.push_back({node_distribution(generator),
+                     node_distribution(generator),
+                     cost_distribution(generator)});
+  }
+  return edges;
+}
+
+///\brief Generate an R-MAT (recursive matrix) power-law multigraph
+/// Uses the Graph500 quadrant probabilities a = 0.57, b = c = 0.19, d = 0.05,
+/// giving a skewed degree distribution and a low diameter.  Nodes that
+/// receive no edge are dropped and the remaining ids are compacted into a
+/// dense range (preserving their order), as UndirectedGraph expects dense ids.
+///\param scale log2 of the number of nodes
+///\param edge_factor the number of edges per node
+///\return std::vector<SyntheticEdge>
+inline std::vector<SyntheticEdge> make_rmat_edges(int64_t scale,
+                                                  int64_t edge_factor) {
+  static constexpr double kA{0.57};
+  static constexpr double kB{0.19};
+  static constexpr double kC{0.19};
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_real_distribution<double> quadrant_distribution{0.0, 1.0};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, kMaxEdgeCost};
+  auto const num_edges = (int64_t{1} << scale) * edge_factor;
+  std::vector<SyntheticEdge> edges;
+  edges.reserve(static_cast<std::size_t>(num_edges));
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    int64_t head{0};
+    int64_t tail{0};
+    for (int64_t bit = 0; bit < scale; ++bit) {
+      auto quadrant = quadrant_distribution(generator);
+      head = (head << 1) | static_cast<int64_t>(quadrant >= kA + kB);
+      tail = (tail << 1) | static_cast<int64_t>(
+                               (quadrant >= kA && quadrant < kA + kB) ||
+                               quadrant >= kA + kB + kC);
+    }
+    edges.push_back({head, tail, cost_distribution(generator)});
+  }
+
+  std::vector<int64_t> dense_ids(static_cast<std::size_t>(int64_t{1} << scale),
+                                 -1);
+  for (auto const& edge : edges) {
+    dense_ids[static_cast<std::size_t>(edge.head)] = 0;
+    dense_ids[static_cast<std::size_t>(edge.tail)] = 0;
+  }
+  int64_t next_id{0};
+  for (auto& dense_id : dense_ids) {
+    if (dense_id == 0) {
+      dense_id = next_id++;
+    }
+  }
+  for (auto& edge : edges) {
+    edge.head = dense_ids[static_cast<std::size_t>(edge.head)];
+    edge.tail = dense_ids[static_cast<std::size_t>(edge.tail)];
+  }
+  return edges;
+}
+
+///\brief Generate a road-like graph: a side x side grid with random costs
+/// Every node is joined to its right and lower neighbor, so the graph is
+/// planar with degree <= 4 and a diameter of about 2 * side - the shape that
+/// makes shortest path searches on road networks expensive.  Node id
+/// row * side + column.
+///\param side the number of nodes along each side of the grid
+///\return std::vector<SyntheticEdge>
+inline std::vector<SyntheticEdge> make_grid_edges(int64_t side) {
+  std::mt19937_64 generator{kGraphSeed};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, kMaxEdgeCost};
+  std::vector<SyntheticEdge> edges;
+  edges.reserve(static_cast<std::size_t>(2 * side * side));
+  for (int64_t row = 0; row < side; ++row) {
+    for (int64_t column = 0; column < side; ++column) {
+      auto node = row * side + column;
+      if (column + 1 < side) {
+        edges.push_back({node, node + 1, cost_distribution(generator)});
+      }
+      if (row + 1 < side) {
+        edges.push_back({node, node + side, cost_distribution(generator)});
+      }
+    }
+  }
+  return edges;
+}
+
+///\brief Build a graph type exposing the UndirectedGraph::add_edge interface
+/// from a list of edges.  Node values are the decimal string of the node id.
+///\tparam Graph an UndirectedGraph with std::string node values
+///\param num_nodes the number of nodes - used to size the graph
+///\param edges the edges to add
+///\param allocator the allocator of the graph containers
+///\return Graph
+template <typename Graph>
+Graph make_graph(int64_t num_nodes, std::vector<SyntheticEdge> const& edges,
+                 typename Graph::Allocator const& allocator = {}) {
+  Graph graph(static_cast<std::size_t>(num_nodes),
+              static_cast<std::size_t>(num_nodes), allocator);
+  for (auto const& edge : edges) {
+    graph.add_edge(edge.head, std::to_string(edge.head), edge.tail,
+                   std::to_string(edge.tail), edge.cost);
+  }
+  return graph;
+}
+
+}  // namespace modern_cpp_template::benchmarks
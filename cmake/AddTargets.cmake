@@ -102,6 +102,7 @@ macro(modern_cpp_template_postprocess_targets)
     target_link_system_libraries(${TARGET_NAME} PRIVATE Microsoft.GSL::GSL)
     target_link_system_libraries(${TARGET_NAME} PRIVATE absl::base)
     target_link_system_libraries(${TARGET_NAME} PRIVATE absl::hash)
+    target_link_libraries(${TARGET_NAME} PRIVATE Threads::Threads)
     target_link_libraries(${TARGET_NAME} PRIVATE modern_cpp_template::modern_cpp_template_options)
     target_link_libraries(${TARGET_NAME} PRIVATE modern_cpp_template::modern_cpp_template_warnings)
   endforeach()
@@ -113,6 +113,10 @@ function(modern_cpp_template_setup_dependencies)
       "GSL_TEST OFF")
   endif()
 
+  # std::thread based parallel algorithms
+  set(THREADS_PREFER_PTHREAD_FLAG ON)
+  find_package(Threads REQUIRED)
+
   if(NOT TARGET abseil::base)
     cpmaddpackage(
       NAME
@@ -0,0 +1,180 @@
+///\file bitmap.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A fixed size dense bitmap used as a frontier / visited set by the
+/// graph algorithms
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+///\brief A dense bitmap over the range [0, size())
+/// Unlike std::vector<bool> the underlying 64-bit words are exposed so that
+/// algorithms can skip empty regions a word at a time.
+class Bitmap {
+ public:
+  using Word = uint64_t;
+  static constexpr std::size_t kBitsPerWord{64};
+
+  ///\brief Construct an empty Bitmap
+  Bitmap() = default;
+
+  ///\brief Construct a Bitmap with all bits cleared
+  ///\param size the number of bits
+  explicit Bitmap(std::size_t size)
+      : size_{size}, words_((size + kBitsPerWord - 1) / kBitsPerWord, 0) {}
+
+  ///\brief return the number of bits in the bitmap
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  ///\brief Readonly accessor for the underlying words
+  [[nodiscard]] std::vector<Word> const& words() const { return words_; }
+
+  ///\brief Change the number of bits, keeping the bits below the new size
+  /// Bits added by growing are cleared.
+  ///\param size the new number of bits
+  void resize(std::size_t size) {
+    words_.resize((size + kBitsPerWord - 1) / kBitsPerWord, 0);
+    if (size < size_ && size % kBitsPerWord != 0) {
+      words_.back() &= bit_mask(size) - 1;
+    }
+    size_ = size;
+  }
+
+  ///\brief Set a bit
+  ///\param position the bit to set
+  void set(std::size_t position) {
+    modern_cpp_template_assert(position < size_);
+    words_[position / kBitsPerWord] |= bit_mask(position);
+  }
+
+  ///\brief Clear a bit
+  ///\param position the bit to clear
+  void reset(std::size_t position) {
+    modern_cpp_template_assert(position < size_);
+    words_[position / kBitsPerWord] &= ~bit_mask(position);
+  }
+
+  ///\brief Test a bit
+  ///\param position the bit to test
+  ///\return true if the bit is set
+  [[nodiscard]] bool test(std::size_t position) const {
+    modern_cpp_template_assert(position < size_);
+    return (words_[position / kBitsPerWord] & bit_mask(position)) != 0;
+  }
+
+  ///\brief Clear every bit
+  void clear() { std::fill(words_.begin(), words_.end(), Word{0}); }
+
+  ///\brief return the number of set bits
+  [[nodiscard]] std::size_t count() const {
+    std::size_t total{0};
+    for (auto word : words_) {
+      total += static_cast<std::size_t>(std::popcount(word));
+    }
+    return total;
+  }
+
+  ///\brief Call a function for every set bit in ascending order
+  ///\tparam Function callable taking a std::size_t bit position
+  ///\param function the function to call
+  template <typename Function>
+  void for_each_set_bit(Function&& function) const {
+    for (std::size_t word_index = 0; word_index < words_.size();
+         ++word_index) {
+      auto word = words_[word_index];
+      while (word != 0) {
+        auto bit = static_cast<std::size_t>(std::countr_zero(word));
+        function(word_index * kBitsPerWord + bit);
+        word &= word - 1;
+      }
+    }
+  }
+
+  ///\brief Swap the contents of two bitmaps
+  friend void swap(Bitmap& lhs, Bitmap& rhs) noexcept {
+    std::swap(lhs.size_, rhs.size_);
+    lhs.words_.swap(rhs.words_);
+  }
+
+ private:
+  [[nodiscard]] static constexpr Word bit_mask(std::size_t position) {
+    return Word{1} << (position % kBitsPerWord);
+  }
+
+  std::size_t size_{0};
+  std::vector<Word> words_{};
+};
+
+///\brief A dense bitmap whose bits can be claimed concurrently
+/// try_set() is the only operation intended to race with other threads; the
+/// remaining members must not run concurrently with writers.
+class AtomicBitmap {
+ public:
+  using Word = uint64_t;
+  static constexpr std::size_t kBitsPerWord{64};
+
+  ///\brief Construct an empty AtomicBitmap
+  AtomicBitmap() = default;
+
+  ///\brief Construct an AtomicBitmap with all bits cleared
+  ///\param size the number of bits
+  explicit AtomicBitmap(std::size_t size)
+      : size_{size}, words_((size + kBitsPerWord - 1) / kBitsPerWord) {
+    clear();
+  }
+
+  ///\brief return the number of bits in the bitmap
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  ///\brief Atomically set a bit
+  ///\param position the bit to set
+  ///\return true if this call changed the bit from 0 to 1, i.e. the caller
+  /// claimed it; false if it was already set
+  bool try_set(std::size_t position) {
+    modern_cpp_template_assert(position < size_);
+    auto& word = words_[position / kBitsPerWord];
+    auto mask = Word{1} << (position % kBitsPerWord);
+    // cheap read first so that already visited bits never cost a
+    // read-modify-write on a shared cache line
+    if ((word.load(std::memory_order_relaxed) & mask) != 0) {
+      return false;
+    }
+    return (word.fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+  }
+
+  ///\brief Test a bit
+  ///\param position the bit to test
+  ///\return true if the bit is set
+  [[nodiscard]] bool test(std::size_t position) const {
+    modern_cpp_template_assert(position < size_);
+    auto mask = Word{1} << (position % kBitsPerWord);
+    return (words_[position / kBitsPerWord].load(std::memory_order_relaxed) &
+            mask) != 0;
+  }
+
+  ///\brief Clear every bit
+  void clear() {
+    for (auto& word : words_) {
+      word.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::size_t size_{0};
+  std::vector<std::atomic<Word>> words_{};
+};
+
+}  // namespace modern_cpp_template::algorithms
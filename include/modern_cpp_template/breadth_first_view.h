@@ -0,0 +1,195 @@
+///\file breadth_first_view.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A lazy, pull-based BFS over an UndirectedGraph as a C++20 view
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief One node reached by a BreadthFirstView and its BFS depth
+///\tparam Node the node type of the graph
+template <typename Node>
+struct BreadthFirstStep {
+  ///\brief the reached node, owned by the graph
+  Node const* node{nullptr};
+  ///\brief the number of edges on a shortest path from the start node
+  std::size_t depth{0};
+};
+
+///\brief A BFS that runs only as far as its consumer reads
+/// Every increment resumes the search where the last one stopped, inside the
+/// adjacency list being scanned, and stops at the next newly discovered node;
+/// the increment itself is deferred until the next node is read, so a
+/// consumer that stops after n nodes - e.g. through std::views::take - never
+/// pays for the search beyond them.  Nodes come out in the order of
+/// UndirectedGraph::breadth_first_search, each with its depth, which is
+/// tracked by counting the nodes of the current and the next level rather
+/// than by storing a depth per node.
+///
+/// The visited state and the queue live in a caller supplied
+/// VisitationContext, so a warmed up context makes the traversal allocation
+/// free.  This is a single pass input view: its iterators share the search
+/// state stored in the view, so begin() may be called only once, the view
+/// must not move after that, and the graph must not change while it is read.
+/// Removed edges are skipped, and the view of a removed start node is empty.
+///\tparam Graph an UndirectedGraph
+template <typename Graph>
+class BreadthFirstView
+    : public std::ranges::view_interface<BreadthFirstView<Graph>> {
+ public:
+  using Node = typename Graph::Node;
+  using NodeIndex = typename Graph::NodeIndex;
+  using EdgeList = typename Graph::EdgeList;
+  using VisitationContext = typename Graph::VisitationContext;
+  using Step = BreadthFirstStep<Node>;
+
+  ///\brief The iterator of a BreadthFirstView, compared with
+  /// std::default_sentinel
+  class Iterator {
+   public:
+    using value_type = Step;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    [[nodiscard]] Step operator*() const {
+      view_->settle();
+      return view_->current_;
+    }
+
+    Iterator& operator++() {
+      view_->is_pending_ = true;
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    [[nodiscard]] friend bool operator==(Iterator const& iterator,
+                                         std::default_sentinel_t /*end*/) {
+      return iterator.is_end();
+    }
+
+   private:
+    friend BreadthFirstView;
+
+    explicit Iterator(BreadthFirstView* view) : view_(view) {}
+
+    [[nodiscard]] bool is_end() const {
+      view_->settle();
+      return view_->is_done_;
+    }
+
+    BreadthFirstView* view_{nullptr};
+  };
+
+  ///\brief Construct a view of the nodes reachable from a start node
+  ///\param graph the graph to search; must outlive the view
+  ///\param start_node_index the Node to start at
+  ///\param context the visitation context; it is reset by begin()
+  BreadthFirstView(Graph const& graph, NodeIndex start_node_index,
+                   VisitationContext& context)
+      : graph_(&graph), context_(&context), start_(start_node_index) {}
+
+  ///\brief Start the search and return an iterator to the start node
+  [[nodiscard]] Iterator begin() {
+    context_->reset(graph_->number_of_nodes());
+    auto const& start_node = graph_->get_node(start_);
+    if (start_node.is_removed) {
+      is_done_ = true;
+      return Iterator(this);
+    }
+    context_->visit(start_);
+    context_->push(start_);
+    current_ = {&start_node, 0};
+    level_remaining_ = 1;
+    return Iterator(this);
+  }
+
+  ///\brief return the sentinel that an exhausted Iterator compares equal to
+  [[nodiscard]] std::default_sentinel_t end() const {
+    return std::default_sentinel;
+  }
+
+ private:
+  ///\brief Run the increment deferred by Iterator::operator++
+  void settle() {
+    if (is_pending_) {
+      is_pending_ = false;
+      advance();
+    }
+  }
+
+  ///\brief Resume the search up to the next newly discovered node
+  void advance() {
+    while (true) {
+      while (edges_ != nullptr && edge_position_ < edges_->size()) {
+        auto const& edge = (*edges_)[edge_position_++];
+        if (!edge.is_removed() && context_->visit(edge.tail_node_index)) {
+          context_->push(edge.tail_node_index);
+          ++next_level_count_;
+          current_ = {&graph_->get_node(edge.tail_node_index), depth_ + 1};
+          return;
+        }
+      }
+      if (context_->empty()) {
+        is_done_ = true;
+        return;
+      }
+      if (level_remaining_ == 0) {
+        ++depth_;
+        level_remaining_ = next_level_count_;
+        next_level_count_ = 0;
+      }
+      --level_remaining_;
+      edges_ = &graph_->get_edges(context_->pop());
+      edge_position_ = 0;
+    }
+  }
+
+  Graph const* graph_{nullptr};
+  VisitationContext* context_{nullptr};
+  NodeIndex start_{0};
+  Step current_{};
+  ///\brief the adjacency list being scanned and the next entry to look at
+  EdgeList const* edges_{nullptr};
+  std::size_t edge_position_{0};
+  ///\brief the depth of the node whose adjacency list is scanned
+  std::size_t depth_{0};
+  ///\brief queued nodes of that depth not yet scanned
+  std::size_t level_remaining_{0};
+  ///\brief nodes discovered one level deeper
+  std::size_t next_level_count_{0};
+  bool is_pending_{false};
+  bool is_done_{false};
+};
+
+///\brief Return a lazy BFS view over the nodes reachable from a start node
+///\see BreadthFirstView
+///\param graph the graph to search; must outlive the view
+///\param start_node_index the Node to start at
+///\param context the visitation context; it is reset when the view begins
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+[[nodiscard]] BreadthFirstView<UndirectedGraph<NodeValue, CostType, Allocator,
+                                               Map>>
+breadth_first_view(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph,
+    typename UndirectedGraph<NodeValue, CostType, Allocator,
+                             Map>::NodeIndex start_node_index,
+    typename UndirectedGraph<NodeValue, CostType, Allocator,
+                             Map>::VisitationContext& context) {
+  return {graph, start_node_index, context};
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
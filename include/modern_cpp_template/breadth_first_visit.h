@@ -0,0 +1,177 @@
+///\file breadth_first_visit.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A BFS templated on its visitor, for any graph with GraphTraits
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief A visitor with every hook of breadth_first_visit() doing nothing
+/// Derive from it and hide the hooks you need; the empty ones inline away.
+/// Every hook may also be left out of a visitor altogether.
+///\tparam Graph the searched graph type
+template <typename Graph>
+struct BreadthFirstVisitor {
+  using Vertex = typename GraphTraits<Graph>::Vertex;
+  using CostType = typename GraphTraits<Graph>::CostType;
+
+  ///\brief Called once for every vertex, in BFS order, when it is first
+  /// reached; may return bool, where true stops the search
+  void discover_vertex(Vertex /*vertex*/) {}
+
+  ///\brief Called for every edge of a vertex taken off the queue, before its
+  /// target is discovered, whether or not the target was already visited
+  void examine_edge(Vertex /*source*/, Vertex /*target*/, CostType /*cost*/) {}
+
+  ///\brief Called once all edges of a vertex have been examined
+  void finish_vertex(Vertex /*vertex*/) {}
+};
+
+namespace internal {
+
+///\internal true if the discover hook of a visitor returns a value, i.e. if
+/// the visitor can stop the search
+template <typename Visitor, typename Vertex>
+[[nodiscard]] consteval bool can_stop_search() {
+  if constexpr (requires(Visitor& visitor, Vertex vertex) {
+                  visitor.discover_vertex(vertex);
+                }) {
+    return !std::is_void_v<decltype(std::declval<Visitor&>().discover_vertex(
+        std::declval<Vertex>()))>;
+  } else if constexpr (std::invocable<Visitor&, Vertex>) {
+    return !std::is_void_v<std::invoke_result_t<Visitor&, Vertex>>;
+  } else {
+    return false;
+  }
+}
+
+///\internal Call the discover hook of a visitor, or the visitor itself when
+/// it is a plain callable
+///\return true if the visitor asks to stop the search
+template <typename Visitor, typename Vertex>
+[[nodiscard]] bool discover_vertex(Visitor& visitor, Vertex vertex) {
+  constexpr bool kCanStop = can_stop_search<Visitor, Vertex>();
+  if constexpr (requires { visitor.discover_vertex(vertex); }) {
+    if constexpr (kCanStop) {
+      return static_cast<bool>(visitor.discover_vertex(vertex));
+    } else {
+      visitor.discover_vertex(vertex);
+    }
+  } else if constexpr (std::invocable<Visitor&, Vertex>) {
+    if constexpr (kCanStop) {
+      return static_cast<bool>(visitor(vertex));
+    } else {
+      visitor(vertex);
+    }
+  }
+  return false;
+}
+
+}  // namespace internal
+
+///\brief Perform a BFS (breadth first search) that calls a visitor's hooks
+/// The same traversal as breadth_first_search() on the graph types, but the
+/// visitor is a template parameter instead of a std::function, so every hook
+/// call is a direct call the compiler can inline, and a missing hook costs
+/// nothing.  Hooks receive GraphTraits<Graph>::Vertex values - the node id
+/// for an UndirectedGraph, the local index for a CsrGraph - so discovering a
+/// node does not look it up; GraphTraits<Graph>::node_index maps a vertex
+/// back to its id.
+///
+/// The visitor is either a callable taking a Vertex, used as the discover
+/// hook, or an object with any of the member hooks of BreadthFirstVisitor.
+/// A discover hook returning true terminates the search early.  A search
+/// from a removed node visits nothing, like breadth_first_search().
+///\tparam Graph any graph type with a GraphTraits specialization
+///\tparam Visitor the visitor type
+///\param graph the graph to search
+///\param start_node_index the id of the Node to start at
+///\param context the visitation context; it is reset by this call
+///\param visitor the visitor, taken by reference so it keeps its state
+template <typename Graph, typename Visitor>
+void breadth_first_visit(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex start_node_index,
+    VisitationContext<typename GraphTraits<Graph>::Vertex>& context,
+    Visitor&& visitor) {
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+  using VisitorType = std::remove_reference_t<Visitor>;
+  constexpr bool kCanStop = internal::can_stop_search<VisitorType, Vertex>();
+  constexpr bool kExaminesEdges =
+      requires(VisitorType& hooks, Vertex vertex, CostType cost) {
+        hooks.examine_edge(vertex, vertex, cost);
+      };
+  constexpr bool kFinishesVertices = requires(VisitorType& hooks,
+                                              Vertex vertex) {
+    hooks.finish_vertex(vertex);
+  };
+
+  auto const start = Traits::vertex(graph, start_node_index);
+  context.reset(Traits::number_of_nodes(graph));
+  if (is_removed_vertex(graph, start)) {
+    return;
+  }
+  context.visit(start);
+  if (internal::discover_vertex(visitor, start)) {
+    return;
+  }
+  context.push(start);
+  [[maybe_unused]] bool is_stopped{false};
+  while (!context.empty()) {
+    auto const source = context.pop();
+    Traits::for_each_neighbor(graph, source, [&](Vertex target, CostType cost) {
+      if constexpr (kCanStop) {
+        // for_each_neighbor cannot break out of its loop
+        if (is_stopped) {
+          return;
+        }
+      }
+      if constexpr (kExaminesEdges) {
+        visitor.examine_edge(source, target, cost);
+      }
+      if (context.visit(target)) {
+        if constexpr (kCanStop) {
+          is_stopped = internal::discover_vertex(visitor, target);
+        } else {
+          static_cast<void>(internal::discover_vertex(visitor, target));
+        }
+        context.push(target);
+      }
+    });
+    if constexpr (kCanStop) {
+      if (is_stopped) {
+        return;
+      }
+    }
+    if constexpr (kFinishesVertices) {
+      visitor.finish_vertex(source);
+    }
+  }
+}
+
+///\brief Perform a BFS that calls a visitor's hooks, with a context local to
+/// the call
+///\see breadth_first_visit(graph, start_node_index, context, visitor)
+template <typename Graph, typename Visitor>
+void breadth_first_visit(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex start_node_index,
+    Visitor&& visitor) {
+  VisitationContext<typename GraphTraits<Graph>::Vertex> context;
+  breadth_first_visit(graph, start_node_index, context,
+                      std::forward<Visitor>(visitor));
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
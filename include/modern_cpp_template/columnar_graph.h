@@ -0,0 +1,358 @@
+///\file columnar_graph.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief An UndirectedGraph that stores its nodes as a structure of arrays
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <gsl/gsl>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/bitmap.h"
+#include "modern_cpp_template/flat_hash_map.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief A column of strings packed into one character buffer
+/// Every string is appended to a single buffer and addressed by an offset, so
+/// a column of n values costs two allocations instead of up to n (one per
+/// std::string longer than the small string buffer) plus a 32 byte
+/// std::string header per value.  Values are read back as std::string_view
+/// and cannot be modified once appended.  Use it as the ValueColumn_T of a
+/// ColumnarGraph with std::string node values.
+class StringArena {
+ public:
+  using value_type = std::string_view;
+
+  ///\brief return the number of strings
+  [[nodiscard]] std::size_t size() const { return offsets_.size() - 1; }
+
+  ///\brief return the number of characters of all strings
+  [[nodiscard]] std::size_t bytes() const { return characters_.size(); }
+
+  ///\brief Make room for count more strings
+  ///\param count the number of strings
+  void reserve(std::size_t count) { offsets_.reserve(count + 1); }
+
+  ///\brief Append a string
+  ///\param value the string
+  void push_back(std::string_view value) {
+    characters_.insert(characters_.end(), value.begin(), value.end());
+    offsets_.push_back(characters_.size());
+  }
+
+  ///\brief return the string at a position
+  ///\param position the position, in [0, size())
+  [[nodiscard]] std::string_view operator[](std::size_t position) const {
+    modern_cpp_template_assert(position < size());
+    return {characters_.data() + offsets_[position],
+            offsets_[position + 1] - offsets_[position]};
+  }
+
+ private:
+  std::vector<char> characters_{};
+  std::vector<std::size_t> offsets_{0};
+};
+
+///\brief An undirected graph stored as a structure of arrays
+/// The interface follows UndirectedGraph, but nothing is stored per node as
+/// a Node object.  Each node gets a dense local index on insertion and its
+/// fields live in separate arrays indexed by it:
+/// - the adjacency lists, which hold local indices and costs
+/// - the visited bits, 64 nodes per word
+/// - the original node ids
+/// - the node values, in a ValueColumn_T
+/// The only hash lookup of a traversal is the one mapping the start id to
+/// its local index.  After that it reads just the adjacency lists and the
+/// visited bits, touching the ids and values only to report a discovered
+/// node to the callback.  UndirectedGraph reads a whole Node, value
+/// included, through a hash lookup for every edge it follows.
+///
+/// Local indices are assigned in insertion order and each adjacency list
+/// keeps its insertion order, so a breadth_first_search visits the nodes in
+/// the same order as an UndirectedGraph built by the same add_edge calls.
+/// Unlike UndirectedGraph, node ids need not be dense.
+///\tparam NodeValue_T The value stored in a Node
+///\tparam CostType_T The type of the cost of an Edge
+///\tparam ValueColumn_T The container of the node values, indexed by local
+/// index: std::vector<NodeValue_T>, or StringArena for std::string values
+template <typename NodeValue_T, typename CostType_T,
+          typename ValueColumn_T = std::vector<NodeValue_T>>
+class ColumnarGraph {
+ public:
+  using NodeValue = NodeValue_T;
+  using CostType = CostType_T;
+  using ValueColumn = ValueColumn_T;
+  using NodeIndex = gsl::index;
+  using LocalIndex = std::uint32_t;
+  using ValueView = decltype(std::declval<ValueColumn const&>()[0]);
+  using VisitationContext =
+      modern_cpp_template::algorithms::VisitationContext<LocalIndex>;
+
+  ///\brief A node reported to a traversal callback, assembled from the
+  /// columns on demand
+  struct Node {
+    NodeIndex id{0};
+    ValueView value;
+  };
+
+  ///\brief One entry of an adjacency list
+  struct LocalEdge {
+    LocalIndex target{0};
+    CostType cost{0};
+  };
+
+  ///\brief Sentinel returned by find_local() for an unknown node id
+  static constexpr LocalIndex kInvalidLocalIndex{
+      std::numeric_limits<LocalIndex>::max()};
+
+  ///\brief Construct an empty ColumnarGraph
+  ColumnarGraph() = default;
+
+  ///\brief Construct an empty ColumnarGraph with room for num_nodes nodes
+  ///\param num_nodes the initial number of nodes
+  explicit ColumnarGraph(std::size_t num_nodes) {
+    local_indices_.reserve(num_nodes);
+    ids_.reserve(num_nodes);
+    values_.reserve(num_nodes);
+    adjacency_.reserve(num_nodes);
+  }
+
+  ///\brief return the number of nodes in the graph
+  [[nodiscard]] std::size_t number_of_nodes() const { return ids_.size(); }
+
+  ///\brief return the number of stored (directed) edges
+  /// Every undirected edge is stored once in each direction
+  [[nodiscard]] std::size_t number_of_edges() const {
+    return number_of_edges_;
+  }
+
+  ///\brief Readonly accessor for the original node ids, indexed by local
+  /// index
+  [[nodiscard]] std::span<NodeIndex const> ids() const { return ids_; }
+
+  ///\brief Readonly accessor for the node values, indexed by local index
+  [[nodiscard]] ValueColumn const& values() const { return values_; }
+
+  ///\brief Readonly accessor for the visited bits, indexed by local index
+  [[nodiscard]] Bitmap const& visited() const { return visited_; }
+
+  ///\brief Find the local index of an original node id
+  ///\param node_index the original id of the Node
+  ///\return LocalIndex the local index or kInvalidLocalIndex if not found
+  [[nodiscard]] LocalIndex find_local(NodeIndex node_index) const {
+    auto local_iterator = local_indices_.find(node_index);
+    [[likely]] if (local_iterator != local_indices_.end()) {
+      return local_iterator->second;
+    }
+    return kInvalidLocalIndex;
+  }
+
+  ///\brief Return the original node id of a local index
+  ///\param local_index the local index of the Node
+  ///\return NodeIndex
+  [[nodiscard]] NodeIndex original_id(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < ids_.size());
+    return ids_[local_index];
+  }
+
+  ///\brief Return the Node at a local index
+  ///\param local_index the local index of the Node
+  ///\return Node
+  [[nodiscard]] Node node(LocalIndex local_index) const {
+    return Node{original_id(local_index), values_[local_index]};
+  }
+
+  ///\brief return the number of edges incident to a node
+  ///\param local_index the local index of the Node
+  [[nodiscard]] std::size_t degree(LocalIndex local_index) const {
+    return edges(local_index).size();
+  }
+
+  ///\brief Return the adjacency list of a node
+  ///\param local_index the local index of the Node
+  ///\return std::span<LocalEdge const>
+  [[nodiscard]] std::span<LocalEdge const> edges(
+      LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < adjacency_.size());
+    return adjacency_[local_index];
+  }
+
+  ///\brief return true if a search has visited a node since the last
+  /// clear_visited()
+  ///\param local_index the local index of the Node
+  [[nodiscard]] bool is_visited(LocalIndex local_index) const {
+    return visited_.test(local_index);
+  }
+
+  ///\brief Mark every node as not visited
+  void clear_visited() { visited_.clear(); }
+
+  ///\brief Add a node unless a node with the same id exists
+  ///\param node_index the id of the Node
+  ///\param node_value the value of the Node - ignored if the node exists
+  ///\return LocalIndex the local index of the Node
+  LocalIndex add_node(NodeIndex node_index, NodeValue const& node_value) {
+    auto next_local = static_cast<LocalIndex>(ids_.size());
+    auto [local_iterator, inserted] =
+        local_indices_.try_emplace(node_index, next_local);
+    if (inserted) {
+      modern_cpp_template_assert_message(
+          next_local != kInvalidLocalIndex,
+          "too many nodes for a 32-bit local index");
+      ids_.push_back(node_index);
+      values_.push_back(node_value);
+      adjacency_.emplace_back();
+      visited_.resize(ids_.size());
+    }
+    return local_iterator->second;
+  }
+
+  ///\brief Add an edge to the Graph
+  /// Same contract as UndirectedGraph::add_edge: adds the edge in both
+  /// directions and adds either node that does not exist yet.
+  ///\param head_node_index Index of the head Node
+  ///\param head_node_value Value of the head Node
+  ///\param tail_node_index Index of the tail Node
+  ///\param tail_node_value Value of the tail Node
+  ///\param edge_cost Cost of the edge
+  void add_edge(NodeIndex head_node_index, NodeValue const& head_node_value,
+                NodeIndex tail_node_index, NodeValue const& tail_node_value,
+                CostType edge_cost = 0) {
+    auto head_local = add_node(head_node_index, head_node_value);
+    auto tail_local = add_node(tail_node_index, tail_node_value);
+    adjacency_[head_local].push_back(LocalEdge{tail_local, edge_cost});
+    adjacency_[tail_local].push_back(LocalEdge{head_local, edge_cost});
+    number_of_edges_ += 2;
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// Same contract as UndirectedGraph::breadth_first_search: nodes are
+  /// marked visited - here in visited() - and stay marked until
+  /// clear_visited(), and the search terminates early when the callback
+  /// returns true.
+  ///\param start_node_index the original id of the Node to start at
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index,
+      std::function<bool(Node const&)> callback = nullptr) {
+    auto start_local = find_local(start_node_index);
+    modern_cpp_template_assert_message(start_local != kInvalidLocalIndex,
+                                       "start node is not in the graph");
+    std::vector<LocalIndex> node_queue{start_local};
+    visited_.set(start_local);
+    if (callback != nullptr) {
+      callback(node(start_local));
+    }
+    for (std::size_t queue_head = 0; queue_head < node_queue.size();
+         ++queue_head) {
+      for (auto const& edge : adjacency_[node_queue[queue_head]]) {
+        if (visited_.test(edge.target)) {
+          continue;
+        }
+        visited_.set(edge.target);
+        if (callback != nullptr) {
+          if (callback(node(edge.target))) {
+            return;
+          }
+        }
+        node_queue.push_back(edge.target);
+      }
+    }
+  }
+
+  ///\brief Perform a re-entrant BFS (breadth first search) on the graph
+  /// Same contract as the overload above, except that the visited state is
+  /// kept in the caller supplied context, so the graph is not modified.
+  ///\param start_node_index the original id of the Node to start at
+  ///\param context the visitation context; it is reset by this call
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index, VisitationContext& context,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    auto start_local = find_local(start_node_index);
+    modern_cpp_template_assert_message(start_local != kInvalidLocalIndex,
+                                       "start node is not in the graph");
+    context.reset(ids_.size());
+    context.visit(start_local);
+    if (callback != nullptr) {
+      callback(node(start_local));
+    }
+    context.push(start_local);
+    while (!context.empty()) {
+      for (auto const& edge : adjacency_[context.pop()]) {
+        if (context.visit(edge.target)) {
+          if (callback != nullptr) {
+            if (callback(node(edge.target))) {
+              return;
+            }
+          }
+          context.push(edge.target);
+        }
+      }
+    }
+  }
+
+ private:
+  FlatHashMap<NodeIndex, LocalIndex> local_indices_{};
+  std::vector<std::vector<LocalEdge>> adjacency_{};
+  Bitmap visited_{};
+  std::vector<NodeIndex> ids_{};
+  ValueColumn values_{};
+  std::size_t number_of_edges_{0};
+};
+
+///\brief GraphTraits for ColumnarGraph - vertices are local indices
+template <typename NodeValue, typename CostType_T, typename ValueColumn>
+struct GraphTraits<ColumnarGraph<NodeValue, CostType_T, ValueColumn>> {
+  using Graph = ColumnarGraph<NodeValue, CostType_T, ValueColumn>;
+  using NodeIndex = typename Graph::NodeIndex;
+  using Vertex = typename Graph::LocalIndex;
+  using CostType = CostType_T;
+  static constexpr Vertex kInvalidVertex{Graph::kInvalidLocalIndex};
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    auto local_index = graph.find_local(node_index);
+    modern_cpp_template_assert_message(local_index != kInvalidVertex,
+                                       "node is not in the graph");
+    return local_index;
+  }
+
+  [[nodiscard]] static NodeIndex node_index(Graph const& graph,
+                                            Vertex vertex) {
+    return graph.original_id(vertex);
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    for (auto const& edge : graph.edges(vertex)) {
+      function(edge.target, edge.cost);
+    }
+  }
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,473 @@
+///\file compressed_csr_graph.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A CsrGraph whose neighbor lists are delta and Stream VByte encoded
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#if defined(__SSSE3__)
+#  include <tmmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+namespace internal {
+
+///\internal The Stream VByte decoding tables, indexed by control byte: the
+/// shuffle that expands the data bytes of four values into 32-bit lanes, and
+/// the number of data bytes
+struct StreamVByteTables {
+  std::array<std::array<std::uint8_t, 16>, 256> shuffles{};
+  std::array<std::uint8_t, 256> lengths{};
+};
+
+[[nodiscard]] constexpr StreamVByteTables make_stream_vbyte_tables() {
+  StreamVByteTables tables;
+  for (std::size_t code = 0; code < 256; ++code) {
+    std::size_t source{0};
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      auto const length = ((code >> (2 * lane)) & 3U) + 1;
+      for (std::size_t byte = 0; byte < 4; ++byte) {
+        // 0x80 makes the shuffle write a zero byte
+        tables.shuffles[code][lane * 4 + byte] =
+            byte < length ? static_cast<std::uint8_t>(source + byte)
+                          : std::uint8_t{0x80};
+      }
+      source += length;
+    }
+    tables.lengths[code] = static_cast<std::uint8_t>(source);
+  }
+  return tables;
+}
+
+///\internal Stream VByte coding of sorted 32-bit integers
+/// A list of n values is stored as n gaps: the first value relative to a
+/// base - zigzag coded, so that values just below the base stay small too -
+/// and every other value relative to its predecessor.  The gaps are written
+/// as a control stream of ceil(n / 4) bytes followed by a data stream.  Each
+/// control byte holds the byte length minus one of four gaps, 2 bits each,
+/// and each gap is stored in its length of little endian bytes.  Keeping the
+/// lengths apart from the data is what makes the format SIMD friendly: one
+/// control byte selects a shuffle that expands the next 4 to 16 data bytes
+/// into four 32-bit lanes in a single instruction (Lemire, Kurz and Rupp,
+/// "Stream VByte: Faster Byte-Oriented Integer Compression", 2018).
+class StreamVByte {
+ public:
+  ///\internal readable bytes the decoder needs past the end of a list
+  static constexpr std::size_t kPadding{16};
+
+  ///\internal Append the encoding of a sorted list to out
+  ///\param values the list, in ascending order
+  ///\param base the value the first value is coded relative to
+  ///\param out receives the encoding
+  static void encode(std::span<std::uint32_t const> values, std::uint32_t base,
+                     std::vector<std::uint8_t>& out) {
+    auto const control_position = out.size();
+    out.resize(out.size() + (values.size() + 3) / 4, 0);
+    for (std::size_t position = 0; position < values.size(); ++position) {
+      std::uint32_t gap{0};
+      if (position == 0) {
+        gap = zigzag(values[0] - base);
+      } else {
+        modern_cpp_template_assert(values[position] >= values[position - 1]);
+        gap = values[position] - values[position - 1];
+      }
+      auto const length = byte_length(gap);
+      out[control_position + position / 4] |=
+          static_cast<std::uint8_t>((length - 1) << (2 * (position % 4)));
+      for (std::size_t byte = 0; byte < length; ++byte) {
+        out.push_back(static_cast<std::uint8_t>(gap >> (8 * byte)));
+      }
+    }
+  }
+
+  ///\internal Decode a list, calling function(position, value) for each of
+  /// its count values in order
+  ///\param in the first control byte, followed by at least kPadding bytes
+  /// past the end of the list
+  ///\param count the number of values
+  ///\param base the base the list was encoded with
+  ///\param function the function to call
+  template <typename Function>
+  static void for_each(std::uint8_t const* in, std::size_t count,
+                       std::uint32_t base, Function&& function) {
+    auto const* data = in + (count + 3) / 4;
+    std::size_t position{0};
+    std::uint32_t previous{base};
+#if defined(__SSSE3__)
+    auto running = _mm_set1_epi32(static_cast<int>(base));
+    alignas(16) std::array<std::uint32_t, 4> quad{};
+    for (; position + 4 <= count; position += 4) {
+      auto const code = in[position / 4];
+      auto gaps = _mm_shuffle_epi8(
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(data)),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              kTables.shuffles[code].data())));
+      data += kTables.lengths[code];
+      if (position == 0) {
+        auto const first = unzigzag(
+            static_cast<std::uint32_t>(_mm_cvtsi128_si32(gaps)));
+        gaps = _mm_or_si128(
+            _mm_and_si128(gaps, _mm_set_epi32(-1, -1, -1, 0)),
+            _mm_cvtsi32_si128(static_cast<int>(first)));
+      }
+      // inclusive prefix sum of the four lanes, plus the last value so far
+      gaps = _mm_add_epi32(gaps, _mm_slli_si128(gaps, 4));
+      gaps = _mm_add_epi32(gaps, _mm_slli_si128(gaps, 8));
+      running = _mm_add_epi32(gaps, running);
+      _mm_store_si128(reinterpret_cast<__m128i*>(quad.data()), running);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      running = _mm_shuffle_epi32(running, 0xFF);
+      for (std::size_t lane = 0; lane < 4; ++lane) {
+        function(position + lane, quad[lane]);
+      }
+      previous = quad[3];
+    }
+#endif
+    for (; position < count; ++position) {
+      auto const code = static_cast<std::size_t>(in[position / 4]);
+      auto const length = ((code >> (2 * (position % 4))) & 3U) + 1;
+      auto const gap = read_gap(data, length);
+      data += length;
+      previous = position == 0 ? base + unzigzag(gap) : previous + gap;
+      function(position, previous);
+    }
+  }
+
+  ///\internal Decode a list into out
+  ///\see for_each
+  static void decode(std::uint8_t const* in, std::size_t count,
+                     std::uint32_t base, std::uint32_t* out) {
+    for_each(in, count, base,
+             [out](std::size_t position, std::uint32_t value) {
+               out[position] = value;
+             });
+  }
+
+ private:
+  [[nodiscard]] static constexpr std::size_t byte_length(std::uint32_t value) {
+    return value < (1U << 8U)    ? 1
+           : value < (1U << 16U) ? 2
+           : value < (1U << 24U) ? 3
+                                 : 4;
+  }
+
+  ///\internal map the difference of two values, taken modulo 2^32, to an
+  /// integer that is small when the difference is small in either direction
+  [[nodiscard]] static constexpr std::uint32_t zigzag(
+      std::uint32_t difference) {
+    return (difference << 1U) ^ (0U - (difference >> 31U));
+  }
+
+  [[nodiscard]] static constexpr std::uint32_t unzigzag(std::uint32_t code) {
+    return (code >> 1U) ^ (0U - (code & 1U));
+  }
+
+  ///\internal read a little endian gap of length bytes - relies on the
+  /// padding to read a whole word
+  [[nodiscard]] static std::uint32_t read_gap(std::uint8_t const* data,
+                                              std::size_t length) {
+    std::uint32_t gap{0};
+    if constexpr (std::endian::native == std::endian::little) {
+      std::memcpy(&gap, data, sizeof(gap));
+      return length == sizeof(gap) ? gap
+                                   : gap & ((1U << (8 * length)) - 1);
+    }
+    for (std::size_t byte = 0; byte < length; ++byte) {
+      gap |= static_cast<std::uint32_t>(data[byte]) << (8 * byte);
+    }
+    return gap;
+  }
+
+  static constexpr StreamVByteTables kTables{make_stream_vbyte_tables()};
+};
+
+}  // namespace internal
+
+///\brief A read-only CSR graph with compressed neighbor lists
+/// CsrGraph already stores every edge once per direction as a 32-bit local
+/// target (no head, which is implied by the row) plus its cost.  This
+/// representation additionally sorts every neighbor list and stores it as
+/// the gaps between consecutive targets in Stream VByte format - the first
+/// target relative to the node itself - so a target costs one byte when the
+/// neighbors of a node have local indices near its own, and never more than
+/// four.  How close they are depends on the node order;
+/// reordering the graph for locality before compressing improves the ratio.
+/// Neighbor lists are decoded with SSSE3 shuffles when the compiler targets
+/// SSSE3 (for example with -march=native) and with a scalar loop otherwise.
+///
+/// Local indices and nodes are those of the CsrGraph it was compressed from.
+/// Because the neighbor lists are sorted, a breadth_first_search visits the
+/// neighbors of a node in ascending local index rather than insertion order.
+/// Edge costs are kept uncompressed, in the order of the sorted targets.
+///\tparam NodeValue_T The value stored in a Node
+///\tparam CostType_T The type of the cost of an Edge
+template <typename NodeValue_T, typename CostType_T>
+class CompressedCsrGraph {
+  using Codec = internal::StreamVByte;
+
+ public:
+  using NodeValue = NodeValue_T;
+  using CostType = CostType_T;
+  using SourceGraph = CsrGraph<NodeValue, CostType>;
+  using Node = typename SourceGraph::Node;
+  using NodeIndex = typename SourceGraph::NodeIndex;
+  using LocalIndex = typename SourceGraph::LocalIndex;
+  using EdgeOffset = typename SourceGraph::EdgeOffset;
+  using VisitationContext = typename SourceGraph::VisitationContext;
+
+  ///\brief Sentinel returned by find_local() for an unknown node id
+  static constexpr LocalIndex kInvalidLocalIndex{
+      SourceGraph::kInvalidLocalIndex};
+
+  ///\brief Construct an empty CompressedCsrGraph
+  CompressedCsrGraph() = default;
+
+  ///\brief Compress a CsrGraph
+  ///\param graph the graph to compress
+  explicit CompressedCsrGraph(SourceGraph const& graph)
+      : nodes_(graph.nodes().begin(), graph.nodes().end()),
+        offsets_(graph.offsets().begin(), graph.offsets().end()),
+        byte_offsets_(graph.number_of_nodes() + 1, 0),
+        bytes_{} {
+    costs_.reserve(graph.number_of_edges());
+    std::vector<std::pair<LocalIndex, CostType>> edges;
+    std::vector<LocalIndex> targets;
+    for (std::size_t local = 0; local < nodes_.size(); ++local) {
+      auto const local_index = static_cast<LocalIndex>(local);
+      auto const neighbors = graph.neighbors(local_index);
+      auto const costs = graph.neighbor_costs(local_index);
+      edges.clear();
+      for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+        edges.emplace_back(neighbors[edge], costs[edge]);
+      }
+      std::stable_sort(edges.begin(), edges.end(),
+                       [](auto const& lhs, auto const& rhs) {
+                         return lhs.first < rhs.first;
+                       });
+      targets.clear();
+      for (auto const& [target, cost] : edges) {
+        targets.push_back(target);
+        costs_.push_back(cost);
+      }
+      Codec::encode(targets, local_index, bytes_);
+      byte_offsets_[local + 1] = bytes_.size();
+    }
+    bytes_.resize(bytes_.size() + Codec::kPadding, 0);
+    bytes_.shrink_to_fit();
+  }
+
+  ///\brief return the number of nodes in the graph
+  [[nodiscard]] std::size_t number_of_nodes() const { return nodes_.size(); }
+
+  ///\brief return the number of stored (directed) edges
+  [[nodiscard]] std::size_t number_of_edges() const { return costs_.size(); }
+
+  ///\brief return the number of bytes of the encoded neighbor lists
+  [[nodiscard]] std::size_t encoded_bytes() const {
+    return bytes_.size() - Codec::kPadding;
+  }
+
+  ///\brief return the number of bytes of the adjacency structure - the row
+  /// offsets, the encoded neighbor lists and the costs
+  [[nodiscard]] std::size_t adjacency_bytes() const {
+    return (offsets_.size() + byte_offsets_.size()) * sizeof(EdgeOffset) +
+           bytes_.size() + costs_.size() * sizeof(CostType);
+  }
+
+  ///\brief Return the Node at a local index
+  ///\param local_index the local index of the Node
+  ///\return Node const&
+  [[nodiscard]] Node const& node(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < nodes_.size());
+    return nodes_[local_index];
+  }
+
+  ///\brief Return the original node id of a local index
+  ///\param local_index the local index of the Node
+  ///\return NodeIndex
+  [[nodiscard]] NodeIndex original_id(LocalIndex local_index) const {
+    return node(local_index).id;
+  }
+
+  ///\brief Find the local index of an original node id
+  ///\param node_index the original id of the Node
+  ///\return LocalIndex the local index or kInvalidLocalIndex if not found
+  [[nodiscard]] LocalIndex find_local(NodeIndex node_index) const {
+    auto node_iterator = std::lower_bound(
+        nodes_.begin(), nodes_.end(), node_index,
+        [](Node const& entry, NodeIndex key) { return entry.id < key; });
+    [[likely]] if (node_iterator != nodes_.end() &&
+                   node_iterator->id == node_index) {
+      return static_cast<LocalIndex>(node_iterator - nodes_.begin());
+    }
+    return kInvalidLocalIndex;
+  }
+
+  ///\brief return the number of edges incident to a node
+  ///\param local_index the local index of the Node
+  [[nodiscard]] std::size_t degree(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < nodes_.size());
+    return offsets_[local_index + 1] - offsets_[local_index];
+  }
+
+  ///\brief Decode the neighbors (local indices) of a node
+  ///\param local_index the local index of the Node
+  ///\param buffer receives the neighbors; resized to at least degree()
+  ///\return std::span<LocalIndex const> the neighbors in ascending order,
+  /// valid until buffer is modified
+  std::span<LocalIndex const> neighbors(LocalIndex local_index,
+                                        std::vector<LocalIndex>& buffer) const {
+    auto const count = degree(local_index);
+    if (buffer.size() < count) {
+      buffer.resize(count);
+    }
+    Codec::decode(bytes_.data() + byte_offsets_[local_index], count,
+                  local_index, buffer.data());
+    return std::span<LocalIndex const>(buffer).first(count);
+  }
+
+  ///\brief Call function(target, cost) for every edge of a node
+  /// Decodes the targets a block at a time, without a buffer.
+  ///\param local_index the local index of the Node
+  ///\param function the function to call
+  template <typename Function>
+  void for_each_neighbor(LocalIndex local_index, Function&& function) const {
+    auto const costs = neighbor_costs(local_index);
+    Codec::for_each(bytes_.data() + byte_offsets_[local_index], costs.size(),
+                    local_index, [&](std::size_t edge, LocalIndex target) {
+                      function(target, costs[edge]);
+                    });
+  }
+
+  ///\brief Return the edge costs of a node - parallel to neighbors()
+  ///\param local_index the local index of the Node
+  ///\return std::span<CostType const>
+  [[nodiscard]] std::span<CostType const> neighbor_costs(
+      LocalIndex local_index) const {
+    return std::span<CostType const>(costs_).subspan(offsets_[local_index],
+                                                     degree(local_index));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// Same contract as CsrGraph::breadth_first_search
+  ///\param start_node_index the original id of the Node to start at
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    VisitationContext context;
+    breadth_first_search(start_node_index, context, std::move(callback));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// reusing a caller supplied visitation context
+  ///\param start_node_index the original id of the Node to start at
+  ///\param context the visitation context; it is reset by this call
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index, VisitationContext& context,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    auto start_local = find_local(start_node_index);
+    modern_cpp_template_assert_message(start_local != kInvalidLocalIndex,
+                                       "start node is not in the graph");
+    if (start_local == kInvalidLocalIndex) {
+      return;
+    }
+    context.reset(nodes_.size());
+    context.visit(start_local);
+    if (callback != nullptr) {
+      callback(nodes_[start_local]);
+    }
+    context.push(start_local);
+    std::vector<LocalIndex> buffer;
+    while (!context.empty()) {
+      for (auto tail_local : neighbors(context.pop(), buffer)) {
+        if (context.visit(tail_local)) {
+          if (callback != nullptr) {
+            if (callback(nodes_[tail_local])) {
+              return;
+            }
+          }
+          context.push(tail_local);
+        }
+      }
+    }
+  }
+
+ private:
+  std::vector<Node> nodes_{};
+  std::vector<EdgeOffset> offsets_{0};
+  std::vector<std::size_t> byte_offsets_{0};
+  std::vector<std::uint8_t> bytes_{std::vector<std::uint8_t>(Codec::kPadding)};
+  std::vector<CostType> costs_{};
+};
+
+///\brief Compress a CsrGraph
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to compress
+///\return CompressedCsrGraph<NodeValue, CostType>
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CompressedCsrGraph<NodeValue, CostType> compress(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  return CompressedCsrGraph<NodeValue, CostType>(graph);
+}
+
+///\brief GraphTraits for CompressedCsrGraph - vertices are local indices
+template <typename NodeValue, typename CostType_T>
+struct GraphTraits<CompressedCsrGraph<NodeValue, CostType_T>> {
+  using Graph = CompressedCsrGraph<NodeValue, CostType_T>;
+  using NodeIndex = typename Graph::NodeIndex;
+  using Vertex = typename Graph::LocalIndex;
+  using CostType = CostType_T;
+  static constexpr Vertex kInvalidVertex{Graph::kInvalidLocalIndex};
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    auto local_index = graph.find_local(node_index);
+    modern_cpp_template_assert_message(local_index != kInvalidVertex,
+                                       "node is not in the graph");
+    return local_index;
+  }
+
+  [[nodiscard]] static NodeIndex node_index(Graph const& graph,
+                                            Vertex vertex) {
+    return graph.original_id(vertex);
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    graph.for_each_neighbor(vertex, std::forward<Function>(function));
+  }
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,336 @@
+///\file concurrent_graph.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A read-mostly graph: lock-free readers of immutable CsrGraph
+/// versions and writers that publish batches of edges
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <gsl/gsl>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/epoch_reclamation.h"
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+namespace internal {
+
+///\brief Build a new CsrGraph from a base graph plus a batch of edges
+/// Produces the same graph as freezing an UndirectedGraph that received the
+/// edges of base and then add_edge() for every edge of the batch: new nodes
+/// are merged in id order, and every row keeps its base edges followed by
+/// the batch edges in batch order.  O(V + E + B log V) for B batch edges.
+///\param base the current graph
+///\param edges the batch, in original node ids
+///\param new_nodes the id and value of nodes of the batch, sorted by id with
+/// no duplicates; ids already in base are ignored
+///\return CsrGraph<NodeValue, CostType>
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CsrGraph<NodeValue, CostType> append_edges(
+    CsrGraph<NodeValue, CostType> const& base,
+    std::span<EdgeListEntry<CostType> const> edges,
+    std::vector<std::pair<gsl::index, NodeValue>> new_nodes) {
+  using Graph = CsrGraph<NodeValue, CostType>;
+  using Node = typename Graph::Node;
+  using LocalIndex = typename Graph::LocalIndex;
+  using EdgeOffset = typename Graph::EdgeOffset;
+
+  auto const base_nodes = base.nodes();
+  std::vector<Node> nodes;
+  nodes.reserve(base_nodes.size() + new_nodes.size());
+  std::vector<LocalIndex> base_locals(base_nodes.size());
+  std::size_t base_position{0};
+  for (auto& [node_index, node_value] : new_nodes) {
+    while (base_position < base_nodes.size() &&
+           base_nodes[base_position].id < node_index) {
+      base_locals[base_position] = static_cast<LocalIndex>(nodes.size());
+      nodes.push_back(base_nodes[base_position++]);
+    }
+    if (base_position == base_nodes.size() ||
+        base_nodes[base_position].id != node_index) {
+      nodes.push_back(Node{false, node_index, std::move(node_value)});
+    }
+  }
+  while (base_position < base_nodes.size()) {
+    base_locals[base_position] = static_cast<LocalIndex>(nodes.size());
+    nodes.push_back(base_nodes[base_position++]);
+  }
+  modern_cpp_template_assert_message(
+      nodes.size() < static_cast<std::size_t>(Graph::kInvalidLocalIndex),
+      "too many nodes for a 32-bit local index");
+  bool const has_new_nodes = nodes.size() != base_nodes.size();
+
+  auto local_of = [&nodes](gsl::index node_index) {
+    auto node_iterator = std::lower_bound(
+        nodes.begin(), nodes.end(), node_index,
+        [](Node const& node, gsl::index key) { return node.id < key; });
+    modern_cpp_template_assert(node_iterator != nodes.end() &&
+                               node_iterator->id == node_index);
+    return static_cast<LocalIndex>(node_iterator - nodes.begin());
+  };
+  std::vector<std::pair<LocalIndex, LocalIndex>> endpoints;
+  endpoints.reserve(edges.size());
+  std::vector<EdgeOffset> offsets(nodes.size() + 1, 0);
+  for (std::size_t node = 0; node < base_nodes.size(); ++node) {
+    offsets[base_locals[node] + 1] =
+        base.degree(static_cast<LocalIndex>(node));
+  }
+  for (auto const& edge : edges) {
+    auto const head = local_of(edge.head);
+    auto const tail = local_of(edge.tail);
+    endpoints.emplace_back(head, tail);
+    ++offsets[head + 1];
+    ++offsets[tail + 1];
+  }
+  for (std::size_t node = 0; node < nodes.size(); ++node) {
+    offsets[node + 1] += offsets[node];
+  }
+
+  std::vector<LocalIndex> targets(offsets.back());
+  std::vector<CostType> costs(offsets.back());
+  std::vector<EdgeOffset> cursors(offsets.begin(), offsets.end() - 1);
+  for (std::size_t node = 0; node < base_nodes.size(); ++node) {
+    auto const neighbors = base.neighbors(static_cast<LocalIndex>(node));
+    auto const neighbor_costs =
+        base.neighbor_costs(static_cast<LocalIndex>(node));
+    auto& cursor = cursors[base_locals[node]];
+    if (has_new_nodes) {
+      std::transform(neighbors.begin(), neighbors.end(),
+                     targets.begin() + static_cast<std::ptrdiff_t>(cursor),
+                     [&base_locals](LocalIndex neighbor) {
+                       return base_locals[neighbor];
+                     });
+    } else {
+      std::copy(neighbors.begin(), neighbors.end(),
+                targets.begin() + static_cast<std::ptrdiff_t>(cursor));
+    }
+    std::copy(neighbor_costs.begin(), neighbor_costs.end(),
+              costs.begin() + static_cast<std::ptrdiff_t>(cursor));
+    cursor += neighbors.size();
+  }
+  for (std::size_t edge = 0; edge < edges.size(); ++edge) {
+    auto const [head, tail] = endpoints[edge];
+    targets[cursors[head]] = tail;
+    costs[cursors[head]++] = edges[edge].cost;
+    targets[cursors[tail]] = head;
+    costs[cursors[tail]++] = edges[edge].cost;
+  }
+  return Graph(std::move(nodes), std::move(offsets), std::move(targets),
+               std::move(costs));
+}
+
+}  // namespace internal
+
+///\brief A graph shared between query threads and writer threads
+/// Readers see an immutable, versioned CsrGraph snapshot.  Pinning one is
+/// lock-free - an epoch announcement plus an atomic load - so traversals
+/// never wait for writers or for each other.  Writers queue edges with
+/// add_edge(), which only takes a short lock to append to the pending batch,
+/// and publish() turns the batch into the next version: it builds a new
+/// CsrGraph from the current one plus the batch, swaps it in atomically and
+/// retires the old version to an EpochDomain, which deletes it once the
+/// last reader that pinned it is done.
+///
+/// A publish costs O(V + E) regardless of the batch size, so batch many
+/// edges per version.  Node values follow UndirectedGraph::add_edge(NodeIndex,
+/// ...): the first value given for an id is kept.
+///\tparam NodeValue_T The value stored in a Node
+///\tparam CostType_T The type of the cost of an Edge
+template <typename NodeValue_T, typename CostType_T>
+class ConcurrentGraph {
+ public:
+  using NodeValue = NodeValue_T;
+  using CostType = CostType_T;
+  using Snapshot = CsrGraph<NodeValue, CostType>;
+  using Node = typename Snapshot::Node;
+  using NodeIndex = typename Snapshot::NodeIndex;
+  using LocalIndex = typename Snapshot::LocalIndex;
+
+ private:
+  ///\brief One published version of the graph
+  struct Version {
+    Snapshot graph{};
+    uint64_t number{0};
+  };
+  using Domain = EpochDomain<Version>;
+
+ public:
+  ///\brief A pinned version of the graph
+  /// The snapshot stays valid, and unchanged, until the guard is destroyed.
+  class ReadGuard {
+   public:
+    ReadGuard(ReadGuard const&) = delete;
+    ReadGuard(ReadGuard&&) = delete;
+    ReadGuard& operator=(ReadGuard const&) = delete;
+    ReadGuard& operator=(ReadGuard&&) = delete;
+
+    ///\brief Unpin the version
+    ~ReadGuard() { reader_.exit(); }
+
+    ///\brief return the pinned snapshot
+    [[nodiscard]] Snapshot const& graph() const { return version_->graph; }
+    [[nodiscard]] Snapshot const& operator*() const { return graph(); }
+    [[nodiscard]] Snapshot const* operator->() const { return &graph(); }
+
+    ///\brief return the version number; zero before the first publish()
+    [[nodiscard]] uint64_t version() const { return version_->number; }
+
+   private:
+    friend ConcurrentGraph;
+
+    ReadGuard(typename Domain::Reader& reader,
+              std::atomic<Version const*> const& current)
+        : reader_(reader) {
+      reader_.enter();
+      version_ = current.load(std::memory_order_seq_cst);
+    }
+
+    typename Domain::Reader& reader_;
+    Version const* version_{nullptr};
+  };
+
+  ///\brief The registration of one query thread
+  /// Create one per thread with make_reader() and reuse it for every query;
+  /// it must be destroyed before the graph.
+  class Reader {
+   public:
+    ///\brief Pin the current version
+    ///\return ReadGuard
+    [[nodiscard]] ReadGuard pin() { return ReadGuard(reader_, *current_); }
+
+   private:
+    friend ConcurrentGraph;
+
+    Reader(typename Domain::Reader reader,
+           std::atomic<Version const*> const& current)
+        : reader_(std::move(reader)), current_(&current) {}
+
+    typename Domain::Reader reader_;
+    std::atomic<Version const*> const* current_;
+  };
+
+  ///\brief Construct an empty graph at version zero
+  ConcurrentGraph() : current_(new Version{}) {}
+
+  ///\brief Construct a graph whose version zero is an existing snapshot
+  ///\param initial the initial graph
+  explicit ConcurrentGraph(Snapshot initial)
+      : current_(new Version{std::move(initial), 0}) {}
+
+  ConcurrentGraph(ConcurrentGraph const&) = delete;
+  ConcurrentGraph(ConcurrentGraph&&) = delete;
+  ConcurrentGraph& operator=(ConcurrentGraph const&) = delete;
+  ConcurrentGraph& operator=(ConcurrentGraph&&) = delete;
+
+  ///\brief Delete the current version; retired versions go with the domain
+  ~ConcurrentGraph() { delete current_.load(std::memory_order_relaxed); }
+
+  ///\brief Register a query thread
+  ///\return Reader
+  [[nodiscard]] Reader make_reader() {
+    return Reader(domain_.make_reader(), current_);
+  }
+
+  ///\brief Queue an edge for the next publish()
+  /// Because this is an undirected graph, the edge is stored in both
+  /// directions.  Thread safe.
+  ///\param head_node_index Index of the head Node
+  ///\param head_node_value Value of the head Node
+  ///\param tail_node_index Index of the tail Node
+  ///\param tail_node_value Value of the tail Node
+  ///\param edge_cost Cost of the edge
+  void add_edge(NodeIndex head_node_index, NodeValue head_node_value,
+                NodeIndex tail_node_index, NodeValue tail_node_value,
+                CostType edge_cost = 0) {
+    std::lock_guard lock(pending_mutex_);
+    pending_edges_.push_back({head_node_index, tail_node_index, edge_cost});
+    pending_nodes_.emplace_back(head_node_index, std::move(head_node_value));
+    pending_nodes_.emplace_back(tail_node_index, std::move(tail_node_value));
+  }
+
+  ///\brief return the number of edges queued for the next publish()
+  [[nodiscard]] std::size_t number_of_pending_edges() const {
+    std::lock_guard lock(pending_mutex_);
+    return pending_edges_.size();
+  }
+
+  ///\brief Publish the queued edges as a new version
+  /// Readers that pinned an older version keep it until they unpin; new pins
+  /// see the new version.  Also deletes the retired versions no reader holds
+  /// anymore.  Thread safe; concurrent publishes are serialized.
+  ///\return uint64_t the current version number
+  uint64_t publish() {
+    std::lock_guard publish_lock(publish_mutex_);
+    std::vector<EdgeListEntry<CostType>> edges;
+    std::vector<std::pair<NodeIndex, NodeValue>> nodes;
+    {
+      std::lock_guard lock(pending_mutex_);
+      edges.swap(pending_edges_);
+      nodes.swap(pending_nodes_);
+    }
+    // only publishers store current_, and they hold publish_mutex_
+    auto const* base = current_.load(std::memory_order_relaxed);
+    if (!edges.empty()) {
+      std::stable_sort(nodes.begin(), nodes.end(),
+                       [](auto const& lhs, auto const& rhs) {
+                         return lhs.first < rhs.first;
+                       });
+      nodes.erase(std::unique(nodes.begin(), nodes.end(),
+                              [](auto const& lhs, auto const& rhs) {
+                                return lhs.first == rhs.first;
+                              }),
+                  nodes.end());
+      auto next = std::make_unique<Version const>(
+          Version{internal::append_edges(
+                      base->graph,
+                      std::span<EdgeListEntry<CostType> const>(edges),
+                      std::move(nodes)),
+                  base->number + 1});
+      current_.store(next.get(), std::memory_order_seq_cst);
+      version_.store(next->number, std::memory_order_release);
+      domain_.retire(base);
+      base = next.release();
+    }
+    domain_.reclaim();
+    return base->number;
+  }
+
+  ///\brief return the current version number
+  /// Read from a counter of its own rather than through current_, whose
+  /// version a concurrent publish() may retire and delete at any time
+  /// without a pin.
+  [[nodiscard]] uint64_t version() const {
+    return version_.load(std::memory_order_acquire);
+  }
+
+  ///\brief return the number of old versions still held by readers
+  [[nodiscard]] std::size_t number_of_retired_versions() const {
+    return domain_.number_of_retired();
+  }
+
+ private:
+  Domain domain_{};
+  std::atomic<Version const*> current_{nullptr};
+  std::atomic<uint64_t> version_{0};
+  std::mutex publish_mutex_{};
+  mutable std::mutex pending_mutex_{};
+  std::vector<EdgeListEntry<CostType>> pending_edges_{};
+  std::vector<std::pair<NodeIndex, NodeValue>> pending_nodes_{};
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
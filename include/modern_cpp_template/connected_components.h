@@ -0,0 +1,217 @@
+///\file connected_components.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Multi-threaded connected components (Afforest) over a CsrGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The connected components of a graph, indexed by local index
+///\tparam LocalIndex the local index type of the graph
+template <typename LocalIndex>
+struct ConnectedComponents {
+  ///\brief The component of every node.  Components are numbered densely in
+  /// the order of their smallest local index, so the labels do not depend on
+  /// the number of threads.
+  std::vector<LocalIndex> labels{};
+  ///\brief The number of nodes in every component, indexed by label
+  std::vector<std::size_t> sizes{};
+
+  ///\brief return the number of components
+  [[nodiscard]] std::size_t number_of_components() const {
+    return sizes.size();
+  }
+};
+
+namespace internal {
+
+///\internal Number of nodes a thread claims at a time
+static constexpr std::size_t kComponentsChunkSize{1024};
+
+///\internal Number of neighbors of every node linked before the largest
+/// component is sampled.  Two is the value recommended by the Afforest paper.
+static constexpr std::size_t kComponentsNeighborRounds{2};
+
+///\internal Number of nodes sampled to guess the largest component
+static constexpr std::size_t kComponentsSamples{1024};
+
+///\brief A union-find forest whose links are installed with compare and swap
+/// Every tree points from larger to smaller local indices, so a root is the
+/// smallest node of its tree and a link can never form a cycle.  link() and
+/// compress() may run concurrently with each other.
+template <typename LocalIndex>
+class ConcurrentUnionFind {
+ public:
+  ///\brief Construct a forest of singleton trees
+  ///\param size the number of nodes
+  explicit ConcurrentUnionFind(std::size_t size) : parents_(size) {
+    for (std::size_t node = 0; node < size; ++node) {
+      parents_[node].store(static_cast<LocalIndex>(node),
+                           std::memory_order_relaxed);
+    }
+  }
+
+  ///\brief return the current parent of a node
+  [[nodiscard]] LocalIndex parent(LocalIndex node) const {
+    return parents_[node].load(std::memory_order_relaxed);
+  }
+
+  ///\brief Merge the trees of two nodes
+  /// Hooks the larger of the two roots under the smaller one; when another
+  /// thread changes a root first, retries from the new parents.
+  void link(LocalIndex first, LocalIndex second) {
+    auto first_parent = parent(first);
+    auto second_parent = parent(second);
+    while (first_parent != second_parent) {
+      auto high = std::max(first_parent, second_parent);
+      auto low = std::min(first_parent, second_parent);
+      auto high_parent = parent(high);
+      if (high_parent == low) {
+        return;
+      }
+      if (high_parent == high &&
+          parents_[high].compare_exchange_strong(high_parent, low,
+                                                 std::memory_order_relaxed)) {
+        return;
+      }
+      first_parent = parent(parent(high));
+      second_parent = parent(low);
+    }
+  }
+
+  ///\brief Point a node directly at its root
+  void compress(LocalIndex node) {
+    auto node_parent = parent(node);
+    while (parent(node_parent) != node_parent) {
+      node_parent = parent(node_parent);
+    }
+    parents_[node].store(node_parent, std::memory_order_relaxed);
+  }
+
+ private:
+  std::vector<std::atomic<LocalIndex>> parents_{};
+};
+
+}  // namespace internal
+
+///\brief Find the connected components of a graph with multiple threads
+/// Implements Afforest (Sutton, Ben-Nun and Bar-Noy, IPDPS 2018) on a
+/// lock-free union-find forest:
+///  1. link every node to its first two neighbors and compress the forest;
+///     this already joins most nodes of the giant component,
+///  2. guess the largest component from a fixed-seed sample of nodes,
+///  3. link the remaining neighbors of every node outside that component.
+/// Nodes of the largest component skip step 3 - every edge is stored in both
+/// directions, so its other endpoint links it instead.  On graphs with a
+/// giant component most edges are therefore never touched.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to label
+///\param pool the worker threads to run on
+///\return ConnectedComponents<LocalIndex> the component of every node
+template <typename NodeValue, typename CostType>
+[[nodiscard]] ConnectedComponents<
+    typename CsrGraph<NodeValue, CostType>::LocalIndex>
+connected_components(CsrGraph<NodeValue, CostType> const& graph,
+                     WorkerPool& pool) {
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  auto const number_of_nodes = graph.number_of_nodes();
+  ConnectedComponents<LocalIndex> result;
+  if (number_of_nodes == 0) {
+    return result;
+  }
+
+  internal::ConcurrentUnionFind<LocalIndex> forest(number_of_nodes);
+  auto compress_all = [&forest](std::size_t node, std::size_t /*thread*/) {
+    forest.compress(static_cast<LocalIndex>(node));
+  };
+  for (std::size_t round = 0; round < internal::kComponentsNeighborRounds;
+       ++round) {
+    parallel_for(pool, number_of_nodes, internal::kComponentsChunkSize,
+                 [&graph, &forest, round](std::size_t index,
+                                          std::size_t /*thread*/) {
+                   auto const node = static_cast<LocalIndex>(index);
+                   auto neighbors = graph.neighbors(node);
+                   if (round < neighbors.size()) {
+                     forest.link(node, neighbors[round]);
+                   }
+                 });
+    parallel_for(pool, number_of_nodes, internal::kComponentsChunkSize,
+                 compress_all);
+  }
+
+  std::mt19937_64 generator{number_of_nodes};
+  std::uniform_int_distribution<std::size_t> node_distribution{
+      0, number_of_nodes - 1};
+  std::unordered_map<LocalIndex, std::size_t> sample_counts;
+  for (std::size_t sample = 0; sample < internal::kComponentsSamples;
+       ++sample) {
+    ++sample_counts[forest.parent(
+        static_cast<LocalIndex>(node_distribution(generator)))];
+  }
+  auto const largest =
+      std::max_element(sample_counts.begin(), sample_counts.end(),
+                       [](auto const& lhs, auto const& rhs) {
+                         return lhs.second < rhs.second;
+                       })
+          ->first;
+
+  parallel_for(
+      pool, number_of_nodes, internal::kComponentsChunkSize,
+      [&graph, &forest, largest](std::size_t index, std::size_t /*thread*/) {
+        auto const node = static_cast<LocalIndex>(index);
+        if (forest.parent(node) == largest) {
+          return;
+        }
+        auto neighbors = graph.neighbors(node);
+        for (auto position = internal::kComponentsNeighborRounds;
+             position < neighbors.size(); ++position) {
+          forest.link(node, neighbors[position]);
+        }
+      });
+  parallel_for(pool, number_of_nodes, internal::kComponentsChunkSize,
+               compress_all);
+
+  // a root is the smallest node of its component, so it is always labeled
+  // before the other members are reached
+  result.labels.resize(number_of_nodes);
+  for (LocalIndex node = 0; node < number_of_nodes; ++node) {
+    auto root = forest.parent(node);
+    if (root == node) {
+      result.labels[node] = static_cast<LocalIndex>(result.sizes.size());
+      result.sizes.push_back(0);
+    } else {
+      result.labels[node] = result.labels[root];
+    }
+    ++result.sizes[result.labels[node]];
+  }
+  return result;
+}
+
+///\brief Find the connected components of a graph on the calling thread
+///\see connected_components(graph, pool)
+template <typename NodeValue, typename CostType>
+[[nodiscard]] ConnectedComponents<
+    typename CsrGraph<NodeValue, CostType>::LocalIndex>
+connected_components(CsrGraph<NodeValue, CostType> const& graph) {
+  WorkerPool pool(1);
+  return connected_components(graph, pool);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
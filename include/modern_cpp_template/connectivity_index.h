@@ -0,0 +1,183 @@
+///\file connectivity_index.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief An incrementally maintained union-find index answering
+/// connectivity queries on a growing graph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+///\brief Connected components of a graph that only ever gains edges
+/// A disjoint set forest with union by rank.  add_edge() halves the paths it
+/// walks, so the trees stay nearly flat and every operation is close to O(1)
+/// amortized.  The queries are const and never restructure the forest, so
+/// any number of threads may query concurrently; union by rank alone bounds
+/// a query to O(log n).
+///
+/// Node indices must be dense, like the node ids of UndirectedGraph.  A node
+/// joins the index with its first edge (or add_node()); indices in between
+/// that were never added are not part of any component.
+///\tparam Index the node index type
+///\tparam Allocator the allocator of the index arrays; any value type
+template <typename Index, typename Allocator = std::allocator<std::byte>>
+class ConnectivityIndex {
+  template <typename T>
+  using RebindAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+ public:
+  ///\brief Construct an empty ConnectivityIndex
+  ConnectivityIndex() = default;
+
+  ///\brief Construct an empty ConnectivityIndex that allocates through
+  /// allocator
+  ///\param allocator the allocator of the index arrays
+  explicit ConnectivityIndex(Allocator const& allocator)
+      : parents_(RebindAllocator<Index>(allocator)),
+        ranks_(RebindAllocator<uint8_t>(allocator)),
+        sizes_(RebindAllocator<std::size_t>(allocator)) {}
+
+  ///\brief Reserve room for node indices in [0, size)
+  void reserve(std::size_t size) {
+    parents_.reserve(size);
+    ranks_.reserve(size);
+    sizes_.reserve(size);
+  }
+
+  ///\brief return the number of nodes in the index
+  [[nodiscard]] std::size_t number_of_nodes() const { return number_of_nodes_; }
+
+  ///\brief return the number of connected components
+  [[nodiscard]] std::size_t number_of_components() const {
+    return number_of_components_;
+  }
+
+  ///\brief Test whether a node is part of the index
+  ///\param node the node index
+  [[nodiscard]] bool contains(Index node) const {
+    // a negative index converts to a position beyond the end
+    return position(node) < sizes_.size() && sizes_[position(node)] != 0;
+  }
+
+  ///\brief Add a node as its own component
+  /// Adding a node that is already part of the index does nothing.
+  ///\param node the node index
+  void add_node(Index node) {
+    modern_cpp_template_assert(std::cmp_greater_equal(node, 0));
+    auto const node_position = static_cast<std::size_t>(node);
+    if (node_position >= parents_.size()) {
+      auto const old_size = parents_.size();
+      parents_.resize(node_position + 1);
+      ranks_.resize(node_position + 1, 0);
+      sizes_.resize(node_position + 1, 0);
+      for (auto index = old_size; index <= node_position; ++index) {
+        parents_[index] = static_cast<Index>(index);
+      }
+    }
+    if (sizes_[node_position] == 0) {
+      sizes_[node_position] = 1;
+      ++number_of_nodes_;
+      ++number_of_components_;
+    }
+  }
+
+  ///\brief Record an edge, merging the components of its two ends
+  /// Adds the nodes first if needed.
+  ///\param head one end of the edge
+  ///\param tail the other end of the edge
+  ///\return true if the edge joined two different components
+  bool add_edge(Index head, Index tail) {
+    add_node(head);
+    add_node(tail);
+    auto head_root = find_and_halve(head);
+    auto tail_root = find_and_halve(tail);
+    if (head_root == tail_root) {
+      return false;
+    }
+    auto& head_rank = ranks_[position(head_root)];
+    auto& tail_rank = ranks_[position(tail_root)];
+    if (head_rank < tail_rank) {
+      std::swap(head_root, tail_root);
+    } else if (head_rank == tail_rank) {
+      ++head_rank;
+    }
+    parents_[position(tail_root)] = head_root;
+    sizes_[position(head_root)] += sizes_[position(tail_root)];
+    --number_of_components_;
+    return true;
+  }
+
+  ///\brief Return the representative of the component of a node
+  /// Two nodes are connected exactly when their representatives are equal.
+  /// A representative changes when its component is merged.
+  ///\param node a node of the index
+  [[nodiscard]] Index find(Index node) const {
+    modern_cpp_template_assert_message(contains(node),
+                                       "node is not in the connectivity index");
+    while (parents_[position(node)] != node) {
+      node = parents_[position(node)];
+    }
+    return node;
+  }
+
+  ///\brief Test whether two nodes are in the same component
+  ///\param first a node of the index
+  ///\param second a node of the index
+  [[nodiscard]] bool connected(Index first, Index second) const {
+    return find(first) == find(second);
+  }
+
+  ///\brief return the number of nodes in the component of a node
+  ///\param node a node of the index
+  [[nodiscard]] std::size_t component_size(Index node) const {
+    return sizes_[position(find(node))];
+  }
+
+  ///\brief Remove every node
+  void clear() {
+    parents_.clear();
+    ranks_.clear();
+    sizes_.clear();
+    number_of_nodes_ = 0;
+    number_of_components_ = 0;
+  }
+
+ private:
+  [[nodiscard]] static std::size_t position(Index node) {
+    return static_cast<std::size_t>(node);
+  }
+
+  ///\brief find() that points every other node on the path at its
+  /// grandparent
+  Index find_and_halve(Index node) {
+    while (parents_[position(node)] != node) {
+      auto& parent = parents_[position(node)];
+      parent = parents_[position(parent)];
+      node = parent;
+    }
+    return node;
+  }
+
+  std::vector<Index, RebindAllocator<Index>> parents_{};
+  // a rank never exceeds log2 of the number of nodes
+  std::vector<uint8_t, RebindAllocator<uint8_t>> ranks_{};
+  // the size of a root's component; zero for indices not in the index
+  std::vector<std::size_t, RebindAllocator<std::size_t>> sizes_{};
+  std::size_t number_of_nodes_{0};
+  std::size_t number_of_components_{0};
+};
+
+}  // namespace modern_cpp_template::algorithms
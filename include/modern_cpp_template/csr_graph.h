@@ -0,0 +1,318 @@
+///\file csr_graph.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A frozen, Compressed Sparse Row (CSR) snapshot of an UndirectedGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <gsl/gsl>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief A read-only Compressed Sparse Row (CSR) representation of an
+/// UndirectedGraph
+/// The node ids of the source graph are remapped onto the dense range
+/// [0, number_of_nodes()) - the "local" index.  The adjacency of local node u
+/// lives in targets()[offsets()[u] .. offsets()[u + 1]) with the matching edge
+/// costs at the same positions in costs().  Traversals therefore scan
+/// contiguous arrays rather than chasing a hash lookup per hop.
+///
+/// Local indices are assigned in ascending order of the original node id and
+/// each adjacency list keeps the insertion order of the source graph, so a
+/// breadth_first_search over a CsrGraph visits nodes in the same order as the
+/// UndirectedGraph it was frozen from.
+///\tparam NodeValue_T The value stored in a Node
+///\tparam CostType_T The type of the cost of an Edge
+template <typename NodeValue_T, typename CostType_T>
+class CsrGraph {
+ public:
+  using NodeValue = NodeValue_T;
+  using CostType = CostType_T;
+  using Edge_T = Edge<NodeValue, CostType>;
+  using Node = typename Edge_T::Node_T;
+  using NodeIndex = typename Edge_T::NodeIndex;
+  using LocalIndex = std::uint32_t;
+  using EdgeOffset = std::size_t;
+  using SourceGraph = UndirectedGraph<NodeValue, CostType>;
+  using VisitationContext =
+      modern_cpp_template::algorithms::VisitationContext<LocalIndex>;
+
+  ///\brief Sentinel returned by find_local() for an unknown node id
+  static constexpr LocalIndex kInvalidLocalIndex{
+      std::numeric_limits<LocalIndex>::max()};
+
+  ///\brief Construct an empty CsrGraph
+  CsrGraph() = default;
+
+  ///\brief Freeze an UndirectedGraph into a CsrGraph
+  /// The source graph is not modified.  Later changes to the source graph are
+  /// not reflected in this snapshot.  Removed nodes and edges are left out.
+  ///\tparam Allocator the allocator of the source graph
+  ///\tparam Map the map type of the source graph
+  ///\param graph the graph to freeze
+  template <typename Allocator,
+            template <typename, typename, typename> class Map>
+  explicit CsrGraph(
+      UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph) {
+    auto const& node_map = graph.node_map();
+    modern_cpp_template_assert_message(
+        node_map.size() < static_cast<std::size_t>(kInvalidLocalIndex),
+        "too many nodes for a 32-bit local index");
+
+    nodes_.reserve(node_map.size());
+    for (auto const& [node_index, node] : node_map) {
+      if (node.is_removed) {
+        continue;
+      }
+      nodes_.push_back(node);
+      nodes_.back().is_visited = false;
+    }
+    std::sort(nodes_.begin(), nodes_.end(),
+              [](Node const& lhs, Node const& rhs) { return lhs.id < rhs.id; });
+
+    std::unordered_map<NodeIndex, LocalIndex> local_indices(nodes_.size());
+    id_index_.reserve(nodes_.size());
+    for (std::size_t local = 0; local < nodes_.size(); ++local) {
+      auto local_index = static_cast<LocalIndex>(local);
+      local_indices.emplace(nodes_[local].id, local_index);
+      id_index_.emplace_back(nodes_[local].id, local_index);
+    }
+
+    // Count the degree of every node first so that the target and cost
+    // arrays are allocated exactly once
+    auto const& adjacency_map = graph.adjacency_map();
+    offsets_.assign(nodes_.size() + 1, 0);
+    for (std::size_t local = 0; local < nodes_.size(); ++local) {
+      auto edge_iterator = adjacency_map.find(nodes_[local].id);
+      offsets_[local + 1] = offsets_[local];
+      if (edge_iterator != adjacency_map.end()) {
+        offsets_[local + 1] += edge_iterator->second.size() -
+                               graph.number_of_removed_edges(nodes_[local].id);
+      }
+    }
+
+    targets_.resize(offsets_.back());
+    costs_.resize(offsets_.back());
+    for (std::size_t local = 0; local < nodes_.size(); ++local) {
+      auto edge_iterator = adjacency_map.find(nodes_[local].id);
+      if (edge_iterator == adjacency_map.end()) {
+        continue;
+      }
+      auto position = offsets_[local];
+      for (auto const& edge : edge_iterator->second) {
+        if (edge.is_removed()) {
+          continue;
+        }
+        targets_[position] = local_indices.at(edge.tail_node_index);
+        costs_[position] = edge.cost;
+        ++position;
+      }
+    }
+  }
+
+  ///\brief Construct a CsrGraph that adopts already built CSR arrays
+  /// Used by builders that never materialize an UndirectedGraph.  The local
+  /// index of a node is its position in nodes.
+  ///\param nodes the nodes, sorted by strictly ascending id
+  ///\param offsets number_of_nodes() + 1 row offsets into targets
+  ///\param targets the edge targets (local indices)
+  ///\param costs the edge costs, parallel to targets
+  CsrGraph(std::vector<Node> nodes, std::vector<EdgeOffset> offsets,
+           std::vector<LocalIndex> targets, std::vector<CostType> costs)
+      : nodes_(std::move(nodes)),
+        offsets_(std::move(offsets)),
+        targets_(std::move(targets)),
+        costs_(std::move(costs)) {
+    modern_cpp_template_assert_message(
+        nodes_.size() < static_cast<std::size_t>(kInvalidLocalIndex),
+        "too many nodes for a 32-bit local index");
+    modern_cpp_template_assert(offsets_.size() == nodes_.size() + 1);
+    modern_cpp_template_assert(offsets_.front() == 0 &&
+                               offsets_.back() == targets_.size());
+    modern_cpp_template_assert(costs_.size() == targets_.size());
+    id_index_.reserve(nodes_.size());
+    for (std::size_t local = 0; local < nodes_.size(); ++local) {
+      modern_cpp_template_assert_message(
+          local == 0 || nodes_[local - 1].id < nodes_[local].id,
+          "nodes must be sorted by strictly ascending id");
+      id_index_.emplace_back(nodes_[local].id, static_cast<LocalIndex>(local));
+    }
+  }
+
+  ///\brief return the number of nodes in the graph
+  ///\return std::size_t the number of nodes in the graph
+  [[nodiscard]] std::size_t number_of_nodes() const { return nodes_.size(); }
+
+  ///\brief return the number of stored (directed) edges
+  /// Every undirected edge is stored once in each direction
+  ///\return std::size_t the number of stored edges
+  [[nodiscard]] std::size_t number_of_edges() const { return targets_.size(); }
+
+  ///\brief Readonly accessor for the nodes, indexed by local index
+  ///\return std::span<Node const>
+  [[nodiscard]] std::span<Node const> nodes() const { return nodes_; }
+
+  ///\brief Readonly accessor for the row offsets - number_of_nodes() + 1
+  /// entries
+  ///\return std::span<EdgeOffset const>
+  [[nodiscard]] std::span<EdgeOffset const> offsets() const {
+    return offsets_;
+  }
+
+  ///\brief Readonly accessor for the edge targets (local indices)
+  ///\return std::span<LocalIndex const>
+  [[nodiscard]] std::span<LocalIndex const> targets() const {
+    return targets_;
+  }
+
+  ///\brief Readonly accessor for the edge costs - parallel to targets()
+  ///\return std::span<CostType const>
+  [[nodiscard]] std::span<CostType const> costs() const { return costs_; }
+
+  ///\brief Return the Node at a local index
+  ///\param local_index the local index of the Node
+  ///\return Node const&
+  [[nodiscard]] Node const& node(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < nodes_.size());
+    return nodes_[local_index];
+  }
+
+  ///\brief Return the original node id of a local index
+  ///\param local_index the local index of the Node
+  ///\return NodeIndex
+  [[nodiscard]] NodeIndex original_id(LocalIndex local_index) const {
+    return node(local_index).id;
+  }
+
+  ///\brief Find the local index of an original node id
+  ///\param node_index the original id of the Node
+  ///\return LocalIndex the local index or kInvalidLocalIndex if not found
+  [[nodiscard]] LocalIndex find_local(NodeIndex node_index) const {
+    auto id_iterator = std::lower_bound(
+        id_index_.begin(), id_index_.end(), node_index,
+        [](auto const& entry, NodeIndex key) { return entry.first < key; });
+    [[likely]] if (id_iterator != id_index_.end() &&
+                   id_iterator->first == node_index) {
+      return id_iterator->second;
+    }
+    return kInvalidLocalIndex;
+  }
+
+  ///\brief return the number of edges incident to a node
+  ///\param local_index the local index of the Node
+  ///\return std::size_t
+  [[nodiscard]] std::size_t degree(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < nodes_.size());
+    return offsets_[local_index + 1] - offsets_[local_index];
+  }
+
+  ///\brief Return the neighbors (local indices) of a node
+  ///\param local_index the local index of the Node
+  ///\return std::span<LocalIndex const>
+  [[nodiscard]] std::span<LocalIndex const> neighbors(
+      LocalIndex local_index) const {
+    return std::span<LocalIndex const>(targets_).subspan(
+        offsets_[local_index], degree(local_index));
+  }
+
+  ///\brief Return the edge costs of a node - parallel to neighbors()
+  ///\param local_index the local index of the Node
+  ///\return std::span<CostType const>
+  [[nodiscard]] std::span<CostType const> neighbor_costs(
+      LocalIndex local_index) const {
+    return std::span<CostType const>(costs_).subspan(offsets_[local_index],
+                                                     degree(local_index));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// This has the same contract as UndirectedGraph::breadth_first_search:
+  /// the callback is invoked for every newly discovered node, and the search
+  /// terminates early when the callback returns true.  The visited state is
+  /// local to the call, so the graph itself is never modified.  Use the
+  /// overload taking a VisitationContext to avoid the per-call allocation.
+  ///\param start_node_index the original id of the Node to start at
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    VisitationContext context;
+    breadth_first_search(start_node_index, context, std::move(callback));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// reusing a caller supplied visitation context
+  /// Reusing one context per thread avoids allocating the visited state and
+  /// the queue on every search; resetting it is O(1).
+  ///\param start_node_index the original id of the Node to start at
+  ///\param context the visitation context; it is reset by this call
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  If the function returns true, then this algorithm
+  /// is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index, VisitationContext& context,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    auto start_local = find_local(start_node_index);
+    modern_cpp_template_assert_message(start_local != kInvalidLocalIndex,
+                                       "start node is not in the graph");
+    if (start_local == kInvalidLocalIndex) {
+      return;
+    }
+    context.reset(nodes_.size());
+    context.visit(start_local);
+    if (callback != nullptr) {
+      callback(nodes_[start_local]);
+    }
+    context.push(start_local);
+    while (!context.empty()) {
+      for (auto tail_local : neighbors(context.pop())) {
+        if (context.visit(tail_local)) {
+          if (callback != nullptr) {
+            if (callback(nodes_[tail_local])) {
+              return;
+            }
+          }
+          context.push(tail_local);
+        }
+      }
+    }
+  }
+
+ private:
+  std::vector<Node> nodes_{};
+  std::vector<std::pair<NodeIndex, LocalIndex>> id_index_{};
+  std::vector<EdgeOffset> offsets_{0};
+  std::vector<LocalIndex> targets_{};
+  std::vector<CostType> costs_{};
+};
+
+///\brief Freeze an UndirectedGraph into a read-only CsrGraph snapshot
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to freeze
+///\return CsrGraph<NodeValue, CostType>
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+[[nodiscard]] CsrGraph<NodeValue, CostType> freeze(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph) {
+  return CsrGraph<NodeValue, CostType>(graph);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,325 @@
+///\file delta_stepping.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Multi-threaded delta-stepping single-source shortest paths
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+namespace internal {
+
+///\internal Number of frontier vertices a thread claims at a time
+static constexpr std::size_t kDeltaSteppingChunkSize{64};
+
+///\internal Marks "no bucket" - no pending vertex in any bucket
+static constexpr std::size_t kNoBucket{std::numeric_limits<std::size_t>::max()};
+
+///\internal Lower an atomic distance to candidate if candidate is smaller
+///\return true if this call lowered the distance
+template <typename CostType>
+bool atomic_fetch_min(std::atomic<CostType>& distance, CostType candidate) {
+  auto current = distance.load(std::memory_order_relaxed);
+  while (candidate < current) {
+    if (distance.compare_exchange_weak(current, candidate,
+                                       std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+///\internal The buckets a single thread has filled
+/// While bucket c is processed every pending vertex lies in a bucket in
+/// [c, c + max edge cost / delta + 1], so the buckets form a ring indexed by
+/// bucket number modulo its size, which only grows until it spans that
+/// window.  Memory is thus O(max edge cost / delta) buckets per thread, not
+/// O(max distance / delta).
+template <typename Vertex>
+struct DeltaSteppingThreadState {
+  ///\internal a power of two number of buckets; bucket b is in slot
+  /// b & (buckets.size() - 1)
+  std::vector<std::vector<Vertex>> buckets{};
+  ///\internal the number of vertices in all buckets
+  std::size_t pending{0};
+  ///\internal no bucket below this one holds a vertex
+  std::size_t lowest_bucket{kNoBucket};
+  ///\internal vertices removed from the current bucket, for the heavy phase
+  std::vector<Vertex> settled{};
+  ///\internal the current bucket as handed to the other threads; double
+  /// buffered by round so one can be read while the next is filled
+  std::array<std::vector<Vertex>, 2> published{};
+
+  ///\internal Add a vertex to a bucket at or above the current bucket
+  void push(std::size_t bucket, Vertex vertex, std::size_t current) {
+    if (bucket - current >= buckets.size()) {
+      grow(bucket - current + 1, current);
+    }
+    buckets[bucket & (buckets.size() - 1)].push_back(vertex);
+    ++pending;
+    lowest_bucket = std::min(lowest_bucket, bucket);
+  }
+
+  ///\internal Move the contents of the current bucket into out
+  void take(std::size_t current, std::vector<Vertex>& out) {
+    out.clear();
+    if (buckets.empty()) {
+      return;
+    }
+    out.swap(buckets[current & (buckets.size() - 1)]);
+    pending -= out.size();
+  }
+
+  ///\internal return the lowest non-empty bucket above current or kNoBucket
+  std::size_t next_bucket(std::size_t current) {
+    if (pending == 0) {
+      lowest_bucket = kNoBucket;
+      return lowest_bucket;
+    }
+    auto bucket = lowest_bucket == kNoBucket
+                      ? current + 1
+                      : std::max(lowest_bucket, current + 1);
+    auto const mask = buckets.size() - 1;
+    while (buckets[bucket & mask].empty()) {
+      ++bucket;
+    }
+    lowest_bucket = bucket;
+    return lowest_bucket;
+  }
+
+ private:
+  ///\internal Resize the ring to hold at least span buckets from current on
+  void grow(std::size_t span, std::size_t current) {
+    std::vector<std::vector<Vertex>> grown(std::bit_ceil(span));
+    auto const old_mask = buckets.size() - 1;
+    auto const new_mask = grown.size() - 1;
+    for (std::size_t bucket = current; bucket < current + buckets.size();
+         ++bucket) {
+      grown[bucket & new_mask].swap(buckets[bucket & old_mask]);
+    }
+    buckets.swap(grown);
+  }
+};
+
+}  // namespace internal
+
+///\brief Compute the shortest path distances from one node with
+/// delta-stepping
+/// Vertices are kept in buckets of width delta by tentative distance.  The
+/// lowest non-empty bucket is processed in parallel: its vertices relax their
+/// light edges (cost <= delta), which may refill the same bucket, until it
+/// stays empty; then the vertices removed from it relax their heavy edges
+/// once.  See Meyer and Sanders, "Delta-stepping: a parallelizable shortest
+/// path algorithm" (2003).
+///
+/// Each thread keeps its own buckets and hands its share of the current
+/// bucket to the others at each barrier, and distances are lowered with an
+/// atomic compare-and-swap, so no locks are taken.
+///
+/// delta trades work for parallelism: a delta below the smallest edge cost
+/// degenerates into Dijkstra with one round per distinct distance, a delta
+/// above the largest distance into parallel Bellman-Ford.  The maximum edge
+/// cost divided by the average degree is a good first guess.
+///\tparam Graph UndirectedGraph or CsrGraph; CsrGraph is much faster
+///\param graph the graph to search; edge costs must be non-negative
+///\param source the id of the start node; a removed node reaches nothing
+///\param delta the bucket width; must be positive
+///\param pool the worker threads to run on
+///\return std::vector<CostType> the distance of every vertex, indexed by
+/// GraphTraits<Graph>::Vertex, or ShortestPathTree<Graph>::kUnreachable
+template <typename Graph>
+[[nodiscard]] std::vector<typename GraphTraits<Graph>::CostType>
+delta_stepping_shortest_paths(Graph const& graph,
+                              typename GraphTraits<Graph>::NodeIndex source,
+                              typename GraphTraits<Graph>::CostType delta,
+                              WorkerPool& pool) {
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+  using ThreadState = internal::DeltaSteppingThreadState<Vertex>;
+  constexpr auto kUnreachable = ShortestPathTree<Graph>::kUnreachable;
+  modern_cpp_template_assert_message(CostType{0} < delta,
+                                     "delta must be positive");
+
+  auto const number_of_nodes = Traits::number_of_nodes(graph);
+  auto source_vertex = Traits::vertex(graph, source);
+  if (is_removed_vertex(graph, source_vertex)) {
+    return std::vector<CostType>(number_of_nodes, kUnreachable);
+  }
+  auto bucket_of = [delta](CostType distance) {
+    return static_cast<std::size_t>(distance / delta);
+  };
+
+  std::vector<std::atomic<CostType>> distances(number_of_nodes);
+  // stamps that keep a vertex from being expanded twice by the same light
+  // round, or from relaxing its heavy edges twice for the same bucket
+  std::vector<std::atomic<std::size_t>> light_rounds(number_of_nodes);
+  std::vector<std::atomic<std::size_t>> heavy_buckets(number_of_nodes);
+  for (std::size_t vertex = 0; vertex < number_of_nodes; ++vertex) {
+    distances[vertex].store(kUnreachable, std::memory_order_relaxed);
+    light_rounds[vertex].store(internal::kNoBucket, std::memory_order_relaxed);
+    heavy_buckets[vertex].store(internal::kNoBucket,
+                                std::memory_order_relaxed);
+  }
+  distances[static_cast<std::size_t>(source_vertex)].store(
+      CostType{0}, std::memory_order_relaxed);
+
+  std::vector<ThreadState> states(pool.size());
+  states[0].push(0, source_vertex, 0);
+
+  // Every barrier completion moves the state machine forward, and every
+  // thread then runs the step of the new phase:
+  //   kLight - expand the published frontier along light edges, then publish
+  //            its own entries of the current bucket as the next frontier.
+  //            Starts with an empty frontier to gather a new bucket.
+  //   kHeavy - relax heavy edges of the settled vertices, find next bucket
+  // The frontier is the concatenation of every thread's published[round % 2]
+  // buffer; threads fill published[(round + 1) % 2] meanwhile.
+  enum class Phase { kLight, kHeavy, kDone };
+  Phase phase{Phase::kLight};
+  std::size_t current_bucket{0};
+  std::size_t round{0};
+  std::vector<std::size_t> segment_offsets(states.size() + 1, 0);
+  std::atomic<std::size_t> frontier_cursor{0};
+  BarrierJobException job_exception;
+
+  auto for_each_frontier_vertex = [&](std::size_t begin, std::size_t end,
+                                      auto&& function) {
+    auto segment = static_cast<std::size_t>(
+        std::upper_bound(segment_offsets.begin(), segment_offsets.end(),
+                         begin) -
+        segment_offsets.begin() - 1);
+    for (auto position = begin; position < end; ++position) {
+      while (position >= segment_offsets[segment + 1]) {
+        ++segment;
+      }
+      function(states[segment].published[round % 2]
+                                        [position - segment_offsets[segment]]);
+    }
+  };
+
+  auto relax = [&](ThreadState& state, Vertex vertex, bool is_light) {
+    auto vertex_distance = distances[static_cast<std::size_t>(vertex)].load(
+        std::memory_order_relaxed);
+    Traits::for_each_neighbor(
+        graph, vertex, [&](Vertex neighbor, CostType cost) {
+          modern_cpp_template_assert_message(!(cost < CostType{0}),
+                                             "edge costs must be non-negative");
+          if (is_light == (delta < cost)) {
+            return;
+          }
+          CostType candidate = vertex_distance + cost;
+          if (internal::atomic_fetch_min(
+                  distances[static_cast<std::size_t>(neighbor)], candidate)) {
+            state.push(bucket_of(candidate), neighbor, current_bucket);
+          }
+        });
+  };
+
+  auto expand = [&](ThreadState& state, Vertex vertex) {
+    auto index = static_cast<std::size_t>(vertex);
+    // skip copies left behind by a later improvement and duplicates
+    if (bucket_of(distances[index].load(std::memory_order_relaxed)) !=
+            current_bucket ||
+        light_rounds[index].exchange(round, std::memory_order_relaxed) ==
+            round) {
+      return;
+    }
+    if (heavy_buckets[index].exchange(current_bucket,
+                                      std::memory_order_relaxed) !=
+        current_bucket) {
+      state.settled.push_back(vertex);
+    }
+    relax(state, vertex, true);
+  };
+
+  std::barrier phase_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        if (job_exception.has_exception()) {
+          phase = Phase::kDone;
+        }
+        switch (phase) {
+          case Phase::kLight:
+            ++round;
+            for (std::size_t thread = 0; thread < states.size(); ++thread) {
+              segment_offsets[thread + 1] =
+                  segment_offsets[thread] +
+                  states[thread].published[round % 2].size();
+            }
+            frontier_cursor.store(0, std::memory_order_relaxed);
+            if (segment_offsets.back() == 0) {
+              phase = Phase::kHeavy;
+            }
+            break;
+          case Phase::kHeavy:
+            current_bucket = internal::kNoBucket;
+            for (auto const& state : states) {
+              current_bucket = std::min(current_bucket, state.lowest_bucket);
+            }
+            std::fill(segment_offsets.begin(), segment_offsets.end(), 0);
+            phase = current_bucket == internal::kNoBucket ? Phase::kDone
+                                                          : Phase::kLight;
+            break;
+          case Phase::kDone:
+            break;
+        }
+      });
+
+  pool.run([&](std::size_t thread_index) {
+    auto& state = states[thread_index];
+    while (phase != Phase::kDone) {
+      // an exception must not keep this thread from the barrier
+      job_exception.capture([&] {
+        if (phase == Phase::kLight) {
+          auto const frontier_size = segment_offsets.back();
+          while (true) {
+            auto begin = frontier_cursor.fetch_add(
+                internal::kDeltaSteppingChunkSize, std::memory_order_relaxed);
+            if (begin >= frontier_size) {
+              break;
+            }
+            auto end = std::min(begin + internal::kDeltaSteppingChunkSize,
+                                frontier_size);
+            for_each_frontier_vertex(
+                begin, end, [&](Vertex vertex) { expand(state, vertex); });
+          }
+          state.take(current_bucket, state.published[(round + 1) % 2]);
+        } else {
+          for (auto vertex : state.settled) {
+            relax(state, vertex, false);
+          }
+          state.settled.clear();
+          state.next_bucket(current_bucket);
+        }
+      });
+      phase_barrier.arrive_and_wait();
+    }
+  });
+  job_exception.rethrow_if_any();
+
+  std::vector<CostType> result(number_of_nodes);
+  for (std::size_t vertex = 0; vertex < number_of_nodes; ++vertex) {
+    result[vertex] = distances[vertex].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
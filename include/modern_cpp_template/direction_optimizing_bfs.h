@@ -0,0 +1,232 @@
+///\file direction_optimizing_bfs.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Direction-optimizing (top-down / bottom-up) breadth first search over
+/// a CsrGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "modern_cpp_template/bitmap.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The direction a single BFS level was expanded in
+enum class BfsDirection : uint8_t { kTopDown, kBottomUp };
+
+///\brief Tuning parameters for the direction switch heuristic
+/// See Beamer, Asanovic and Patterson, "Direction-Optimizing Breadth-First
+/// Search" (SC 2012).  The defaults are the values recommended there.
+struct DirectionOptimizingParameters {
+  ///\brief Switch to bottom-up once the edges to check from the frontier
+  /// exceed (edges to check from unexplored nodes) / alpha.  An alpha of zero
+  /// (or less) disables bottom-up steps entirely.
+  double alpha{15.0};
+  ///\brief Switch back to top-down once the frontier holds fewer than
+  /// (number of nodes) / beta nodes and is shrinking
+  double beta{18.0};
+};
+
+///\brief Decide whether a top-down search should switch to bottom-up
+///\param frontier_edges the number of edges incident to the next frontier
+///\param unexplored_edges the number of edges incident to unexplored nodes
+///\param parameters the tuning parameters
+///\return true if the next level should be expanded bottom-up
+[[nodiscard]] inline bool should_switch_to_bottom_up(
+    std::size_t frontier_edges, std::size_t unexplored_edges,
+    DirectionOptimizingParameters const& parameters) {
+  if (parameters.alpha <= 0.0) {
+    return false;
+  }
+  return static_cast<double>(frontier_edges) >
+         static_cast<double>(unexplored_edges) / parameters.alpha;
+}
+
+///\brief Decide whether a bottom-up search should switch back to top-down
+///\param frontier_nodes the number of nodes in the next frontier
+///\param previous_frontier_nodes the number of nodes in the current frontier
+///\param number_of_nodes the number of nodes in the graph
+///\param parameters the tuning parameters
+///\return true if the next level should be expanded top-down
+[[nodiscard]] inline bool should_switch_to_top_down(
+    std::size_t frontier_nodes, std::size_t previous_frontier_nodes,
+    std::size_t number_of_nodes,
+    DirectionOptimizingParameters const& parameters) {
+  return frontier_nodes < previous_frontier_nodes &&
+         static_cast<double>(frontier_nodes) <
+             static_cast<double>(number_of_nodes) / parameters.beta;
+}
+
+///\brief The result of a direction-optimizing BFS, indexed by local index
+///\tparam LocalIndex the local index type of the searched graph
+template <typename LocalIndex>
+struct BreadthFirstSearchTree {
+  ///\brief Level assigned to nodes that were not reached
+  static constexpr int64_t kUnreachedLevel{-1};
+
+  ///\brief Hop distance from the start node or kUnreachedLevel
+  std::vector<int64_t> levels{};
+  ///\brief BFS tree parent; the start node is its own parent.  Unreached
+  /// nodes hold CsrGraph::kInvalidLocalIndex
+  std::vector<LocalIndex> parents{};
+  ///\brief The direction each level was expanded in
+  std::vector<BfsDirection> level_directions{};
+};
+
+namespace internal {
+
+///\internal Expand the frontier queue top-down
+///\return the number of edges incident to the new frontier
+template <typename Graph, typename Tree>
+std::size_t top_down_step(Graph const& graph, Tree& tree,
+                          std::vector<typename Graph::LocalIndex> const& queue,
+                          std::vector<typename Graph::LocalIndex>& next_queue,
+                          int64_t next_level) {
+  std::size_t frontier_edges{0};
+  for (auto node : queue) {
+    for (auto neighbor : graph.neighbors(node)) {
+      if (tree.parents[neighbor] == Graph::kInvalidLocalIndex) {
+        tree.parents[neighbor] = node;
+        tree.levels[neighbor] = next_level;
+        frontier_edges += graph.degree(neighbor);
+        next_queue.push_back(neighbor);
+      }
+    }
+  }
+  return frontier_edges;
+}
+
+///\internal Expand the frontier bitmap bottom-up: every unvisited node looks
+/// for any parent in the current frontier and stops at the first one found
+///\param frontier_edges set to the number of edges incident to the new
+/// frontier
+///\return the number of nodes in the new frontier
+template <typename Graph, typename Tree>
+std::size_t bottom_up_step(Graph const& graph, Tree& tree,
+                           Bitmap const& frontier, Bitmap& next_frontier,
+                           int64_t next_level, std::size_t& frontier_edges) {
+  std::size_t frontier_nodes{0};
+  frontier_edges = 0;
+  next_frontier.clear();
+  auto const number_of_nodes = graph.number_of_nodes();
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    if (tree.parents[node] != Graph::kInvalidLocalIndex) {
+      continue;
+    }
+    auto local = static_cast<typename Graph::LocalIndex>(node);
+    for (auto neighbor : graph.neighbors(local)) {
+      if (frontier.test(neighbor)) {
+        tree.parents[node] = neighbor;
+        tree.levels[node] = next_level;
+        next_frontier.set(node);
+        ++frontier_nodes;
+        frontier_edges += graph.degree(local);
+        break;
+      }
+    }
+  }
+  return frontier_nodes;
+}
+
+}  // namespace internal
+
+///\brief Direction-optimizing breadth first search
+/// Levels with a small frontier are expanded top-down from a queue, exactly
+/// like the classic BFS.  When the frontier becomes large relative to the
+/// unexplored part of the graph, the search switches to bottom-up: every
+/// unvisited node scans its own neighbors for a parent in the frontier bitmap
+/// and stops at the first hit, which skips most edges of the middle levels of
+/// low-diameter graphs.  The levels are identical to a classic BFS; the
+/// parents may differ but always form a valid BFS tree.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to search
+///\param start_node_index the original id of the Node to start at
+///\param parameters the direction switch tuning parameters
+///\return BreadthFirstSearchTree indexed by local index
+template <typename NodeValue, typename CostType>
+[[nodiscard]] BreadthFirstSearchTree<
+    typename CsrGraph<NodeValue, CostType>::LocalIndex>
+direction_optimizing_breadth_first_search(
+    CsrGraph<NodeValue, CostType> const& graph,
+    typename CsrGraph<NodeValue, CostType>::NodeIndex start_node_index,
+    DirectionOptimizingParameters const& parameters = {}) {
+  using Graph = CsrGraph<NodeValue, CostType>;
+  using LocalIndex = typename Graph::LocalIndex;
+  using Tree = BreadthFirstSearchTree<LocalIndex>;
+
+  auto const number_of_nodes = graph.number_of_nodes();
+  Tree tree;
+  tree.levels.assign(number_of_nodes, Tree::kUnreachedLevel);
+  tree.parents.assign(number_of_nodes, Graph::kInvalidLocalIndex);
+
+  auto start_local = graph.find_local(start_node_index);
+  modern_cpp_template_assert_message(start_local != Graph::kInvalidLocalIndex,
+                                     "start node is not in the graph");
+  if (start_local == Graph::kInvalidLocalIndex) {
+    return tree;
+  }
+  tree.parents[start_local] = start_local;
+  tree.levels[start_local] = 0;
+
+  std::vector<LocalIndex> queue{start_local};
+  std::vector<LocalIndex> next_queue;
+  Bitmap frontier(number_of_nodes);
+  Bitmap next_frontier(number_of_nodes);
+
+  // both counters are kept exact in either direction: every newly reached
+  // node moves its edges from the unexplored count to the frontier count
+  std::size_t frontier_edges = graph.degree(start_local);
+  std::size_t unexplored_edges = graph.number_of_edges() - frontier_edges;
+  int64_t level{0};
+  while (!queue.empty()) {
+    if (should_switch_to_bottom_up(frontier_edges, unexplored_edges,
+                                   parameters)) {
+      frontier.clear();
+      for (auto node : queue) {
+        frontier.set(node);
+      }
+      std::size_t frontier_nodes = queue.size();
+      std::size_t previous_frontier_nodes{0};
+      do {
+        previous_frontier_nodes = frontier_nodes;
+        ++level;
+        frontier_nodes = internal::bottom_up_step(
+            graph, tree, frontier, next_frontier, level, frontier_edges);
+        unexplored_edges -= frontier_edges;
+        tree.level_directions.push_back(BfsDirection::kBottomUp);
+        swap(frontier, next_frontier);
+      } while (frontier_nodes != 0 &&
+               !should_switch_to_top_down(frontier_nodes,
+                                          previous_frontier_nodes,
+                                          number_of_nodes, parameters));
+      queue.clear();
+      frontier.for_each_set_bit([&queue](std::size_t node) {
+        queue.push_back(static_cast<LocalIndex>(node));
+      });
+    } else {
+      next_queue.clear();
+      ++level;
+      frontier_edges =
+          internal::top_down_step(graph, tree, queue, next_queue, level);
+      unexplored_edges -= frontier_edges;
+      tree.level_directions.push_back(BfsDirection::kTopDown);
+      queue.swap(next_queue);
+    }
+  }
+  // the last expanded level never discovers anything
+  if (!tree.level_directions.empty()) {
+    tree.level_directions.pop_back();
+  }
+  return tree;
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,264 @@
+///\file edge_list.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Bulk construction of graphs from an edge list
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gsl/gsl>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief One undirected edge of an edge list
+///\tparam CostType_T The type of the cost of an Edge
+template <typename CostType_T>
+struct EdgeListEntry {
+  using CostType = CostType_T;
+  using NodeIndex = gsl::index;
+
+  ///\brief the id of the Node on one end of the edge
+  NodeIndex head{0};
+  ///\brief the id of the Node on the other end of the edge
+  NodeIndex tail{0};
+  ///\brief the cost of the edge
+  CostType cost{0};
+};
+
+namespace internal {
+
+///\internal The most slices an edge list is cut into, whatever the size of
+/// the pool.  Every slice keeps a row position per node, so the cap bounds the
+/// transient memory to kMaxEdgeSlices arrays of node count entries.
+inline constexpr std::size_t kMaxEdgeSlices{8};
+
+///\internal Where every slice of an edge list goes in each row
+/// The edges are cut into min(pool size, kMaxEdgeSlices) contiguous slices by
+/// partition_range, and thread t owns slice t; the other threads idle while
+/// counting and scattering.  row_positions[t][v] is the position in the
+/// adjacency of node v at which the entries contributed by slice t start,
+/// i.e. the number of entries of v in the slices before t; degrees[v] counts
+/// both directions of every edge.
+struct EdgeSlices {
+  std::vector<std::vector<std::size_t>> row_positions{};
+  std::vector<std::size_t> degrees{};
+};
+
+///\internal Count the adjacency entries of every slice of an edge list and
+/// turn the counts into the row positions of each slice.  Every slice is
+/// counted into its own array, then each thread sums a range of node ids
+/// across the slices, so neither pass needs atomics.
+template <typename CostType>
+[[nodiscard]] EdgeSlices slice_edges(
+    std::span<EdgeListEntry<CostType> const> edges,
+    std::size_t number_of_nodes, WorkerPool& pool) {
+  EdgeSlices slices;
+  auto const number_of_slices = std::min(pool.size(), kMaxEdgeSlices);
+  slices.row_positions.resize(number_of_slices);
+  slices.degrees.resize(number_of_nodes);
+  pool.run([&](std::size_t thread_index) {
+    if (thread_index >= number_of_slices) {
+      return;
+    }
+    auto& counts = slices.row_positions[thread_index];
+    counts.assign(number_of_nodes, 0);
+    auto [begin, end] =
+        partition_range(edges.size(), thread_index, number_of_slices);
+    for (auto edge = begin; edge < end; ++edge) {
+      auto head = static_cast<std::size_t>(edges[edge].head);
+      auto tail = static_cast<std::size_t>(edges[edge].tail);
+      modern_cpp_template_assert_message(
+          head < number_of_nodes && tail < number_of_nodes,
+          "edge node ids must be in [0, number of node values)");
+      ++counts[head];
+      ++counts[tail];
+    }
+  });
+  pool.run([&](std::size_t thread_index) {
+    auto [first_node, last_node] =
+        partition_range(number_of_nodes, thread_index, pool.size());
+    for (auto node = first_node; node < last_node; ++node) {
+      std::size_t position{0};
+      for (auto& counts : slices.row_positions) {
+        position += std::exchange(counts[node], position);
+      }
+      slices.degrees[node] = position;
+    }
+  });
+  return slices;
+}
+
+///\internal Write every edge into the adjacency of both of its ends, in edge
+/// list order.  Each slice is read by one thread, which writes from the row
+/// positions of that slice, so the threads write disjoint entries and the
+/// result is identical to a sequential scatter.
+///\param write called as write(node, position, neighbor, cost) for every
+/// adjacency entry, where position is the index within the row of node
+template <typename CostType, typename Function>
+void scatter_edges(std::span<EdgeListEntry<CostType> const> edges,
+                   EdgeSlices& slices, WorkerPool& pool,
+                   Function const& write) {
+  auto const number_of_slices = slices.row_positions.size();
+  pool.run([&](std::size_t thread_index) {
+    if (thread_index >= number_of_slices) {
+      return;
+    }
+    auto& positions = slices.row_positions[thread_index];
+    auto [begin, end] =
+        partition_range(edges.size(), thread_index, number_of_slices);
+    for (auto edge = begin; edge < end; ++edge) {
+      auto const& entry = edges[edge];
+      write(entry.head, positions[static_cast<std::size_t>(entry.head)]++,
+            entry.tail, entry.cost);
+      write(entry.tail, positions[static_cast<std::size_t>(entry.tail)]++,
+            entry.head, entry.cost);
+    }
+  });
+}
+
+}  // namespace internal
+
+///\brief Build an UndirectedGraph from an edge list in one pass per phase
+/// Produces the same graph as calling add_edge for every edge in order, but
+/// - every node is hashed into the node and adjacency maps exactly once,
+///   instead of four hash map operations per edge
+/// - every adjacency list is allocated exactly once, at its final size
+/// - node values are moved into place rather than copied per edge
+/// Degree counting and the edge scatter run on the threads of the pool.
+///
+/// Node ids are the positions in node_values, so the graph has exactly
+/// node_values.size() nodes with dense ids - including nodes without edges,
+/// which add_edge cannot create.
+///\tparam Map The map type of the graph
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\tparam Allocator The allocator of the graph containers
+///\param edges the edges; head and tail must be in [0, node_values.size())
+///\param node_values the value of every node, indexed by node id
+///\param pool the worker threads to run on
+///\param allocator the allocator of the graph containers
+///\return UndirectedGraph<NodeValue, CostType, Allocator, Map>
+template <template <typename, typename, typename> class Map = UnorderedNodeMap,
+          typename NodeValue, typename CostType,
+          typename Allocator = std::allocator<std::byte>>
+[[nodiscard]] UndirectedGraph<NodeValue, CostType, Allocator, Map>
+build_undirected_graph(std::span<EdgeListEntry<CostType> const> edges,
+                       std::vector<NodeValue> node_values, WorkerPool& pool,
+                       Allocator const& allocator = Allocator()) {
+  using Graph = UndirectedGraph<NodeValue, CostType, Allocator, Map>;
+  using Node = typename Graph::Node;
+  using NodeIndex = typename Graph::NodeIndex;
+  using EdgeList = typename Graph::EdgeList;
+
+  auto const number_of_nodes = node_values.size();
+  auto slices = internal::slice_edges(edges, number_of_nodes, pool);
+
+  Graph graph(allocator);
+  graph.node_map().reserve(number_of_nodes);
+  graph.adjacency_map().reserve(number_of_nodes);
+  std::vector<EdgeList*> adjacency_lists(number_of_nodes);
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    auto id = static_cast<NodeIndex>(node);
+    graph.node_map().emplace(id, Node{false, id, std::move(node_values[node])});
+    auto& edge_list = graph.adjacency_map()[id];
+    edge_list.resize(slices.degrees[node]);
+    adjacency_lists[node] = &edge_list;
+  }
+
+  internal::scatter_edges(
+      edges, slices, pool,
+      [&](NodeIndex node, std::size_t position, NodeIndex neighbor,
+          CostType cost) {
+        (*adjacency_lists[static_cast<std::size_t>(node)])[position] =
+            typename Graph::Edge_T{node, neighbor, cost};
+      });
+  return graph;
+}
+
+///\brief Build an UndirectedGraph from an edge list on the calling thread
+///\see build_undirected_graph(edges, node_values, pool)
+template <template <typename, typename, typename> class Map = UnorderedNodeMap,
+          typename NodeValue, typename CostType>
+[[nodiscard]] UndirectedGraph<NodeValue, CostType, std::allocator<std::byte>,
+                              Map>
+build_undirected_graph(std::span<EdgeListEntry<CostType> const> edges,
+                       std::vector<NodeValue> node_values) {
+  WorkerPool pool(1);
+  return build_undirected_graph<Map>(edges, std::move(node_values), pool);
+}
+
+///\brief Build a CsrGraph directly from an edge list
+/// Skips the UndirectedGraph entirely: the degrees become the row offsets and
+/// the edges are scattered straight into the target and cost arrays.  The
+/// result is identical to freeze(build_undirected_graph(edges, node_values)).
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param edges the edges; head and tail must be in [0, node_values.size())
+///\param node_values the value of every node, indexed by node id
+///\param pool the worker threads to run on
+///\return CsrGraph<NodeValue, CostType>
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CsrGraph<NodeValue, CostType> build_csr_graph(
+    std::span<EdgeListEntry<CostType> const> edges,
+    std::vector<NodeValue> node_values, WorkerPool& pool) {
+  using Graph = CsrGraph<NodeValue, CostType>;
+  using Node = typename Graph::Node;
+  using NodeIndex = typename Graph::NodeIndex;
+  using LocalIndex = typename Graph::LocalIndex;
+  using EdgeOffset = typename Graph::EdgeOffset;
+
+  auto const number_of_nodes = node_values.size();
+  modern_cpp_template_assert_message(
+      number_of_nodes < static_cast<std::size_t>(Graph::kInvalidLocalIndex),
+      "too many nodes for a 32-bit local index");
+  auto slices = internal::slice_edges(edges, number_of_nodes, pool);
+
+  std::vector<Node> nodes;
+  nodes.reserve(number_of_nodes);
+  std::vector<EdgeOffset> offsets(number_of_nodes + 1, 0);
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    nodes.push_back(Node{false, static_cast<NodeIndex>(node),
+                         std::move(node_values[node])});
+    offsets[node + 1] = offsets[node] + slices.degrees[node];
+  }
+
+  std::vector<LocalIndex> targets(offsets.back());
+  std::vector<CostType> costs(offsets.back());
+  internal::scatter_edges(
+      edges, slices, pool,
+      [&](NodeIndex node, std::size_t position, NodeIndex neighbor,
+          CostType cost) {
+        auto entry = offsets[static_cast<std::size_t>(node)] + position;
+        targets[entry] = static_cast<LocalIndex>(neighbor);
+        costs[entry] = cost;
+      });
+  return Graph(std::move(nodes), std::move(offsets), std::move(targets),
+               std::move(costs));
+}
+
+///\brief Build a CsrGraph from an edge list on the calling thread
+///\see build_csr_graph(edges, node_values, pool)
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CsrGraph<NodeValue, CostType> build_csr_graph(
+    std::span<EdgeListEntry<CostType> const> edges,
+    std::vector<NodeValue> node_values) {
+  WorkerPool pool(1);
+  return build_csr_graph(edges, std::move(node_values), pool);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
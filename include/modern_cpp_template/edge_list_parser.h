@@ -0,0 +1,444 @@
+///\file edge_list_parser.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Streaming parsers for text edge lists, CSV and Matrix Market
+/// coordinate files
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The text formats understood by parse_edge_list
+enum class EdgeListFormat {
+  ///\brief "head tail [cost]" per line, separated by spaces or tabs;
+  /// lines starting with '#' or '%' are comments
+  kWhitespace,
+  ///\brief "head,tail[,cost]" per line; lines starting with '#' are comments
+  kCsv,
+  ///\brief Matrix Market coordinate format: a "%%MatrixMarket matrix
+  /// coordinate" banner, '%' comments, a "rows columns entries" size line and
+  /// then one-based "row column [value]" entries
+  kMatrixMarket,
+};
+
+///\brief Options for parse_edge_list
+///\tparam CostType The type of the cost of an Edge
+template <typename CostType>
+struct EdgeListParseOptions {
+  ///\brief the format of the input
+  EdgeListFormat format{EdgeListFormat::kWhitespace};
+  ///\brief the cost of edges without a cost column
+  CostType default_cost{1};
+  ///\brief how many bytes are read and parsed at a time.  A line longer than
+  /// this grows the buffer.
+  std::size_t chunk_size{std::size_t{16} << 20U};
+};
+
+///\brief An edge list read completely into memory
+///\tparam CostType The type of the cost of an Edge
+template <typename CostType>
+struct ParsedEdgeList {
+  ///\brief the edges in file order
+  std::vector<EdgeListEntry<CostType>> edges{};
+  ///\brief one more than the largest node id, or the matrix dimension of a
+  /// Matrix Market file if that is larger
+  std::size_t number_of_nodes{0};
+};
+
+namespace internal {
+
+///\internal The outcome of parsing one line
+enum class LineStatus { kEdge, kSkipped, kMalformed };
+
+///\internal Parses single lines of one format.  The hot loop is a handful of
+/// pointer comparisons and std::from_chars calls; no allocation, no locale.
+template <typename CostType>
+class EdgeLineParser {
+ public:
+  using Entry = EdgeListEntry<CostType>;
+
+  EdgeLineParser(EdgeListFormat format, CostType default_cost)
+      : separator_(format == EdgeListFormat::kCsv ? ',' : '\0'),
+        id_base_(format == EdgeListFormat::kMatrixMarket ? 1 : 0),
+        default_cost_(default_cost) {}
+
+  ///\internal Parse the line [first, last) - without its '\n'
+  [[nodiscard]] LineStatus parse(char const* first, char const* last,
+                                 Entry& entry) const {
+    // tolerate CRLF line endings and trailing blanks
+    while (last != first && is_blank(*(last - 1))) {
+      --last;
+    }
+    first = skip_blanks(first, last);
+    if (first == last || *first == '#' || *first == '%') {
+      return LineStatus::kSkipped;
+    }
+    if (!parse_id(first, last, entry.head) ||
+        !skip_separator(first, last) ||
+        !parse_id(first, last, entry.tail)) {
+      return LineStatus::kMalformed;
+    }
+    if (first == last) {
+      entry.cost = default_cost_;
+      return LineStatus::kEdge;
+    }
+    if (!skip_separator(first, last)) {
+      return LineStatus::kMalformed;
+    }
+    auto [end, error] = std::from_chars(first, last, entry.cost);
+    if (error != std::errc{} || end != last) {
+      return LineStatus::kMalformed;
+    }
+    return LineStatus::kEdge;
+  }
+
+ private:
+  [[nodiscard]] static bool is_blank(char character) {
+    return character == ' ' || character == '\t' || character == '\r';
+  }
+
+  [[nodiscard]] static char const* skip_blanks(char const* first,
+                                               char const* last) {
+    while (first != last && is_blank(*first)) {
+      ++first;
+    }
+    return first;
+  }
+
+  [[nodiscard]] bool parse_id(char const*& first, char const* last,
+                              gsl::index& id) const {
+    auto [end, error] = std::from_chars(first, last, id);
+    if (error != std::errc{} || id < id_base_) {
+      return false;
+    }
+    id -= id_base_;
+    first = end;
+    return true;
+  }
+
+  ///\internal Consume the separator between two fields - at least one blank,
+  /// or a comma with optional blanks around it
+  [[nodiscard]] bool skip_separator(char const*& first,
+                                    char const* last) const {
+    auto const* after_blanks = skip_blanks(first, last);
+    if (separator_ != '\0') {
+      if (after_blanks == last || *after_blanks != separator_) {
+        return false;
+      }
+      after_blanks = skip_blanks(after_blanks + 1, last);
+    } else if (after_blanks == first) {
+      return false;
+    }
+    first = after_blanks;
+    return first != last;
+  }
+
+  char separator_;
+  gsl::index id_base_;
+  CostType default_cost_;
+};
+
+///\internal Consumes the Matrix Market banner and size line, which must be
+/// read serially before the entries can be parsed in parallel
+class MatrixMarketHeader {
+ public:
+  ///\internal return true once the size line has been read
+  [[nodiscard]] bool is_complete() const { return state_ == State::kDone; }
+
+  ///\internal return the larger matrix dimension
+  [[nodiscard]] std::size_t dimension() const { return dimension_; }
+
+  ///\internal Consume one header line
+  ///\return false if the line is not a valid header line
+  [[nodiscard]] bool consume(std::string_view line) {
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+      line.remove_suffix(1);
+    }
+    if (state_ == State::kBanner) {
+      state_ = State::kSize;
+      return consume_banner(line);
+    }
+    auto first = line.find_first_not_of(" \t");
+    if (first == std::string_view::npos || line[first] == '%') {
+      return true;
+    }
+    std::size_t rows{0};
+    std::size_t columns{0};
+    std::size_t entries{0};
+    char const* position = line.data() + first;
+    char const* last = line.data() + line.size();
+    for (auto* value : {&rows, &columns, &entries}) {
+      while (position != last && (*position == ' ' || *position == '\t')) {
+        ++position;
+      }
+      auto [end, error] = std::from_chars(position, last, *value);
+      if (error != std::errc{}) {
+        return false;
+      }
+      position = end;
+    }
+    dimension_ = std::max(rows, columns);
+    state_ = State::kDone;
+    return position == last;
+  }
+
+ private:
+  enum class State { kBanner, kSize, kDone };
+
+  [[nodiscard]] bool consume_banner(std::string_view line) {
+    std::vector<std::string> words;
+    std::size_t position{0};
+    while (position < line.size()) {
+      auto begin = line.find_first_not_of(" \t", position);
+      if (begin == std::string_view::npos) {
+        break;
+      }
+      auto end = std::min(line.find_first_of(" \t", begin), line.size());
+      std::string word(line.substr(begin, end - begin));
+      std::transform(word.begin(), word.end(), word.begin(),
+                     [](char character) {
+                       return static_cast<char>(
+                           character >= 'A' && character <= 'Z'
+                               ? character - 'A' + 'a'
+                               : character);
+                     });
+      words.push_back(std::move(word));
+      position = end;
+    }
+    // %%MatrixMarket matrix coordinate <real|integer|pattern> <symmetry>
+    if (words.size() != 5 || words[0] != "%%matrixmarket" ||
+        words[1] != "matrix" || words[2] != "coordinate") {
+      return false;
+    }
+    // pattern entries have no value column and get the default cost
+    return words[3] == "pattern" || words[3] == "real" ||
+           words[3] == "integer";
+  }
+
+  State state_{State::kBanner};
+  std::size_t dimension_{0};
+};
+
+[[noreturn]] inline void throw_parse_error(std::size_t line_number,
+                                           std::string_view line) {
+  throw std::runtime_error("edge list line " + std::to_string(line_number) +
+                           ": cannot parse \"" + std::string(line) + "\"");
+}
+
+}  // namespace internal
+
+///\brief Parse an edge list from a stream without holding the whole text in
+/// memory
+/// The input is read chunk_size bytes at a time.  Every chunk is cut at line
+/// boundaries into one slice per pool thread, the slices are parsed
+/// concurrently, and the parsed edges are handed to consumer slice by slice
+/// in file order.  Only one chunk of text and its parsed edges are alive at
+/// any time, so consumer decides what is kept - typically it appends to the
+/// edge list for build_undirected_graph or build_csr_graph.
+///
+/// Node ids are zero-based for kWhitespace and kCsv and one-based for
+/// kMatrixMarket (they are shifted to zero-based).  A Matrix Market "pattern"
+/// file, like any line without a cost column, gets options.default_cost.  A
+/// Matrix Market "general" matrix that lists both (i, j) and (j, i) yields
+/// two parallel undirected edges.
+///\tparam CostType The type of the cost of an Edge
+///\tparam Consumer callable as consumer(std::span<EdgeListEntry<CostType>
+/// const>)
+///\param input the stream to read; read in binary-safe chunks
+///\param options the format and tuning options
+///\param pool the worker threads to parse on
+///\param consumer receives the parsed edges in file order
+///\return std::size_t one more than the largest node id seen, or the matrix
+/// dimension of a Matrix Market file if that is larger
+///\throw std::runtime_error on a malformed line, naming its line number
+template <typename CostType, typename Consumer>
+std::size_t parse_edge_list(std::istream& input,
+                            EdgeListParseOptions<CostType> const& options,
+                            WorkerPool& pool, Consumer&& consumer) {
+  using Entry = EdgeListEntry<CostType>;
+  modern_cpp_template_assert(options.chunk_size > 0);
+
+  internal::EdgeLineParser<CostType> const parser(options.format,
+                                                  options.default_cost);
+  internal::MatrixMarketHeader header;
+  bool const needs_header = options.format == EdgeListFormat::kMatrixMarket;
+
+  struct Slice {
+    std::vector<Entry> edges{};
+    gsl::index largest_id{-1};
+    char const* error_line{nullptr};
+  };
+  std::vector<Slice> slices(pool.size());
+  std::vector<char> buffer;
+  std::size_t carried_bytes{0};
+  std::size_t lines_before_chunk{1};
+  gsl::index largest_id{-1};
+
+  auto line_number_of = [&](std::span<char const> text, char const* line) {
+    return lines_before_chunk +
+           static_cast<std::size_t>(std::count(text.data(), line, '\n'));
+  };
+  auto line_at = [](char const* line, char const* last) {
+    return std::string_view(line, static_cast<std::size_t>(
+                                      std::find(line, last, '\n') - line));
+  };
+
+  bool at_end{false};
+  while (!at_end) {
+    buffer.resize(carried_bytes + options.chunk_size);
+    input.read(buffer.data() + carried_bytes,
+               static_cast<std::streamsize>(options.chunk_size));
+    auto const filled = carried_bytes + static_cast<std::size_t>(input.gcount());
+    at_end = !input;
+    if (input.bad()) {
+      throw std::runtime_error("edge list: read error");
+    }
+
+    // parse complete lines only; the partial last line moves to the next
+    // chunk unless the input has ended
+    std::size_t complete = filled;
+    if (!at_end) {
+      while (complete != 0 && buffer[complete - 1] != '\n') {
+        --complete;
+      }
+      if (complete == 0) {
+        // a single line longer than the buffer - keep reading into it
+        carried_bytes = filled;
+        continue;
+      }
+    }
+    std::span<char const> text(buffer.data(), complete);
+
+    // the Matrix Market banner and size line are consumed serially
+    char const* body = text.data();
+    char const* const text_end = text.data() + text.size();
+    while (needs_header && !header.is_complete() && body != text_end) {
+      auto line = line_at(body, text_end);
+      if (!header.consume(line)) {
+        internal::throw_parse_error(line_number_of(text, body), line);
+      }
+      body += std::min(line.size() + 1, static_cast<std::size_t>(
+                                            text_end - body));
+    }
+
+    pool.run([&](std::size_t thread_index) {
+      auto& slice = slices[thread_index];
+      slice.edges.clear();
+      slice.error_line = nullptr;
+      auto const body_size = static_cast<std::size_t>(text_end - body);
+      auto [begin, end] =
+          partition_range(body_size, thread_index, pool.size());
+      // a slice starts after the first line break at or past its nominal
+      // start, so every line belongs to exactly one slice
+      auto slice_start = [&](std::size_t offset) {
+        if (offset == 0 || offset >= body_size) {
+          return std::min(offset, body_size);
+        }
+        auto const* line_break = std::find(body + offset - 1, text_end, '\n');
+        return line_break == text_end
+                   ? body_size
+                   : static_cast<std::size_t>(line_break + 1 - body);
+      };
+      char const* line = body + slice_start(begin);
+      char const* const slice_end = body + slice_start(end);
+      Entry entry;
+      while (line < slice_end) {
+        auto const* line_end = std::find(line, slice_end, '\n');
+        auto status = parser.parse(line, line_end, entry);
+        if (status == internal::LineStatus::kEdge) [[likely]] {
+          slice.edges.push_back(entry);
+          slice.largest_id =
+              std::max({slice.largest_id, entry.head, entry.tail});
+        } else if (status == internal::LineStatus::kMalformed) {
+          slice.error_line = line;
+          return;
+        }
+        line = line_end + 1;
+      }
+    });
+
+    for (auto& slice : slices) {
+      if (slice.error_line != nullptr) {
+        internal::throw_parse_error(line_number_of(text, slice.error_line),
+                                    line_at(slice.error_line, text_end));
+      }
+      largest_id = std::max(largest_id, slice.largest_id);
+      consumer(std::span<Entry const>(slice.edges));
+    }
+
+    lines_before_chunk += static_cast<std::size_t>(
+        std::count(text.data(), text_end, '\n'));
+    carried_bytes = filled - complete;
+    std::copy(buffer.data() + complete, buffer.data() + filled,
+              buffer.data());
+  }
+
+  if (needs_header && !header.is_complete()) {
+    throw std::runtime_error("edge list: missing Matrix Market header");
+  }
+  return std::max(static_cast<std::size_t>(largest_id + 1),
+                  header.dimension());
+}
+
+///\brief Read a whole edge list from a stream into memory
+///\see parse_edge_list
+template <typename CostType>
+[[nodiscard]] ParsedEdgeList<CostType> read_edge_list(
+    std::istream& input, EdgeListParseOptions<CostType> const& options,
+    WorkerPool& pool) {
+  ParsedEdgeList<CostType> parsed;
+  parsed.number_of_nodes = parse_edge_list(
+      input, options, pool,
+      [&parsed](std::span<EdgeListEntry<CostType> const> edges) {
+        parsed.edges.insert(parsed.edges.end(), edges.begin(), edges.end());
+      });
+  return parsed;
+}
+
+///\brief Read a whole edge list from a stream on the calling thread
+///\see parse_edge_list
+template <typename CostType>
+[[nodiscard]] ParsedEdgeList<CostType> read_edge_list(
+    std::istream& input, EdgeListParseOptions<CostType> const& options) {
+  WorkerPool pool(1);
+  return read_edge_list(input, options, pool);
+}
+
+///\brief Read a whole edge list file into memory
+///\see parse_edge_list
+///\throw std::runtime_error if the file cannot be opened
+template <typename CostType>
+[[nodiscard]] ParsedEdgeList<CostType> read_edge_list(
+    std::filesystem::path const& path,
+    EdgeListParseOptions<CostType> const& options, WorkerPool& pool) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input) {
+    throw std::runtime_error("edge list " + path.string() +
+                             ": cannot be opened");
+  }
+  return read_edge_list(input, options, pool);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,186 @@
+///\file epoch_reclamation.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Epoch-based reclamation of objects shared with lock-free readers
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+///\brief Defers the deletion of retired objects until no reader can still
+/// hold them
+/// A reader announces the global epoch in its own slot before it loads a
+/// shared pointer (enter) and clears the slot when done (exit); neither
+/// takes a lock.  A writer first publishes the replacement, then retires the
+/// old object, which advances the epoch and tags the object with the new
+/// value.  A reader that could have loaded the old pointer entered before
+/// that advance, so its slot holds a smaller epoch; an object is deleted
+/// once every active slot has caught up with its tag.
+///
+/// The protocol relies on sequentially consistent ordering between the slot
+/// store and the pointer load of the reader, and between the pointer store
+/// and the epoch advance of the writer.
+///
+/// Slots are created on demand, kept on a lock-free list and reused after
+/// their Reader is destroyed.  All Reader objects must be destroyed before
+/// the domain.
+///\tparam T the type of the retired objects
+template <typename T>
+class EpochDomain {
+  static constexpr uint64_t kQuiescent{std::numeric_limits<uint64_t>::max()};
+
+  ///\brief The announced epoch of one reader, on its own cache line
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> epoch{kQuiescent};
+    std::atomic<bool> is_claimed{true};
+    Slot* next{nullptr};
+  };
+
+ public:
+  ///\brief The registration of one reader thread
+  /// Not thread safe itself: every thread uses its own Reader.
+  class Reader {
+   public:
+    ///\brief Construct an unregistered Reader
+    Reader() = default;
+
+    Reader(Reader const&) = delete;
+    Reader& operator=(Reader const&) = delete;
+
+    Reader(Reader&& other) noexcept
+        : domain_(std::exchange(other.domain_, nullptr)),
+          slot_(std::exchange(other.slot_, nullptr)) {}
+
+    Reader& operator=(Reader&& other) noexcept {
+      if (this != &other) {
+        release();
+        domain_ = std::exchange(other.domain_, nullptr);
+        slot_ = std::exchange(other.slot_, nullptr);
+      }
+      return *this;
+    }
+
+    ///\brief Release the slot for reuse by a later Reader
+    ~Reader() { release(); }
+
+    ///\brief Start a read-side critical section
+    /// Shared pointers loaded after this call stay valid until exit().
+    void enter() {
+      modern_cpp_template_assert(slot_ != nullptr);
+      modern_cpp_template_assert_message(
+          slot_->epoch.load(std::memory_order_relaxed) == kQuiescent,
+          "read-side critical sections do not nest");
+      slot_->epoch.store(domain_->epoch_.load(std::memory_order_seq_cst),
+                         std::memory_order_seq_cst);
+    }
+
+    ///\brief End the read-side critical section
+    void exit() { slot_->epoch.store(kQuiescent, std::memory_order_release); }
+
+   private:
+    friend EpochDomain;
+
+    Reader(EpochDomain* domain, Slot* slot) : domain_(domain), slot_(slot) {}
+
+    void release() {
+      if (slot_ != nullptr) {
+        slot_->epoch.store(kQuiescent, std::memory_order_release);
+        slot_->is_claimed.store(false, std::memory_order_release);
+        slot_ = nullptr;
+      }
+    }
+
+    EpochDomain* domain_{nullptr};
+    Slot* slot_{nullptr};
+  };
+
+  EpochDomain() = default;
+  EpochDomain(EpochDomain const&) = delete;
+  EpochDomain(EpochDomain&&) = delete;
+  EpochDomain& operator=(EpochDomain const&) = delete;
+  EpochDomain& operator=(EpochDomain&&) = delete;
+
+  ///\brief Delete the slots and every retired object
+  ~EpochDomain() {
+    auto* slot = slots_.load(std::memory_order_acquire);
+    while (slot != nullptr) {
+      modern_cpp_template_assert_message(
+          !slot->is_claimed.load(std::memory_order_relaxed),
+          "a Reader outlives its EpochDomain");
+      delete std::exchange(slot, slot->next);
+    }
+  }
+
+  ///\brief Register a reader, reusing a released slot when there is one
+  ///\return Reader
+  [[nodiscard]] Reader make_reader() {
+    for (auto* slot = slots_.load(std::memory_order_acquire); slot != nullptr;
+         slot = slot->next) {
+      bool is_claimed{false};
+      if (slot->is_claimed.compare_exchange_strong(
+              is_claimed, true, std::memory_order_acquire)) {
+        return Reader(this, slot);
+      }
+    }
+    auto* slot = new Slot{};
+    slot->next = slots_.load(std::memory_order_relaxed);
+    while (!slots_.compare_exchange_weak(slot->next, slot,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+    return Reader(this, slot);
+  }
+
+  ///\brief Hand over an object that has already been unpublished
+  /// It is deleted by a later reclaim() once no reader can hold it.
+  ///\param object the object; the domain takes ownership
+  void retire(T const* object) {
+    std::lock_guard lock(mutex_);
+    auto const tag = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+    retired_.emplace_back(std::unique_ptr<T const>(object), tag);
+  }
+
+  ///\brief Delete every retired object that no reader can still hold
+  ///\return std::size_t the number of objects still waiting
+  std::size_t reclaim() {
+    std::lock_guard lock(mutex_);
+    auto oldest = kQuiescent;
+    for (auto* slot = slots_.load(std::memory_order_acquire); slot != nullptr;
+         slot = slot->next) {
+      oldest = std::min(oldest, slot->epoch.load(std::memory_order_seq_cst));
+    }
+    std::erase_if(retired_, [oldest](auto const& entry) {
+      return entry.second <= oldest;
+    });
+    return retired_.size();
+  }
+
+  ///\brief return the number of retired objects not yet deleted
+  [[nodiscard]] std::size_t number_of_retired() const {
+    std::lock_guard lock(mutex_);
+    return retired_.size();
+  }
+
+ private:
+  std::atomic<uint64_t> epoch_{1};
+  std::atomic<Slot*> slots_{nullptr};
+  mutable std::mutex mutex_{};
+  std::vector<std::pair<std::unique_ptr<T const>, uint64_t>> retired_{};
+};
+
+}  // namespace modern_cpp_template::algorithms
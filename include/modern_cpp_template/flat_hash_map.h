@@ -0,0 +1,550 @@
+///\file flat_hash_map.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief An open-addressing, Swiss-table style hash map for integral keys
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+namespace internal {
+
+///\internal One group of control bytes.  A control byte is kEmpty, kDeleted,
+/// or - for a full slot - the low 7 bits of the hash of its key (H2).
+struct alignas(16) ControlGroup {
+  static constexpr std::size_t kWidth{16};
+  static constexpr std::int8_t kEmpty{-128};
+  static constexpr std::int8_t kDeleted{-2};
+
+  std::array<std::int8_t, kWidth> bytes{};
+
+  ///\internal return a bit mask of the slots whose control byte is value
+  [[nodiscard]] std::uint32_t match(std::int8_t value) const {
+#if defined(__SSE2__)
+    auto const group = _mm_load_si128(
+        reinterpret_cast<__m128i const*>(bytes.data()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+    std::uint32_t mask{0};
+    for (std::size_t slot = 0; slot < kWidth; ++slot) {
+      mask |= static_cast<std::uint32_t>(bytes[slot] == value) << slot;
+    }
+    return mask;
+#endif
+  }
+
+  ///\internal return a bit mask of the empty or deleted slots - the control
+  /// bytes with the sign bit set
+  [[nodiscard]] std::uint32_t match_free() const {
+#if defined(__SSE2__)
+    auto const group = _mm_load_si128(
+        reinterpret_cast<__m128i const*>(bytes.data()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(group));
+#else
+    std::uint32_t mask{0};
+    for (std::size_t slot = 0; slot < kWidth; ++slot) {
+      mask |= static_cast<std::uint32_t>(bytes[slot] < 0) << slot;
+    }
+    return mask;
+#endif
+  }
+};
+
+///\internal Finalizer of MurmurHash3 - every input bit affects every output
+/// bit, so dense and strided ids spread evenly over the groups
+[[nodiscard]] constexpr std::uint64_t mix_key(std::uint64_t key) {
+  key ^= key >> 33U;
+  key *= 0xff51'afd7'ed55'8ccdULL;
+  key ^= key >> 33U;
+  key *= 0xc4ce'b9fe'1a85'ec53ULL;
+  key ^= key >> 33U;
+  return key;
+}
+
+}  // namespace internal
+
+///\brief An open-addressing hash map for integral keys in the style of the
+/// Swiss tables
+/// Slots live in one flat array next to an array of one control byte per
+/// slot.  A lookup hashes the key once, then scans groups of 16 control bytes
+/// with a single SSE2 compare (a scalar loop without SSE2) against the 7 bit
+/// hash tag, touching a slot only on a tag match - typically one cache line
+/// of control bytes and one of slots, instead of chasing a node pointer per
+/// lookup as std::unordered_map does.  Groups are probed quadratically and
+/// the table grows at 7/8 load.
+///
+/// The interface is the subset of std::unordered_map used by UndirectedGraph
+/// (which accepts this as its Map_T parameter), with one important
+/// difference: inserting may move the elements, so references, pointers and
+/// iterators are invalidated by any insertion that rehashes the table.  After
+/// reserve(n), insertions do not rehash while size() <= n unless elements
+/// were erased - erasing leaves tombstones that are eventually cleaned by
+/// rehashing in place.  Erasing itself never moves other elements.
+///\tparam Key_T an integral key type
+///\tparam Value_T the mapped type
+///\tparam Allocator_T an allocator of std::pair<Key_T const, Value_T>
+template <typename Key_T, typename Value_T,
+          typename Allocator_T =
+              std::allocator<std::pair<Key_T const, Value_T>>>
+class FlatHashMap {
+  static_assert(std::is_integral_v<Key_T>, "FlatHashMap needs integral keys");
+
+  using Group = internal::ControlGroup;
+  using AllocatorTraits = std::allocator_traits<Allocator_T>;
+  using GroupAllocator = typename AllocatorTraits::template rebind_alloc<Group>;
+  using GroupAllocatorTraits = std::allocator_traits<GroupAllocator>;
+
+ public:
+  using key_type = Key_T;
+  using mapped_type = Value_T;
+  using value_type = std::pair<Key_T const, Value_T>;
+  using size_type = std::size_t;
+  using allocator_type =
+      typename AllocatorTraits::template rebind_alloc<value_type>;
+
+ private:
+  using SlotAllocatorTraits = std::allocator_traits<allocator_type>;
+
+  template <bool kIsConst>
+  class Iterator {
+    using Map = std::conditional_t<kIsConst, FlatHashMap const, FlatHashMap>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = FlatHashMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer =
+        std::conditional_t<kIsConst, value_type const*, value_type*>;
+    using reference =
+        std::conditional_t<kIsConst, value_type const&, value_type&>;
+
+    Iterator() = default;
+    Iterator(Map* map, std::size_t slot) : map_(map), slot_(slot) {}
+
+    // a mutable iterator converts to a const one
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    operator Iterator<true>() const { return {map_, slot_}; }
+
+    reference operator*() const { return map_->slots_[slot_]; }
+    pointer operator->() const { return &map_->slots_[slot_]; }
+
+    Iterator& operator++() {
+      slot_ = map_->next_full_slot(slot_ + 1);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    friend bool operator==(Iterator const& lhs, Iterator const& rhs) {
+      return lhs.slot_ == rhs.slot_;
+    }
+
+   private:
+    friend class FlatHashMap;
+    Map* map_{nullptr};
+    std::size_t slot_{0};
+  };
+
+ public:
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  ///\brief Construct an empty map
+  FlatHashMap() = default;
+
+  ///\brief Construct an empty map that allocates through allocator
+  explicit FlatHashMap(allocator_type const& allocator)
+      : allocator_(allocator) {}
+
+  ///\brief Construct an empty map with room for bucket_count elements
+  explicit FlatHashMap(size_type bucket_count,
+                       allocator_type const& allocator = allocator_type())
+      : allocator_(allocator) {
+    reserve(bucket_count);
+  }
+
+  FlatHashMap(FlatHashMap const& other)
+      : allocator_(SlotAllocatorTraits::select_on_container_copy_construction(
+            other.allocator_)) {
+    copy_from(other);
+  }
+
+  FlatHashMap(FlatHashMap&& other) noexcept
+      : allocator_(std::move(other.allocator_)) {
+    steal(other);
+  }
+
+  FlatHashMap& operator=(FlatHashMap const& other) {
+    if (this != &other) {
+      destroy();
+      if constexpr (SlotAllocatorTraits::
+                        propagate_on_container_copy_assignment::value) {
+        allocator_ = other.allocator_;
+      }
+      copy_from(other);
+    }
+    return *this;
+  }
+
+  FlatHashMap& operator=(FlatHashMap&& other) noexcept(
+      SlotAllocatorTraits::propagate_on_container_move_assignment::value ||
+      SlotAllocatorTraits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+    destroy();
+    if constexpr (SlotAllocatorTraits::propagate_on_container_move_assignment::
+                      value) {
+      allocator_ = std::move(other.allocator_);
+      steal(other);
+    } else {
+      if (allocator_ == other.allocator_) {
+        steal(other);
+      } else {
+        // different memory resources - the elements have to be moved one by
+        // one into memory of our own
+        reserve(other.size());
+        for (auto& [key, value] : other) {
+          try_emplace(key, std::move(value));
+        }
+        other.clear();
+      }
+    }
+    return *this;
+  }
+
+  ~FlatHashMap() { destroy(); }
+
+  ///\brief return the allocator
+  [[nodiscard]] allocator_type get_allocator() const { return allocator_; }
+
+  ///\brief return the number of elements
+  [[nodiscard]] size_type size() const { return size_; }
+
+  ///\brief return true if there are no elements
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  ///\brief return the number of slots
+  [[nodiscard]] size_type capacity() const { return capacity_; }
+
+  [[nodiscard]] iterator begin() { return {this, next_full_slot(0)}; }
+  [[nodiscard]] iterator end() { return {this, capacity_}; }
+  [[nodiscard]] const_iterator begin() const {
+    return {this, next_full_slot(0)};
+  }
+  [[nodiscard]] const_iterator end() const { return {this, capacity_}; }
+  [[nodiscard]] const_iterator cbegin() const { return begin(); }
+  [[nodiscard]] const_iterator cend() const { return end(); }
+
+  ///\brief Make room for count elements without growing
+  ///\param count the number of elements
+  void reserve(size_type count) {
+    if (count > max_elements(capacity_)) {
+      rehash_to(capacity_for(count));
+    }
+  }
+
+  ///\brief Remove every element, keeping the slots
+  void clear() {
+    destroy_elements();
+    for (std::size_t group = 0; group < number_of_groups(); ++group) {
+      groups_[group].bytes.fill(Group::kEmpty);
+    }
+    size_ = 0;
+    growth_left_ = max_elements(capacity_);
+  }
+
+  ///\brief Find an element
+  ///\param key the key
+  ///\return iterator to the element, or end()
+  [[nodiscard]] iterator find(key_type key) { return {this, find_slot(key)}; }
+
+  ///\brief Find an element
+  ///\param key the key
+  ///\return const_iterator to the element, or end()
+  [[nodiscard]] const_iterator find(key_type key) const {
+    return {this, find_slot(key)};
+  }
+
+  ///\brief return true if the map holds key
+  [[nodiscard]] bool contains(key_type key) const {
+    return find_slot(key) != capacity_;
+  }
+
+  ///\brief return 1 if the map holds key, 0 otherwise
+  [[nodiscard]] size_type count(key_type key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  ///\brief Insert an element constructed from arguments if key is absent
+  ///\return the element and true if it was inserted
+  template <typename... Arguments>
+  std::pair<iterator, bool> try_emplace(key_type key,
+                                        Arguments&&... arguments) {
+    auto const hash = internal::mix_key(static_cast<std::uint64_t>(key));
+    if (auto slot = find_slot(key, hash); slot != capacity_) {
+      return {{this, slot}, false};
+    }
+    if (growth_left_ == 0) {
+      // a table that is mostly tombstones is cleaned at its current size
+      if (capacity_ == 0) {
+        rehash_to(Group::kWidth);
+      } else {
+        auto const grow = size_ * 32 > capacity_ * 25;
+        rehash_to(grow ? capacity_ * 2 : capacity_);
+      }
+    }
+    auto slot = free_slot(hash);
+    SlotAllocatorTraits::construct(
+        allocator_, &slots_[slot], std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+    if (control(slot) == Group::kEmpty) {
+      --growth_left_;
+    }
+    set_control(slot, tag(hash));
+    ++size_;
+    return {{this, slot}, true};
+  }
+
+  ///\brief Insert an element if key is absent - std::unordered_map style
+  template <typename Value>
+  std::pair<iterator, bool> emplace(key_type key, Value&& value) {
+    return try_emplace(key, std::forward<Value>(value));
+  }
+
+  ///\brief return the element of key, inserting a value initialized one if
+  /// it is absent
+  mapped_type& operator[](key_type key) {
+    return try_emplace(key).first->second;
+  }
+
+  ///\brief Erase the element of key
+  ///\return the number of erased elements
+  size_type erase(key_type key) {
+    auto slot = find_slot(key);
+    if (slot == capacity_) {
+      return 0;
+    }
+    erase_slot(slot);
+    return 1;
+  }
+
+  ///\brief Erase the element at position
+  ///\return the iterator following position
+  iterator erase(const_iterator position) {
+    erase_slot(position.slot_);
+    return {this, next_full_slot(position.slot_ + 1)};
+  }
+
+ private:
+  [[nodiscard]] static std::int8_t tag(std::uint64_t hash) {
+    return static_cast<std::int8_t>(hash & 0x7FU);
+  }
+
+  [[nodiscard]] static size_type max_elements(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  [[nodiscard]] static size_type capacity_for(size_type count) {
+    auto capacity = std::bit_ceil(count + count / 7 + 1);
+    return std::max(capacity, Group::kWidth);
+  }
+
+  [[nodiscard]] size_type number_of_groups() const {
+    return capacity_ / Group::kWidth;
+  }
+
+  [[nodiscard]] std::int8_t control(std::size_t slot) const {
+    return groups_[slot / Group::kWidth].bytes[slot % Group::kWidth];
+  }
+
+  void set_control(std::size_t slot, std::int8_t value) {
+    groups_[slot / Group::kWidth].bytes[slot % Group::kWidth] = value;
+  }
+
+  ///\internal return the first group of the probe sequence of hash
+  [[nodiscard]] std::size_t first_group(std::uint64_t hash) const {
+    return (hash >> 7U) & (number_of_groups() - 1);
+  }
+
+  ///\internal return the group after group in the probe sequence
+  /// The triangular step visits every group once, as the number of groups is
+  /// a power of two.
+  [[nodiscard]] std::size_t next_group(std::size_t group,
+                                       std::size_t step) const {
+    return (group + step) & (number_of_groups() - 1);
+  }
+
+  [[nodiscard]] std::size_t find_slot(key_type key) const {
+    return find_slot(key, internal::mix_key(static_cast<std::uint64_t>(key)));
+  }
+
+  [[nodiscard]] std::size_t find_slot(key_type key, std::uint64_t hash) const {
+    if (size_ == 0) {
+      return capacity_;
+    }
+    auto group = first_group(hash);
+    for (std::size_t step = 1;; ++step) {
+      auto const& control_group = groups_[group];
+      for (auto matches = control_group.match(tag(hash)); matches != 0;
+           matches &= matches - 1) {
+        auto slot = group * Group::kWidth +
+                    static_cast<std::size_t>(std::countr_zero(matches));
+        if (slots_[slot].first == key) [[likely]] {
+          return slot;
+        }
+      }
+      // an insertion never probes past a group with an empty slot
+      if (control_group.match(Group::kEmpty) != 0) {
+        return capacity_;
+      }
+      group = next_group(group, step);
+    }
+  }
+
+  [[nodiscard]] std::size_t free_slot(std::uint64_t hash) const {
+    auto group = first_group(hash);
+    for (std::size_t step = 1;; ++step) {
+      if (auto matches = groups_[group].match_free(); matches != 0) {
+        return group * Group::kWidth +
+               static_cast<std::size_t>(std::countr_zero(matches));
+      }
+      group = next_group(group, step);
+    }
+  }
+
+  [[nodiscard]] std::size_t next_full_slot(std::size_t slot) const {
+    while (slot < capacity_ && control(slot) < 0) {
+      ++slot;
+    }
+    return slot;
+  }
+
+  void erase_slot(std::size_t slot) {
+    SlotAllocatorTraits::destroy(allocator_, &slots_[slot]);
+    --size_;
+    // no probe sequence continues past a group that still has an empty
+    // slot, so the slot can become empty again rather than a tombstone
+    if (groups_[slot / Group::kWidth].match(Group::kEmpty) != 0) {
+      set_control(slot, Group::kEmpty);
+      ++growth_left_;
+    } else {
+      set_control(slot, Group::kDeleted);
+    }
+  }
+
+  void rehash_to(size_type new_capacity) {
+    modern_cpp_template_assert(std::has_single_bit(new_capacity) &&
+                               new_capacity >= Group::kWidth);
+    // the allocator stays put - std::pmr::polymorphic_allocator cannot be
+    // assigned - and only the arrays change hands
+    FlatHashMap old(allocator_);
+    old.steal(*this);
+    allocate(new_capacity);
+    for (std::size_t slot = 0; slot < old.capacity_; ++slot) {
+      if (old.control(slot) < 0) {
+        continue;
+      }
+      auto& element = old.slots_[slot];
+      auto const hash =
+          internal::mix_key(static_cast<std::uint64_t>(element.first));
+      auto new_slot = free_slot(hash);
+      SlotAllocatorTraits::construct(
+          allocator_, &slots_[new_slot], std::piecewise_construct,
+          std::forward_as_tuple(element.first),
+          std::forward_as_tuple(std::move(element.second)));
+      set_control(new_slot, tag(hash));
+    }
+    size_ = old.size_;
+    growth_left_ = max_elements(capacity_) - size_;
+  }
+
+  void allocate(size_type capacity) {
+    GroupAllocator group_allocator(allocator_);
+    groups_ = GroupAllocatorTraits::allocate(group_allocator,
+                                             capacity / Group::kWidth);
+    for (std::size_t group = 0; group < capacity / Group::kWidth; ++group) {
+      ::new (&groups_[group]) Group{};
+      groups_[group].bytes.fill(Group::kEmpty);
+    }
+    slots_ = SlotAllocatorTraits::allocate(allocator_, capacity);
+    capacity_ = capacity;
+    size_ = 0;
+    growth_left_ = max_elements(capacity);
+  }
+
+  void destroy_elements() {
+    for (std::size_t slot = 0; slot < capacity_; ++slot) {
+      if (control(slot) >= 0) {
+        SlotAllocatorTraits::destroy(allocator_, &slots_[slot]);
+      }
+    }
+  }
+
+  void destroy() {
+    if (capacity_ == 0) {
+      return;
+    }
+    destroy_elements();
+    GroupAllocator group_allocator(allocator_);
+    GroupAllocatorTraits::deallocate(group_allocator, groups_,
+                                     number_of_groups());
+    SlotAllocatorTraits::deallocate(allocator_, slots_, capacity_);
+    groups_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+
+  void steal(FlatHashMap& other) {
+    groups_ = std::exchange(other.groups_, nullptr);
+    slots_ = std::exchange(other.slots_, nullptr);
+    capacity_ = std::exchange(other.capacity_, 0);
+    size_ = std::exchange(other.size_, 0);
+    growth_left_ = std::exchange(other.growth_left_, 0);
+  }
+
+  void copy_from(FlatHashMap const& other) {
+    reserve(other.size());
+    for (auto const& [key, value] : other) {
+      try_emplace(key, value);
+    }
+  }
+
+  [[no_unique_address]] allocator_type allocator_{};
+  Group* groups_{nullptr};
+  value_type* slots_{nullptr};
+  size_type capacity_{0};
+  size_type size_{0};
+  size_type growth_left_{0};
+};
+
+}  // namespace modern_cpp_template::algorithms
@@ -0,0 +1,141 @@
+///\file graph_traits.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Uniform adjacency access to the graph types so that algorithms can
+/// be written once for all of them
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief Adjacency access for a graph type
+/// Every specialization provides:
+/// - Vertex: the dense index type the algorithms work with, in
+///   [0, number_of_nodes(graph))
+/// - NodeIndex / CostType: the user facing node id and edge cost types
+/// - kInvalidVertex: a Vertex value that is never a valid vertex
+/// - number_of_nodes(graph)
+/// - vertex(graph, node_index): map a user facing node id to its Vertex
+/// - node_index(graph, vertex): map a Vertex back to the user facing node id
+/// - for_each_neighbor(graph, vertex, function): call function(target, cost)
+///   for every edge of vertex
+///
+/// A graph type whose nodes can be removed also provides
+/// is_removed(graph, vertex); see is_removed_vertex().
+///\tparam Graph the graph type
+template <typename Graph>
+struct GraphTraits;
+
+///\brief return true if a vertex is a removed node that a search must not
+/// start from; false for graph types without node removal
+///\tparam Graph any graph type with a GraphTraits specialization
+///\param graph the graph
+///\param vertex the vertex
+template <typename Graph>
+[[nodiscard]] bool is_removed_vertex(
+    Graph const& graph, typename GraphTraits<Graph>::Vertex vertex) {
+  if constexpr (requires { GraphTraits<Graph>::is_removed(graph, vertex); }) {
+    return GraphTraits<Graph>::is_removed(graph, vertex);
+  } else {
+    return false;
+  }
+}
+
+///\brief GraphTraits for UndirectedGraph - node ids are used directly as
+/// vertices, which relies on the dense ids already required by get_node()
+template <typename NodeValue, typename CostType_T, typename Allocator,
+          template <typename, typename, typename> class Map>
+struct GraphTraits<UndirectedGraph<NodeValue, CostType_T, Allocator, Map>> {
+  using Graph = UndirectedGraph<NodeValue, CostType_T, Allocator, Map>;
+  using NodeIndex = typename Graph::NodeIndex;
+  using Vertex = NodeIndex;
+  using CostType = CostType_T;
+  static constexpr Vertex kInvalidVertex{-1};
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    modern_cpp_template_assert_message(
+        node_index >= 0 &&
+            static_cast<std::size_t>(node_index) < graph.number_of_nodes(),
+        "node is not in the graph");
+    return node_index;
+  }
+
+  [[nodiscard]] static NodeIndex node_index(Graph const& /*graph*/,
+                                            Vertex vertex) {
+    return vertex;
+  }
+
+  [[nodiscard]] static bool is_removed(Graph const& graph, Vertex vertex) {
+    return graph.get_node(vertex).is_removed;
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    for (auto const& edge : graph.get_edges(vertex)) {
+      if (edge.is_removed()) {
+        continue;
+      }
+      modern_cpp_template_assert_message(
+          static_cast<std::size_t>(edge.tail_node_index) <
+              graph.number_of_nodes(),
+          "node ids must be dense");
+      function(edge.tail_node_index, edge.cost);
+    }
+  }
+};
+
+///\brief GraphTraits for CsrGraph - vertices are local indices
+template <typename NodeValue, typename CostType_T>
+struct GraphTraits<CsrGraph<NodeValue, CostType_T>> {
+  using Graph = CsrGraph<NodeValue, CostType_T>;
+  using NodeIndex = typename Graph::NodeIndex;
+  using Vertex = typename Graph::LocalIndex;
+  using CostType = CostType_T;
+  static constexpr Vertex kInvalidVertex{Graph::kInvalidLocalIndex};
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    auto local_index = graph.find_local(node_index);
+    modern_cpp_template_assert_message(local_index != kInvalidVertex,
+                                       "node is not in the graph");
+    return local_index;
+  }
+
+  [[nodiscard]] static NodeIndex node_index(Graph const& graph,
+                                            Vertex vertex) {
+    return graph.original_id(vertex);
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    auto neighbors = graph.neighbors(vertex);
+    auto costs = graph.neighbor_costs(vertex);
+    for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+      function(neighbors[edge], costs[edge]);
+    }
+  }
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,392 @@
+///\file k_core.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Linear time k-core decomposition and degree statistics
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The degree distribution of a graph
+/// The degree of a node is the number of edges it stores, so a parallel edge
+/// counts once per copy and a self loop twice - the same as
+/// CsrGraph::degree() and UndirectedGraph::degree().
+struct DegreeStatistics {
+  ///\brief The number of nodes
+  std::size_t number_of_nodes{0};
+  ///\brief The number of stored (directed) edges - the sum of the degrees
+  std::size_t number_of_edges{0};
+  ///\brief The smallest degree; zero for an empty graph
+  std::size_t min_degree{0};
+  ///\brief The largest degree
+  std::size_t max_degree{0};
+  ///\brief The mean degree
+  double mean_degree{0.0};
+  ///\brief The lower median of the degrees
+  std::size_t median_degree{0};
+  ///\brief The number of nodes without edges
+  std::size_t isolated_nodes{0};
+  ///\brief The number of nodes of every degree, indexed by degree; has
+  /// max_degree + 1 entries for a non-empty graph
+  std::vector<std::size_t> histogram{};
+};
+
+///\brief The k-core decomposition of a graph, indexed by local index
+/// The k-core is the largest subgraph in which every node has at least k
+/// neighbors.  The core number of a node is the largest k whose k-core
+/// contains it.
+struct CoreDecomposition {
+  using CoreNumber = uint32_t;
+
+  ///\brief The core number of every node
+  std::vector<CoreNumber> core_numbers{};
+  ///\brief The largest core number - the degeneracy of the graph
+  CoreNumber degeneracy{0};
+
+  ///\brief return the number of nodes in the k-core
+  ///\param k the core to measure
+  [[nodiscard]] std::size_t core_size(CoreNumber k) const {
+    return static_cast<std::size_t>(
+        std::count_if(core_numbers.begin(), core_numbers.end(),
+                      [k](CoreNumber core) { return core >= k; }));
+  }
+
+  ///\brief return the local indices of the nodes of the k-core, ascending
+  ///\param k the core to extract
+  [[nodiscard]] std::vector<uint32_t> core_nodes(CoreNumber k) const {
+    std::vector<uint32_t> nodes;
+    for (std::size_t node = 0; node < core_numbers.size(); ++node) {
+      if (core_numbers[node] >= k) {
+        nodes.push_back(static_cast<uint32_t>(node));
+      }
+    }
+    return nodes;
+  }
+};
+
+namespace internal {
+
+///\brief Summarize a degree histogram into DegreeStatistics
+///\param histogram the number of nodes of every degree; trailing zeros
+/// are trimmed
+[[nodiscard]] inline DegreeStatistics summarize_degrees(
+    std::vector<std::size_t> histogram) {
+  while (!histogram.empty() && histogram.back() == 0) {
+    histogram.pop_back();
+  }
+  DegreeStatistics statistics;
+  for (std::size_t degree = 0; degree < histogram.size(); ++degree) {
+    statistics.number_of_nodes += histogram[degree];
+    statistics.number_of_edges += degree * histogram[degree];
+  }
+  if (statistics.number_of_nodes == 0) {
+    return statistics;
+  }
+  statistics.max_degree = histogram.size() - 1;
+  statistics.min_degree = static_cast<std::size_t>(
+      std::find_if(histogram.begin(), histogram.end(),
+                   [](std::size_t count) { return count != 0; }) -
+      histogram.begin());
+  statistics.mean_degree = static_cast<double>(statistics.number_of_edges) /
+                           static_cast<double>(statistics.number_of_nodes);
+  auto const median_rank = (statistics.number_of_nodes - 1) / 2;
+  std::size_t seen{0};
+  for (std::size_t degree = 0; degree < histogram.size(); ++degree) {
+    seen += histogram[degree];
+    if (seen > median_rank) {
+      statistics.median_degree = degree;
+      break;
+    }
+  }
+  statistics.isolated_nodes = histogram.front();
+  statistics.histogram = std::move(histogram);
+  return statistics;
+}
+
+///\brief The degree of every node for the core decomposition: self loops
+/// are dropped, since a node cannot be its own neighbor in a k-core
+template <typename NodeValue, typename CostType>
+[[nodiscard]] std::vector<CoreDecomposition::CoreNumber> core_degrees(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  using CoreNumber = CoreDecomposition::CoreNumber;
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  std::vector<CoreNumber> degrees(graph.number_of_nodes());
+  for (LocalIndex node = 0; node < degrees.size(); ++node) {
+    auto const neighbors = graph.neighbors(node);
+    auto const degree = neighbors.size() - static_cast<std::size_t>(std::count(
+                                               neighbors.begin(),
+                                               neighbors.end(), node));
+    modern_cpp_template_assert_message(
+        degree < std::numeric_limits<CoreNumber>::max(),
+        "degree too large for a 32-bit core number");
+    degrees[node] = static_cast<CoreNumber>(degree);
+  }
+  return degrees;
+}
+
+///\brief Per-thread totals of one peeling level on their own cache line
+struct alignas(64) ThreadPeelState {
+  std::size_t frontier_size{0};
+  CoreDecomposition::CoreNumber next_level{0};
+};
+
+}  // namespace internal
+
+///\brief Summarize the degree distribution of a graph in O(V)
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to summarize
+///\return DegreeStatistics
+template <typename NodeValue, typename CostType>
+[[nodiscard]] DegreeStatistics degree_statistics(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  std::vector<std::size_t> histogram;
+  for (LocalIndex node = 0; node < graph.number_of_nodes(); ++node) {
+    auto const degree = graph.degree(node);
+    if (degree >= histogram.size()) {
+      histogram.resize(degree + 1, 0);
+    }
+    ++histogram[degree];
+  }
+  return internal::summarize_degrees(std::move(histogram));
+}
+
+///\brief Summarize the degree distribution of a graph in O(V)
+/// Node ids are dense, as required by get_node(), so every node costs one
+/// adjacency lookup.  With dense integer keys the lookups touch the buckets
+/// in order, which beats walking the node list of a std::unordered_map.
+/// Removed nodes are left out.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to summarize
+///\return DegreeStatistics
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+[[nodiscard]] DegreeStatistics degree_statistics(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph) {
+  using NodeIndex = typename UndirectedGraph<NodeValue, CostType, Allocator,
+                                             Map>::NodeIndex;
+  std::vector<std::size_t> histogram;
+  bool const has_removed_nodes = graph.number_of_removed_nodes() != 0;
+  for (std::size_t node = 0; node < graph.number_of_nodes(); ++node) {
+    auto const node_index = static_cast<NodeIndex>(node);
+    if (has_removed_nodes && graph.get_node(node_index).is_removed) {
+      continue;
+    }
+    auto const degree = graph.degree(node_index);
+    if (degree >= histogram.size()) {
+      histogram.resize(degree + 1, 0);
+    }
+    ++histogram[degree];
+  }
+  return internal::summarize_degrees(std::move(histogram));
+}
+
+///\brief Compute the core number of every node in O(V + E)
+/// The bucket algorithm of Batagelj and Zaversnik: the nodes are kept sorted
+/// by their remaining degree in one array, with the start of every degree
+/// bucket.  Nodes are removed in that order; removing a node moves each of
+/// its neighbors with a larger remaining degree one bucket down by swapping
+/// it with the first node of its bucket, so every edge costs O(1).
+///
+/// Self loops are ignored; parallel edges count with their multiplicity.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to decompose
+///\return CoreDecomposition the core number of every node
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CoreDecomposition core_decomposition(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  auto const number_of_nodes = graph.number_of_nodes();
+  CoreDecomposition result;
+  result.core_numbers = internal::core_degrees(graph);
+  if (number_of_nodes == 0) {
+    return result;
+  }
+  auto& degrees = result.core_numbers;
+  auto const max_degree = *std::max_element(degrees.begin(), degrees.end());
+
+  // bucket_starts[d] is the position of the first node of remaining degree d
+  std::vector<std::size_t> bucket_starts(std::size_t{max_degree} + 2, 0);
+  for (auto degree : degrees) {
+    ++bucket_starts[degree + 1];
+  }
+  for (std::size_t degree = 1; degree < bucket_starts.size(); ++degree) {
+    bucket_starts[degree] += bucket_starts[degree - 1];
+  }
+  std::vector<LocalIndex> order(number_of_nodes);
+  std::vector<std::size_t> positions(number_of_nodes);
+  {
+    auto next_positions = bucket_starts;
+    for (LocalIndex node = 0; node < number_of_nodes; ++node) {
+      positions[node] = next_positions[degrees[node]]++;
+      order[positions[node]] = node;
+    }
+  }
+
+  for (std::size_t position = 0; position < number_of_nodes; ++position) {
+    auto const node = order[position];
+    auto const node_degree = degrees[node];
+    for (auto neighbor : graph.neighbors(node)) {
+      auto const neighbor_degree = degrees[neighbor];
+      if (neighbor_degree <= node_degree) {
+        continue;
+      }
+      // swap the neighbor with the first node of its bucket, then shrink the
+      // bucket past it
+      auto const neighbor_position = positions[neighbor];
+      auto const first_position = bucket_starts[neighbor_degree];
+      auto const first_node = order[first_position];
+      if (first_node != neighbor) {
+        order[neighbor_position] = first_node;
+        positions[first_node] = neighbor_position;
+        order[first_position] = neighbor;
+        positions[neighbor] = first_position;
+      }
+      ++bucket_starts[neighbor_degree];
+      --degrees[neighbor];
+    }
+  }
+  result.degeneracy = *std::max_element(degrees.begin(), degrees.end());
+  return result;
+}
+
+///\brief Compute the core number of every node with multiple threads
+/// Level-synchronous peeling (PKC, Kabir and Madduri 2017).  For every level
+/// k each thread scans its range of nodes for a remaining degree of exactly
+/// k, then removes them from the graph: the remaining degree of each
+/// neighbor above k is decremented atomically, and the one thread whose
+/// decrement lands on k adds that neighbor to its own frontier.  Levels
+/// without any node are skipped, so the total work is O(E + V * L) for L
+/// distinct core numbers.  Prefer core_decomposition(graph) on one thread.
+///
+/// Self loops are ignored; parallel edges count with their multiplicity.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to decompose
+///\param pool the worker threads to run on
+///\return CoreDecomposition the core number of every node
+template <typename NodeValue, typename CostType>
+[[nodiscard]] CoreDecomposition core_decomposition(
+    CsrGraph<NodeValue, CostType> const& graph, WorkerPool& pool) {
+  using CoreNumber = CoreDecomposition::CoreNumber;
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  auto const number_of_nodes = graph.number_of_nodes();
+  CoreDecomposition result;
+  if (number_of_nodes == 0) {
+    return result;
+  }
+
+  std::vector<std::atomic<CoreNumber>> degrees(number_of_nodes);
+  {
+    auto const initial_degrees = internal::core_degrees(graph);
+    for (std::size_t node = 0; node < number_of_nodes; ++node) {
+      degrees[node].store(initial_degrees[node], std::memory_order_relaxed);
+    }
+  }
+  std::vector<internal::ThreadPeelState> states(pool.size());
+  // the peeling schedule: the level being peeled, whether any thread found
+  // a node at it, and whether every node is gone.  Each thread scans with
+  // its own partial view, so the barriers merge the views into this one.
+  CoreNumber level{0};
+  std::size_t removed_nodes{0};
+  bool has_frontier{false};
+  bool is_finished{false};
+
+  std::barrier scan_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        has_frontier = std::any_of(
+            states.begin(), states.end(),
+            [](auto const& state) { return state.frontier_size != 0; });
+        if (!has_frontier) {
+          level = std::min_element(states.begin(), states.end(),
+                                   [](auto const& lhs, auto const& rhs) {
+                                     return lhs.next_level < rhs.next_level;
+                                   })
+                      ->next_level;
+        }
+      });
+  std::barrier level_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        for (auto const& state : states) {
+          removed_nodes += state.frontier_size;
+        }
+        is_finished = removed_nodes == number_of_nodes;
+        if (has_frontier) {
+          ++level;
+        }
+      });
+
+  pool.run([&](std::size_t thread_index) {
+    auto const [begin, end] =
+        partition_range(number_of_nodes, thread_index, pool.size());
+    auto& state = states[thread_index];
+    std::vector<LocalIndex> frontier;
+    while (!is_finished) {
+      frontier.clear();
+      state.next_level = std::numeric_limits<CoreNumber>::max();
+      for (auto node = begin; node < end; ++node) {
+        auto const degree = degrees[node].load(std::memory_order_relaxed);
+        if (degree == level) {
+          frontier.push_back(static_cast<LocalIndex>(node));
+        } else if (degree > level) {
+          state.next_level = std::min(state.next_level, degree);
+        }
+      }
+      state.frontier_size = frontier.size();
+      scan_barrier.arrive_and_wait();
+
+      if (has_frontier) {
+        // the frontier grows while it is processed
+        for (std::size_t position = 0; position < frontier.size();
+             ++position) {
+          auto const node = frontier[position];
+          for (auto neighbor : graph.neighbors(node)) {
+            if (neighbor == node ||
+                degrees[neighbor].load(std::memory_order_relaxed) <= level) {
+              continue;
+            }
+            auto const previous =
+                degrees[neighbor].fetch_sub(1, std::memory_order_relaxed);
+            if (previous == level + 1) {
+              frontier.push_back(neighbor);
+            } else if (previous <= level) {
+              // another thread got there first; undo
+              degrees[neighbor].fetch_add(1, std::memory_order_relaxed);
+            }
+          }
+        }
+        state.frontier_size = frontier.size();
+      }
+      level_barrier.arrive_and_wait();
+    }
+  });
+
+  result.core_numbers.resize(number_of_nodes);
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    result.core_numbers[node] = degrees[node].load(std::memory_order_relaxed);
+    result.degeneracy = std::max(result.degeneracy, result.core_numbers[node]);
+  }
+  return result;
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,608 @@
+///\file mapped_graph.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A versioned binary graph file and a zero-copy, memory-mapped view
+/// of it
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief How node values are stored in the value blob of a graph file
+/// Every specialization provides:
+/// - View: the type handed out by MappedGraph - it may point into the mapping
+/// - kTypeTag: identifies the encoding; a file is only opened by a
+///   MappedGraph whose tag matches the one it was written with
+/// - append(blob, value): encode value at the end of blob
+/// - view(bytes): decode the bytes written by append
+///\tparam NodeValue The value stored in a Node
+template <typename NodeValue, typename Enable = void>
+struct GraphFileValueCodec;
+
+///\brief Strings are stored as their raw bytes and viewed in place
+template <>
+struct GraphFileValueCodec<std::string> {
+  using View = std::string_view;
+  static constexpr std::uint32_t kTypeTag{0x0001'0000U};
+
+  static void append(std::vector<char>& blob, std::string const& value) {
+    blob.insert(blob.end(), value.begin(), value.end());
+  }
+
+  [[nodiscard]] static View view(std::span<char const> bytes) {
+    return {bytes.data(), bytes.size()};
+  }
+};
+
+///\brief Trivially copyable values are stored as their object
+/// representation and copied out on access, as the blob gives no alignment
+/// guarantee
+template <typename NodeValue>
+struct GraphFileValueCodec<
+    NodeValue, std::enable_if_t<std::is_trivially_copyable_v<NodeValue>>> {
+  using View = NodeValue;
+  static constexpr std::uint32_t kTypeTag{
+      0x0002'0000U | static_cast<std::uint32_t>(sizeof(NodeValue))};
+
+  static void append(std::vector<char>& blob, NodeValue const& value) {
+    std::array<char, sizeof(NodeValue)> bytes{};
+    std::memcpy(bytes.data(), &value, sizeof(NodeValue));
+    blob.insert(blob.end(), bytes.begin(), bytes.end());
+  }
+
+  [[nodiscard]] static View view(std::span<char const> bytes) {
+    modern_cpp_template_assert(bytes.size() == sizeof(NodeValue));
+    NodeValue value;
+    std::memcpy(&value, bytes.data(), sizeof(NodeValue));
+    return value;
+  }
+};
+
+///\brief The fixed size header at the start of a graph file
+/// All integers are in the byte order of the writer; endianness lets a reader
+/// with a different byte order reject the file rather than misread it.
+/// Every section starts at a multiple of kGraphFileAlignment so that the
+/// mapped arrays can be used in place.
+struct GraphFileHeader {
+  ///\brief the sections of a graph file, in file order
+  enum Section : std::size_t {
+    kNodeIds,       ///< int64 original node id per local index, ascending
+    kOffsets,       ///< uint64 row offsets, number_of_nodes + 1 entries
+    kTargets,       ///< uint32 edge targets (local indices)
+    kCosts,         ///< CostType edge costs, parallel to targets
+    kValueOffsets,  ///< uint64 value blob offsets, number_of_nodes + 1
+    kValueBlob,     ///< encoded node values
+    kNumberOfSections
+  };
+
+  ///\brief the byte range of one section, relative to the start of the file
+  struct Extent {
+    std::uint64_t offset{0};
+    std::uint64_t size{0};
+  };
+
+  std::array<char, 8> magic{};
+  std::uint32_t version{0};
+  std::uint32_t endianness{0};
+  std::uint32_t cost_type_tag{0};
+  std::uint32_t value_type_tag{0};
+  std::uint64_t number_of_nodes{0};
+  std::uint64_t number_of_edges{0};
+  std::array<Extent, kNumberOfSections> sections{};
+};
+
+static_assert(std::is_trivially_copyable_v<GraphFileHeader>);
+
+///\brief The magic bytes at the start of every graph file
+static constexpr std::array<char, 8> kGraphFileMagic{'M', 'C', 'T', 'G',
+                                                      'R', 'A', 'P', 'H'};
+///\brief The current graph file format version
+static constexpr std::uint32_t kGraphFileVersion{1};
+///\brief Written as-is; reads back differently on a foreign byte order
+static constexpr std::uint32_t kGraphFileEndianness{0x0102'0304U};
+///\brief Alignment of every section - one cache line
+static constexpr std::size_t kGraphFileAlignment{64};
+
+namespace internal {
+
+///\internal Identify an arithmetic cost type: float flag, sign flag, size
+template <typename CostType>
+[[nodiscard]] constexpr std::uint32_t graph_file_cost_type_tag() {
+  static_assert(std::is_arithmetic_v<CostType>,
+                "graph files store arithmetic edge costs only");
+  return (std::is_floating_point_v<CostType> ? 0x0002'0000U : 0U) |
+         (std::is_signed_v<CostType> ? 0x0001'0000U : 0U) |
+         static_cast<std::uint32_t>(sizeof(CostType));
+}
+
+///\internal Round an offset up to the section alignment
+[[nodiscard]] constexpr std::uint64_t align_section(std::uint64_t offset) {
+  return (offset + kGraphFileAlignment - 1) / kGraphFileAlignment *
+         kGraphFileAlignment;
+}
+
+[[noreturn]] inline void throw_graph_file_error(
+    std::filesystem::path const& path, std::string const& what) {
+  throw std::runtime_error("graph file " + path.string() + ": " + what);
+}
+
+}  // namespace internal
+
+///\brief Write a CsrGraph to a graph file that MappedGraph can open
+/// The file is written next to path and renamed into place once complete, so
+/// a process mapping path never observes a partially written file.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to write
+///\param path the file to create or replace
+///\throw std::runtime_error if the file cannot be written
+template <typename NodeValue, typename CostType>
+void write_graph_file(CsrGraph<NodeValue, CostType> const& graph,
+                      std::filesystem::path const& path) {
+  using Codec = GraphFileValueCodec<NodeValue>;
+  using Header = GraphFileHeader;
+
+  auto const number_of_nodes = graph.number_of_nodes();
+  std::vector<typename CsrGraph<NodeValue, CostType>::NodeIndex> node_ids(
+      number_of_nodes);
+  std::vector<std::uint64_t> value_offsets(number_of_nodes + 1, 0);
+  std::vector<char> value_blob;
+  for (std::size_t local = 0; local < number_of_nodes; ++local) {
+    auto const& node = graph.nodes()[local];
+    node_ids[local] = node.id;
+    Codec::append(value_blob, node.value);
+    value_offsets[local + 1] = value_blob.size();
+  }
+
+  auto as_bytes = [](auto const& range) {
+    return std::as_bytes(std::span(range));
+  };
+  std::array<std::span<std::byte const>, Header::kNumberOfSections> contents{
+      as_bytes(node_ids),      as_bytes(graph.offsets()),
+      as_bytes(graph.targets()), as_bytes(graph.costs()),
+      as_bytes(value_offsets), as_bytes(value_blob)};
+
+  Header header;
+  header.magic = kGraphFileMagic;
+  header.version = kGraphFileVersion;
+  header.endianness = kGraphFileEndianness;
+  header.cost_type_tag = internal::graph_file_cost_type_tag<CostType>();
+  header.value_type_tag = Codec::kTypeTag;
+  header.number_of_nodes = number_of_nodes;
+  header.number_of_edges = graph.number_of_edges();
+  std::uint64_t end = sizeof(Header);
+  for (std::size_t section = 0; section < contents.size(); ++section) {
+    header.sections[section] = {internal::align_section(end),
+                                contents[section].size()};
+    end = header.sections[section].offset + header.sections[section].size;
+  }
+
+  auto temporary_path = path;
+  temporary_path += ".partial";
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      internal::throw_graph_file_error(temporary_path, "cannot be created");
+    }
+    std::array<char, kGraphFileAlignment> const padding{};
+    auto write = [&file](void const* data, std::size_t size) {
+      file.write(static_cast<char const*>(data),
+                 static_cast<std::streamsize>(size));
+    };
+    write(&header, sizeof(Header));
+    std::uint64_t position = sizeof(Header);
+    for (std::size_t section = 0; section < contents.size(); ++section) {
+      write(padding.data(), header.sections[section].offset - position);
+      write(contents[section].data(), contents[section].size());
+      position = header.sections[section].offset + contents[section].size();
+    }
+    file.flush();
+    if (!file) {
+      internal::throw_graph_file_error(temporary_path, "write failed");
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary_path, path, error);
+  if (error) {
+    internal::throw_graph_file_error(path, error.message());
+  }
+}
+
+///\brief Write an UndirectedGraph to a graph file that MappedGraph can open
+///\see write_graph_file(CsrGraph const&, path)
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+void write_graph_file(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph,
+    std::filesystem::path const& path) {
+  write_graph_file(freeze(graph), path);
+}
+
+///\brief A read-only graph backed by a memory-mapped graph file
+/// Opening only maps the file and validates its header, so it costs the same
+/// regardless of the size of the graph; pages are faulted in by the kernel as
+/// the graph is traversed and are shared between every process mapping the
+/// same file.  The layout and the local indices are those of the CsrGraph the
+/// file was written from, and the traversal API mirrors CsrGraph.
+///
+/// Only the header and the section bounds are validated.  A file whose
+/// arrays were corrupted after writing is not detected.
+///\tparam NodeValue_T The value type the file was written with
+///\tparam CostType_T The edge cost type the file was written with
+template <typename NodeValue_T, typename CostType_T>
+class MappedGraph {
+  using Codec = GraphFileValueCodec<NodeValue_T>;
+  using Header = GraphFileHeader;
+
+ public:
+  using NodeValue = NodeValue_T;
+  using CostType = CostType_T;
+  using NodeIndex = typename CsrGraph<NodeValue, CostType>::NodeIndex;
+  using LocalIndex = typename CsrGraph<NodeValue, CostType>::LocalIndex;
+  using EdgeOffset = std::uint64_t;
+  using ValueView = typename Codec::View;
+  using VisitationContext =
+      modern_cpp_template::algorithms::VisitationContext<LocalIndex>;
+
+  static_assert(sizeof(NodeIndex) == sizeof(std::int64_t),
+                "graph files store 64-bit node ids");
+
+  ///\brief A node of the mapped graph - value may point into the mapping
+  struct Node {
+    NodeIndex id{0};
+    ValueView value{};
+  };
+
+  ///\brief Sentinel returned by find_local() for an unknown node id
+  static constexpr LocalIndex kInvalidLocalIndex{
+      CsrGraph<NodeValue, CostType>::kInvalidLocalIndex};
+
+  ///\brief Map a graph file
+  ///\param path the file written by write_graph_file
+  ///\throw std::system_error if the file cannot be opened or mapped
+  ///\throw std::runtime_error if the file is not a compatible graph file
+  explicit MappedGraph(std::filesystem::path const& path) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    int const file_descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot open graph file " + path.string());
+    }
+    struct stat file_status {};
+    if (::fstat(file_descriptor, &file_status) != 0) {
+      auto const error = errno;
+      ::close(file_descriptor);
+      throw std::system_error(error, std::generic_category(),
+                              "cannot stat graph file " + path.string());
+    }
+    mapping_size_ = static_cast<std::size_t>(file_status.st_size);
+    if (mapping_size_ < sizeof(Header)) {
+      ::close(file_descriptor);
+      internal::throw_graph_file_error(path, "truncated header");
+    }
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED,
+                      file_descriptor, 0);
+    auto const error = errno;
+    // the mapping stays valid after the descriptor is closed
+    ::close(file_descriptor);
+    if (mapping_ == MAP_FAILED) {
+      mapping_ = nullptr;
+      throw std::system_error(error, std::generic_category(),
+                              "cannot map graph file " + path.string());
+    }
+    try {
+      bind_sections(path);
+    } catch (...) {
+      unmap();
+      throw;
+    }
+  }
+
+  MappedGraph(MappedGraph const&) = delete;
+  MappedGraph& operator=(MappedGraph const&) = delete;
+
+  MappedGraph(MappedGraph&& other) noexcept { swap(other); }
+
+  MappedGraph& operator=(MappedGraph&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~MappedGraph() { unmap(); }
+
+  ///\brief return the number of nodes in the graph
+  [[nodiscard]] std::size_t number_of_nodes() const {
+    return node_ids_.size();
+  }
+
+  ///\brief return the number of stored (directed) edges
+  /// Every undirected edge is stored once in each direction
+  [[nodiscard]] std::size_t number_of_edges() const { return targets_.size(); }
+
+  ///\brief Readonly accessor for the row offsets - number_of_nodes() + 1
+  /// entries
+  [[nodiscard]] std::span<EdgeOffset const> offsets() const {
+    return offsets_;
+  }
+
+  ///\brief Readonly accessor for the edge targets (local indices)
+  [[nodiscard]] std::span<LocalIndex const> targets() const {
+    return targets_;
+  }
+
+  ///\brief Readonly accessor for the edge costs - parallel to targets()
+  [[nodiscard]] std::span<CostType const> costs() const { return costs_; }
+
+  ///\brief Return the Node at a local index
+  ///\param local_index the local index of the Node
+  ///\return Node
+  [[nodiscard]] Node node(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < node_ids_.size());
+    auto const begin = value_offsets_[local_index];
+    auto const end = value_offsets_[local_index + 1];
+    return {node_ids_[local_index],
+            Codec::view(value_blob_.subspan(begin, end - begin))};
+  }
+
+  ///\brief Return the original node id of a local index
+  ///\param local_index the local index of the Node
+  ///\return NodeIndex
+  [[nodiscard]] NodeIndex original_id(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < node_ids_.size());
+    return node_ids_[local_index];
+  }
+
+  ///\brief Find the local index of an original node id
+  ///\param node_index the original id of the Node
+  ///\return LocalIndex the local index or kInvalidLocalIndex if not found
+  [[nodiscard]] LocalIndex find_local(NodeIndex node_index) const {
+    auto id_iterator =
+        std::lower_bound(node_ids_.begin(), node_ids_.end(), node_index);
+    [[likely]] if (id_iterator != node_ids_.end() &&
+                   *id_iterator == node_index) {
+      return static_cast<LocalIndex>(id_iterator - node_ids_.begin());
+    }
+    return kInvalidLocalIndex;
+  }
+
+  ///\brief return the number of edges incident to a node
+  ///\param local_index the local index of the Node
+  ///\return std::size_t
+  [[nodiscard]] std::size_t degree(LocalIndex local_index) const {
+    modern_cpp_template_assert(local_index < node_ids_.size());
+    return offsets_[local_index + 1] - offsets_[local_index];
+  }
+
+  ///\brief Return the neighbors (local indices) of a node
+  ///\param local_index the local index of the Node
+  ///\return std::span<LocalIndex const>
+  [[nodiscard]] std::span<LocalIndex const> neighbors(
+      LocalIndex local_index) const {
+    return targets_.subspan(offsets_[local_index], degree(local_index));
+  }
+
+  ///\brief Return the edge costs of a node - parallel to neighbors()
+  ///\param local_index the local index of the Node
+  ///\return std::span<CostType const>
+  [[nodiscard]] std::span<CostType const> neighbor_costs(
+      LocalIndex local_index) const {
+    return costs_.subspan(offsets_[local_index], degree(local_index));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  ///\see CsrGraph::breadth_first_search
+  void breadth_first_search(
+      NodeIndex start_node_index,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    VisitationContext context;
+    breadth_first_search(start_node_index, context, std::move(callback));
+  }
+
+  ///\brief Perform the BFS (breadth first search) algorithm on the graph
+  /// reusing a caller supplied visitation context
+  ///\see CsrGraph::breadth_first_search
+  void breadth_first_search(
+      NodeIndex start_node_index, VisitationContext& context,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    auto start_local = find_local(start_node_index);
+    modern_cpp_template_assert_message(start_local != kInvalidLocalIndex,
+                                       "start node is not in the graph");
+    if (start_local == kInvalidLocalIndex) {
+      return;
+    }
+    context.reset(number_of_nodes());
+    context.visit(start_local);
+    if (callback != nullptr) {
+      callback(node(start_local));
+    }
+    context.push(start_local);
+    while (!context.empty()) {
+      for (auto tail_local : neighbors(context.pop())) {
+        if (context.visit(tail_local)) {
+          if (callback != nullptr) {
+            if (callback(node(tail_local))) {
+              return;
+            }
+          }
+          context.push(tail_local);
+        }
+      }
+    }
+  }
+
+ private:
+  template <typename Element>
+  [[nodiscard]] std::span<Element const> section(
+      Header const& header, Header::Section which,
+      std::uint64_t expected_count, std::filesystem::path const& path) const {
+    auto const& extent = header.sections[which];
+    if (extent.offset % kGraphFileAlignment != 0 ||
+        extent.offset > mapping_size_ ||
+        extent.size > mapping_size_ - extent.offset ||
+        // a count from the header can overflow the size in bytes
+        expected_count > (mapping_size_ - extent.offset) / sizeof(Element) ||
+        extent.size != expected_count * sizeof(Element)) {
+      internal::throw_graph_file_error(path, "corrupt section table");
+    }
+    // sections are aligned and the mapping is page aligned
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto const* first = reinterpret_cast<Element const*>(
+        static_cast<char const*>(mapping_) + extent.offset);
+    return {first, expected_count};
+  }
+
+  void bind_sections(std::filesystem::path const& path) {
+    Header header;
+    std::memcpy(&header, mapping_, sizeof(Header));
+    if (header.magic != kGraphFileMagic) {
+      internal::throw_graph_file_error(path, "not a graph file");
+    }
+    if (header.endianness != kGraphFileEndianness) {
+      internal::throw_graph_file_error(path,
+                                       "written with a different byte order");
+    }
+    if (header.version != kGraphFileVersion) {
+      internal::throw_graph_file_error(
+          path, "unsupported version " + std::to_string(header.version));
+    }
+    if (header.cost_type_tag !=
+        internal::graph_file_cost_type_tag<CostType>()) {
+      internal::throw_graph_file_error(path, "edge cost type mismatch");
+    }
+    if (header.value_type_tag != Codec::kTypeTag) {
+      internal::throw_graph_file_error(path, "node value type mismatch");
+    }
+    if (header.number_of_nodes >=
+        static_cast<std::uint64_t>(kInvalidLocalIndex)) {
+      internal::throw_graph_file_error(path, "too many nodes");
+    }
+
+    auto const nodes = header.number_of_nodes;
+    auto const edges = header.number_of_edges;
+    node_ids_ = section<NodeIndex>(header, Header::kNodeIds, nodes, path);
+    offsets_ = section<EdgeOffset>(header, Header::kOffsets, nodes + 1, path);
+    targets_ = section<LocalIndex>(header, Header::kTargets, edges, path);
+    costs_ = section<CostType>(header, Header::kCosts, edges, path);
+    value_offsets_ =
+        section<std::uint64_t>(header, Header::kValueOffsets, nodes + 1, path);
+    value_blob_ = section<char>(header, Header::kValueBlob,
+                                header.sections[Header::kValueBlob].size, path);
+    if (offsets_.front() != 0 || offsets_.back() != edges ||
+        value_offsets_.front() != 0 ||
+        value_offsets_.back() != value_blob_.size()) {
+      internal::throw_graph_file_error(path, "corrupt offsets");
+    }
+  }
+
+  void swap(MappedGraph& other) noexcept {
+    std::swap(mapping_, other.mapping_);
+    std::swap(mapping_size_, other.mapping_size_);
+    std::swap(node_ids_, other.node_ids_);
+    std::swap(offsets_, other.offsets_);
+    std::swap(targets_, other.targets_);
+    std::swap(costs_, other.costs_);
+    std::swap(value_offsets_, other.value_offsets_);
+    std::swap(value_blob_, other.value_blob_);
+  }
+
+  void unmap() noexcept {
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mapping_size_);
+      mapping_ = nullptr;
+      mapping_size_ = 0;
+    }
+    node_ids_ = {};
+    offsets_ = {};
+    targets_ = {};
+    costs_ = {};
+    value_offsets_ = {};
+    value_blob_ = {};
+  }
+
+  void* mapping_{nullptr};
+  std::size_t mapping_size_{0};
+  std::span<NodeIndex const> node_ids_{};
+  std::span<EdgeOffset const> offsets_{};
+  std::span<LocalIndex const> targets_{};
+  std::span<CostType const> costs_{};
+  std::span<std::uint64_t const> value_offsets_{};
+  std::span<char const> value_blob_{};
+};
+
+///\brief GraphTraits for MappedGraph - vertices are local indices, so every
+/// GraphTraits based algorithm runs directly on the mapped file
+template <typename NodeValue, typename CostType_T>
+struct GraphTraits<MappedGraph<NodeValue, CostType_T>> {
+  using Graph = MappedGraph<NodeValue, CostType_T>;
+  using NodeIndex = typename Graph::NodeIndex;
+  using Vertex = typename Graph::LocalIndex;
+  using CostType = CostType_T;
+  static constexpr Vertex kInvalidVertex{Graph::kInvalidLocalIndex};
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    auto local_index = graph.find_local(node_index);
+    modern_cpp_template_assert_message(local_index != kInvalidVertex,
+                                       "node is not in the graph");
+    return local_index;
+  }
+
+  [[nodiscard]] static NodeIndex node_index(Graph const& graph,
+                                            Vertex vertex) {
+    return graph.original_id(vertex);
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    auto neighbors = graph.neighbors(vertex);
+    auto costs = graph.neighbor_costs(vertex);
+    for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+      function(neighbors[edge], costs[edge]);
+    }
+  }
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,171 @@
+///\file neighborhood.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief k-hop neighborhoods: every node within a given number of edges
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/visitation_context.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The nodes within a radius of a source, grouped by hop distance
+/// Filled by k_hop_neighborhood().  Both vectors keep their capacity when
+/// the buffer is refilled, so reusing one Neighborhood per thread makes
+/// repeated queries allocation free once it has grown to the largest answer.
+///\tparam Graph the searched graph type
+template <typename Graph>
+struct Neighborhood {
+  using Vertex = typename GraphTraits<Graph>::Vertex;
+
+  ///\brief the reached vertices in BFS order, the source first; the node id
+  /// for an UndirectedGraph, the local index for a CsrGraph
+  std::vector<Vertex> vertices{};
+  ///\brief the vertices at distance d are
+  /// vertices[level_offsets[d], level_offsets[d + 1])
+  std::vector<std::size_t> level_offsets{};
+
+  ///\brief return the number of reached vertices, the source included
+  [[nodiscard]] std::size_t size() const { return vertices.size(); }
+
+  ///\brief return the number of non-empty levels, i.e. the largest distance
+  /// reached plus one
+  [[nodiscard]] std::size_t number_of_levels() const {
+    return level_offsets.empty() ? 0 : level_offsets.size() - 1;
+  }
+
+  ///\brief Return the vertices at one distance from the source
+  ///\param distance the distance, below number_of_levels()
+  ///\return std::span<Vertex const>
+  [[nodiscard]] std::span<Vertex const> level(std::size_t distance) const {
+    modern_cpp_template_assert(distance < number_of_levels());
+    return std::span<Vertex const>(vertices).subspan(
+        level_offsets[distance],
+        level_offsets[distance + 1] - level_offsets[distance]);
+  }
+};
+
+///\brief Find every node within radius edges of a source
+/// A level-synchronous BFS that uses the output buffer as its queue: the
+/// frontier of distance d is the slice of level d, and vertices discovered
+/// from it are appended as level d + 1.  Vertices at the radius are never
+/// expanded, so the cost is bounded by the edges of the nodes closer than
+/// the radius, however large the graph is.  The visited state comes from a
+/// reusable VisitationContext, so starting a query is O(1).  A removed
+/// source reaches nothing, not even itself, so its neighborhood is empty.
+///\tparam Graph any graph type with a GraphTraits specialization
+///\param graph the graph to search
+///\param source_node_index the id of the source node
+///\param radius the largest hop distance to report; 0 returns the source
+///\param context the visitation context; it is reset by this call
+///\param neighborhood the output buffer; its previous contents are replaced
+template <typename Graph>
+void k_hop_neighborhood(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex source_node_index,
+    std::size_t radius,
+    VisitationContext<typename GraphTraits<Graph>::Vertex>& context,
+    Neighborhood<Graph>& neighborhood) {
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+
+  auto& vertices = neighborhood.vertices;
+  auto& level_offsets = neighborhood.level_offsets;
+  auto const source = Traits::vertex(graph, source_node_index);
+  context.reset(Traits::number_of_nodes(graph));
+  if (is_removed_vertex(graph, source)) {
+    vertices.clear();
+    level_offsets.clear();
+    return;
+  }
+  context.visit(source);
+  vertices.assign(1, source);
+  level_offsets.assign({0, 1});
+  for (std::size_t distance = 0; distance < radius; ++distance) {
+    auto const level_end = level_offsets.back();
+    for (auto position = level_offsets[distance]; position < level_end;
+         ++position) {
+      Traits::for_each_neighbor(graph, vertices[position],
+                                [&](Vertex target, CostType /*cost*/) {
+                                  if (context.visit(target)) {
+                                    vertices.push_back(target);
+                                  }
+                                });
+    }
+    if (vertices.size() == level_end) {
+      break;
+    }
+    level_offsets.push_back(vertices.size());
+  }
+}
+
+///\brief Find the k-hop neighborhood of each of a batch of sources
+/// The sources are answered one after the other, sharing one context.
+///\param graph the graph to search
+///\param sources the ids of the source nodes; duplicates are allowed
+///\param radius the largest hop distance to report
+///\param context the visitation context
+///\param neighborhoods resized to one output buffer per source, in input
+/// order; existing buffers are reused
+template <typename Graph>
+void k_hop_neighborhoods(
+    Graph const& graph,
+    std::span<typename GraphTraits<Graph>::NodeIndex const> sources,
+    std::size_t radius,
+    VisitationContext<typename GraphTraits<Graph>::Vertex>& context,
+    std::vector<Neighborhood<Graph>>& neighborhoods) {
+  neighborhoods.resize(sources.size());
+  for (std::size_t source = 0; source < sources.size(); ++source) {
+    k_hop_neighborhood(graph, sources[source], radius, context,
+                       neighborhoods[source]);
+  }
+}
+
+///\brief Find the k-hop neighborhood of each of a batch of sources in
+/// parallel
+/// The threads take sources one at a time from a shared counter, so a few
+/// sources next to high degree nodes do not hold up one thread's share.
+/// Each thread searches with its own context.
+///\param graph the graph to search
+///\param sources the ids of the source nodes; duplicates are allowed
+///\param radius the largest hop distance to report
+///\param pool the threads to use
+///\param contexts at least pool.size() visitation contexts, one per thread
+///\param neighborhoods resized to one output buffer per source, in input
+/// order; existing buffers are reused
+template <typename Graph>
+void k_hop_neighborhoods(
+    Graph const& graph,
+    std::span<typename GraphTraits<Graph>::NodeIndex const> sources,
+    std::size_t radius, WorkerPool& pool,
+    std::span<VisitationContext<typename GraphTraits<Graph>::Vertex>>
+        contexts,
+    std::vector<Neighborhood<Graph>>& neighborhoods) {
+  modern_cpp_template_assert_message(contexts.size() >= pool.size(),
+                                     "one visitation context per thread");
+  neighborhoods.resize(sources.size());
+  std::atomic<std::size_t> next_source{0};
+  pool.run([&](std::size_t thread_index) {
+    auto& context = contexts[thread_index];
+    for (auto source = next_source.fetch_add(1, std::memory_order_relaxed);
+         source < sources.size();
+         source = next_source.fetch_add(1, std::memory_order_relaxed)) {
+      k_hop_neighborhood(graph, sources[source], radius, context,
+                         neighborhoods[source]);
+    }
+  });
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,270 @@
+///\file page_rank.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Pull-based, multi-threaded sparse matrix-vector products and
+/// PageRank over a CsrGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief Tuning parameters of page_rank()
+struct PageRankParameters {
+  ///\brief The probability of following an edge rather than jumping to a
+  /// random node
+  double damping{0.85};
+  ///\brief Stop once the L1 norm of the change of the ranks in one iteration
+  /// drops below this value
+  double tolerance{1e-6};
+  ///\brief Stop after this many iterations even if not converged
+  std::size_t max_iterations{100};
+};
+
+///\brief The result of page_rank(), indexed by local index
+///\tparam Real float or double
+template <typename Real>
+struct PageRankResult {
+  ///\brief The rank of every node; the ranks sum to one
+  std::vector<Real> ranks{};
+  ///\brief The number of iterations run
+  std::size_t iterations{0};
+  ///\brief The L1 norm of the change in the last iteration
+  Real error{0};
+};
+
+namespace internal {
+
+///\brief A per-thread partial sum on its own cache line
+template <typename Real>
+struct alignas(64) ThreadPartialSum {
+  Real value{0};
+};
+
+///\brief Convert a value to Real without a cast when it already is one
+template <typename Real, typename Value>
+[[nodiscard]] constexpr Real as_real(Value value) {
+  if constexpr (std::is_same_v<Real, Value>) {
+    return value;
+  } else {
+    return static_cast<Real>(value);
+  }
+}
+
+///\brief The default matrix entry of an edge: its cost
+template <typename Real>
+struct CostWeight {
+  template <typename CostType>
+  Real operator()(CostType cost) const {
+    return as_real<Real>(cost);
+  }
+};
+
+///\brief Split the rows of a graph into one contiguous range per thread
+/// holding about the same number of edges
+/// A pull-based product writes only the rows of its own range, so the
+/// threads never write to the same element and need no atomics.
+///\param offsets the number_of_nodes() + 1 row offsets of the graph
+///\param num_parts the number of ranges
+///\return num_parts + 1 row boundaries
+template <typename EdgeOffset>
+[[nodiscard]] std::vector<std::size_t> edge_balanced_rows(
+    std::span<EdgeOffset const> offsets, std::size_t num_parts) {
+  auto const number_of_nodes = offsets.size() - 1;
+  // count a node as one edge, so that runs of isolated nodes are split too
+  auto const total = offsets.back() + number_of_nodes;
+  std::vector<std::size_t> boundaries;
+  boundaries.reserve(num_parts + 1);
+  boundaries.push_back(0);
+  for (std::size_t part = 1; part < num_parts; ++part) {
+    auto const target = total * part / num_parts;
+    std::size_t low{boundaries.back()};
+    std::size_t high{number_of_nodes};
+    while (low < high) {
+      auto const middle = low + (high - low) / 2;
+      if (offsets[middle] + middle < target) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    boundaries.push_back(low);
+  }
+  boundaries.push_back(number_of_nodes);
+  return boundaries;
+}
+
+}  // namespace internal
+
+///\brief Multiply the weighted adjacency matrix of a graph with a vector
+/// with multiple threads: output[u] = sum of weight(cost) * input[v] over the
+/// edges u - v.  Rows are pulled, i.e. every thread computes whole output
+/// rows from its edge-balanced range, so there are no atomics.  Parallel
+/// edges add up.
+///\tparam Real float or double
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\tparam Weight callable converting an edge cost into a matrix entry
+///\param graph the graph whose adjacency is the matrix
+///\param input the vector, indexed by local index
+///\param output the product, indexed by local index
+///\param pool the worker threads to run on
+///\param weight the matrix entry of an edge; by default its cost
+template <typename Real, typename NodeValue, typename CostType,
+          typename Weight = internal::CostWeight<Real>>
+void sparse_matrix_vector_product(CsrGraph<NodeValue, CostType> const& graph,
+                                  std::span<Real const> input,
+                                  std::span<Real> output, WorkerPool& pool,
+                                  Weight weight = {}) {
+  static_assert(std::is_floating_point_v<Real>, "Real must be float or double");
+  auto const number_of_nodes = graph.number_of_nodes();
+  modern_cpp_template_assert(input.size() == number_of_nodes &&
+                             output.size() == number_of_nodes);
+  auto const offsets = graph.offsets();
+  auto const targets = graph.targets();
+  auto const costs = graph.costs();
+  auto const rows = internal::edge_balanced_rows(offsets, pool.size());
+  pool.run([&](std::size_t thread_index) {
+    for (auto row = rows[thread_index]; row < rows[thread_index + 1]; ++row) {
+      Real sum{0};
+      for (auto edge = offsets[row]; edge < offsets[row + 1]; ++edge) {
+        sum += weight(costs[edge]) * input[targets[edge]];
+      }
+      output[row] = sum;
+    }
+  });
+}
+
+///\brief Compute the PageRank of every node with multiple threads
+/// Power iteration in pull form: every iteration first scales each rank by
+/// the inverse degree of its node, then every node sums the scaled ranks of
+/// its neighbors.  Rank on nodes without edges is spread evenly over all
+/// nodes.  Each thread owns an edge-balanced range of nodes for both steps,
+/// so the hot loop has no atomics; the threads meet at a barrier after each
+/// step, and the per-thread partial sums live on separate cache lines.
+/// Edges count with their multiplicity and their costs are ignored.
+///\tparam Real float or double - float halves the memory traffic of the
+/// rank vectors at the cost of precision
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to rank
+///\param pool the worker threads to run on
+///\param parameters the damping factor and the stopping criteria
+///\return PageRankResult<Real> the ranks, indexed by local index
+template <typename Real = double, typename NodeValue, typename CostType>
+[[nodiscard]] PageRankResult<Real> page_rank(
+    CsrGraph<NodeValue, CostType> const& graph, WorkerPool& pool,
+    PageRankParameters const& parameters = {}) {
+  static_assert(std::is_floating_point_v<Real>, "Real must be float or double");
+  modern_cpp_template_assert_message(
+      parameters.damping >= 0.0 && parameters.damping <= 1.0,
+      "damping must be in [0, 1]");
+  modern_cpp_template_assert_message(parameters.max_iterations > 0,
+                                     "at least one iteration is needed");
+  auto const number_of_nodes = graph.number_of_nodes();
+  PageRankResult<Real> result;
+  if (number_of_nodes == 0) {
+    return result;
+  }
+
+  auto const offsets = graph.offsets();
+  auto const targets = graph.targets();
+  auto const nodes = static_cast<Real>(number_of_nodes);
+  auto const damping = internal::as_real<Real>(parameters.damping);
+  auto const rows = internal::edge_balanced_rows(offsets, pool.size());
+
+  result.ranks.assign(number_of_nodes, Real{1} / nodes);
+  std::vector<Real> next_ranks(number_of_nodes);
+  std::vector<Real> contributions(number_of_nodes);
+  std::vector<internal::ThreadPartialSum<Real>> dangling(pool.size());
+  std::vector<internal::ThreadPartialSum<Real>> errors(pool.size());
+  // the rank every node receives before its in-links - the teleport share
+  // plus the spread dangling rank - and the convergence test: both are
+  // decided once per iteration from the summed partials, so every thread
+  // agrees on them
+  Real base{0};
+  bool is_finished{false};
+
+  std::barrier contributions_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        Real dangling_rank{0};
+        for (auto const& partial : dangling) {
+          dangling_rank += partial.value;
+        }
+        base = (Real{1} - damping) / nodes + damping * dangling_rank / nodes;
+      });
+  std::barrier ranks_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        Real error{0};
+        for (auto const& partial : errors) {
+          error += partial.value;
+        }
+        result.ranks.swap(next_ranks);
+        result.error = error;
+        ++result.iterations;
+        is_finished =
+            error < internal::as_real<Real>(parameters.tolerance) ||
+            result.iterations >= parameters.max_iterations;
+      });
+
+  pool.run([&](std::size_t thread_index) {
+    auto const first_row = rows[thread_index];
+    auto const last_row = rows[thread_index + 1];
+    while (!is_finished) {
+      Real dangling_rank{0};
+      for (auto row = first_row; row < last_row; ++row) {
+        auto const degree = offsets[row + 1] - offsets[row];
+        if (degree == 0) {
+          dangling_rank += result.ranks[row];
+          contributions[row] = Real{0};
+        } else {
+          contributions[row] = result.ranks[row] / static_cast<Real>(degree);
+        }
+      }
+      dangling[thread_index].value = dangling_rank;
+      contributions_barrier.arrive_and_wait();
+
+      Real error{0};
+      for (auto row = first_row; row < last_row; ++row) {
+        Real sum{0};
+        for (auto edge = offsets[row]; edge < offsets[row + 1]; ++edge) {
+          sum += contributions[targets[edge]];
+        }
+        auto const rank = base + damping * sum;
+        error += std::abs(rank - result.ranks[row]);
+        next_ranks[row] = rank;
+      }
+      errors[thread_index].value = error;
+      ranks_barrier.arrive_and_wait();
+    }
+  });
+  return result;
+}
+
+///\brief Compute the PageRank of every node on the calling thread
+///\see page_rank(graph, pool, parameters)
+template <typename Real = double, typename NodeValue, typename CostType>
+[[nodiscard]] PageRankResult<Real> page_rank(
+    CsrGraph<NodeValue, CostType> const& graph,
+    PageRankParameters const& parameters = {}) {
+  WorkerPool pool(1);
+  return page_rank<Real>(graph, pool, parameters);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,145 @@
+///\file parallel_bfs.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Multi-threaded level-synchronous breadth first search over a
+/// CsrGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <functional>
+#include <vector>
+
+#include "modern_cpp_template/bitmap.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+namespace internal {
+
+///\internal Number of frontier nodes a thread claims at a time.  Small enough
+/// to balance skewed degrees, large enough to keep the shared cursor cold.
+static constexpr std::size_t kParallelBfsChunkSize{64};
+
+}  // namespace internal
+
+///\brief Perform a multi-threaded, level-synchronous BFS
+/// Each level's frontier is split dynamically across the threads of the pool.
+/// A thread claims a neighbor by atomically setting its bit in a shared
+/// visited bitmap, so every reachable node is discovered exactly once, and
+/// appends it to a thread-local buffer; the buffers are concatenated into the
+/// next frontier at the level barrier.
+///
+/// The callback contract matches UndirectedGraph::breadth_first_search with
+/// two differences: the callback is invoked concurrently from several threads
+/// and must therefore be thread-safe, and the order of nodes within a level is
+/// unspecified.  Nodes are still reported level by level.  As soon as any
+/// thread's callback returns true, no further callbacks are started and the
+/// search terminates.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to search
+///\param start_node_index the original id of the Node to start at
+///\param pool the worker threads to run on
+///\param callback the optional, thread-safe function to call to process each
+/// new node found in the search.  If the function returns true, then this
+/// algorithm is terminated early.
+template <typename NodeValue, typename CostType>
+void parallel_breadth_first_search(
+    CsrGraph<NodeValue, CostType> const& graph,
+    typename CsrGraph<NodeValue, CostType>::NodeIndex start_node_index,
+    WorkerPool& pool,
+    std::function<bool(typename CsrGraph<NodeValue, CostType>::Node const&)>
+        callback = nullptr) {
+  using Graph = CsrGraph<NodeValue, CostType>;
+  using LocalIndex = typename Graph::LocalIndex;
+
+  auto start_local = graph.find_local(start_node_index);
+  modern_cpp_template_assert_message(start_local != Graph::kInvalidLocalIndex,
+                                     "start node is not in the graph");
+  if (start_local == Graph::kInvalidLocalIndex) {
+    return;
+  }
+
+  auto const number_of_nodes = graph.number_of_nodes();
+  AtomicBitmap is_visited(number_of_nodes);
+  is_visited.try_set(start_local);
+  if (callback != nullptr) {
+    callback(graph.node(start_local));
+  }
+
+  // both frontiers are sized for the worst case up front so that threads can
+  // write their local buffers into disjoint slots without locking
+  std::vector<LocalIndex> frontier(number_of_nodes);
+  std::vector<LocalIndex> next_frontier(number_of_nodes);
+  frontier[0] = start_local;
+  std::size_t frontier_size{1};
+  std::atomic<std::size_t> next_frontier_size{0};
+  std::atomic<std::size_t> frontier_cursor{0};
+  std::atomic<bool> is_stopped{false};
+  BarrierJobException job_exception;
+  // only written by the barrier completion so that every thread takes the
+  // same decision to leave the level loop
+  bool is_finished{false};
+
+  std::barrier level_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        frontier.swap(next_frontier);
+        frontier_size = next_frontier_size.load(std::memory_order_relaxed);
+        next_frontier_size.store(0, std::memory_order_relaxed);
+        frontier_cursor.store(0, std::memory_order_relaxed);
+        is_finished = frontier_size == 0 ||
+                      is_stopped.load(std::memory_order_relaxed) ||
+                      job_exception.has_exception();
+      });
+
+  pool.run([&](std::size_t /*thread_index*/) {
+    std::vector<LocalIndex> local_next;
+    while (!is_finished) {
+      local_next.clear();
+      // a throwing callback must not keep this thread from the barrier
+      job_exception.capture([&] {
+        while (true) {
+          auto begin = frontier_cursor.fetch_add(
+              internal::kParallelBfsChunkSize, std::memory_order_relaxed);
+          if (begin >= frontier_size) {
+            break;
+          }
+          auto end =
+              std::min(begin + internal::kParallelBfsChunkSize, frontier_size);
+          for (auto position = begin; position < end; ++position) {
+            for (auto neighbor : graph.neighbors(frontier[position])) {
+              if (is_stopped.load(std::memory_order_relaxed)) {
+                break;
+              }
+              if (!is_visited.try_set(neighbor)) {
+                continue;
+              }
+              if (callback != nullptr && callback(graph.node(neighbor))) {
+                is_stopped.store(true, std::memory_order_relaxed);
+                break;
+              }
+              local_next.push_back(neighbor);
+            }
+          }
+        }
+      });
+      auto offset = next_frontier_size.fetch_add(local_next.size(),
+                                                 std::memory_order_relaxed);
+      std::copy(local_next.begin(), local_next.end(),
+                next_frontier.begin() + static_cast<std::ptrdiff_t>(offset));
+      level_barrier.arrive_and_wait();
+    }
+  });
+  job_exception.rethrow_if_any();
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
@@ -0,0 +1,320 @@
+///\file priority_queues.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Min priority queues for label-setting shortest path algorithms
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+// All queues share one interface so the shortest path algorithms can take the
+// queue as a template template parameter:
+//   explicit Queue(std::size_t capacity)  - capacity is a hint, or for the
+//                                            PairingHeap the range of values
+//   void push(Key key, Value value)
+//   bool empty() const / std::size_t size() const
+//   Entry top()                             - the entry with the smallest key
+//   void pop()
+//   static constexpr bool kSupportsDecreaseKey
+//   bool contains(Value) / void decrease_key(Value, Key)
+//                                           - only if kSupportsDecreaseKey
+// Queues without decrease-key are used "lazily": a value is pushed again with
+// its smaller key and the stale entry is skipped when it reaches the top.
+
+///\brief Binary min-heap with lazy deletion
+///\tparam Key the priority type
+///\tparam Value the payload type, usually a vertex index
+template <typename Key, typename Value>
+class BinaryHeap {
+ public:
+  using Entry = std::pair<Key, Value>;
+  static constexpr bool kSupportsDecreaseKey{false};
+
+  ///\brief Construct an empty BinaryHeap
+  ///\param capacity the number of entries to reserve
+  explicit BinaryHeap(std::size_t capacity = 0) {
+    std::vector<Entry> storage;
+    storage.reserve(capacity);
+    heap_ = Heap(std::greater<Entry>{}, std::move(storage));
+  }
+
+  void push(Key key, Value value) { heap_.emplace(key, value); }
+
+  [[nodiscard]] bool empty() const { return heap_.empty(); }
+
+  [[nodiscard]] std::size_t size() const { return heap_.size(); }
+
+  [[nodiscard]] Entry top() const {
+    modern_cpp_template_assert(!empty());
+    return heap_.top();
+  }
+
+  void pop() {
+    modern_cpp_template_assert(!empty());
+    heap_.pop();
+  }
+
+ private:
+  using Heap =
+      std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>;
+  Heap heap_{};
+};
+
+///\brief Monotone radix heap for non-negative integer keys
+/// Entries live in buckets indexed by the highest bit in which their key
+/// differs from the last key removed, so push is O(1) and every entry moves
+/// between buckets at most once per bit - O(log C) amortized per pop for a
+/// maximum edge cost C.  Keys pushed must not be smaller than the last key
+/// removed, which always holds for Dijkstra with non-negative costs.  See
+/// Ahuja et al., "Faster Algorithms for the Shortest Path Problem" (1990).
+///\tparam Key the priority type; must be integral
+///\tparam Value the payload type, usually a vertex index
+template <typename Key, typename Value>
+class RadixHeap {
+  static_assert(std::is_integral_v<Key>, "RadixHeap requires integer keys");
+  using UnsignedKey = std::make_unsigned_t<Key>;
+  static constexpr std::size_t kNumberOfBuckets{
+      std::numeric_limits<UnsignedKey>::digits + 1};
+
+ public:
+  using Entry = std::pair<Key, Value>;
+  static constexpr bool kSupportsDecreaseKey{false};
+
+  ///\brief Construct an empty RadixHeap
+  ///\param capacity the number of entries to reserve in the first bucket
+  explicit RadixHeap(std::size_t capacity = 0) {
+    buckets_[0].reserve(std::min<std::size_t>(capacity, 64));
+  }
+
+  void push(Key key, Value value) {
+    modern_cpp_template_assert_message(
+        key >= 0 && static_cast<UnsignedKey>(key) >= last_key_,
+        "RadixHeap keys must be monotone and non-negative");
+    buckets_[bucket_of(static_cast<UnsignedKey>(key))].emplace_back(key,
+                                                                    value);
+    ++size_;
+  }
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  [[nodiscard]] Entry top() {
+    modern_cpp_template_assert(!empty());
+    refill();
+    return buckets_[0].back();
+  }
+
+  void pop() {
+    modern_cpp_template_assert(!empty());
+    refill();
+    buckets_[0].pop_back();
+    --size_;
+  }
+
+ private:
+  [[nodiscard]] std::size_t bucket_of(UnsignedKey key) const {
+    return static_cast<std::size_t>(std::bit_width(key ^ last_key_));
+  }
+
+  ///\internal Make bucket 0 hold the entries with the smallest key by
+  /// redistributing the first non-empty bucket around its minimum
+  void refill() {
+    if (!buckets_[0].empty()) {
+      return;
+    }
+    std::size_t bucket{1};
+    while (buckets_[bucket].empty()) {
+      ++bucket;
+    }
+    auto& source = buckets_[bucket];
+    last_key_ = static_cast<UnsignedKey>(
+        std::min_element(source.begin(), source.end(),
+                         [](Entry const& lhs, Entry const& rhs) {
+                           return lhs.first < rhs.first;
+                         })
+            ->first);
+    for (auto const& entry : source) {
+      buckets_[bucket_of(static_cast<UnsignedKey>(entry.first))].push_back(
+          entry);
+    }
+    source.clear();
+  }
+
+  std::array<std::vector<Entry>, kNumberOfBuckets> buckets_{};
+  UnsignedKey last_key_{0};
+  std::size_t size_{0};
+};
+
+///\brief Pairing heap with decrease-key, addressed by value
+/// Values must be integers in [0, capacity) - typically vertex indices - and
+/// each value may be in the heap at most once.  The nodes live in one array
+/// indexed by value, so decrease_key needs no handle and the heap never
+/// allocates per entry.  Pop uses the standard two-pass pairing, see Fredman
+/// et al., "The pairing heap: A new form of self-adjusting heap" (1986).
+///\tparam Key the priority type
+///\tparam Value the payload type; must be integral
+template <typename Key, typename Value>
+class PairingHeap {
+  static_assert(std::is_integral_v<Value>,
+                "PairingHeap values must be integer indices");
+
+ public:
+  using Entry = std::pair<Key, Value>;
+  static constexpr bool kSupportsDecreaseKey{true};
+
+  ///\brief Construct an empty PairingHeap
+  ///\param capacity the values that can be stored are in [0, capacity)
+  explicit PairingHeap(std::size_t capacity = 0) : nodes_(capacity) {}
+
+  void push(Key key, Value value) {
+    auto position = position_of(value);
+    if (position >= nodes_.size()) {
+      nodes_.resize(position + 1);
+    }
+    modern_cpp_template_assert_message(!nodes_[position].is_in_heap,
+                                       "value is already in the heap");
+    nodes_[position] = HeapNode{key, kNil, kNil, kNil, true};
+    root_ = meld(root_, position);
+    ++size_;
+  }
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  [[nodiscard]] bool contains(Value value) const {
+    auto position = position_of(value);
+    return position < nodes_.size() && nodes_[position].is_in_heap;
+  }
+
+  [[nodiscard]] Entry top() const {
+    modern_cpp_template_assert(!empty());
+    return {nodes_[root_].key, static_cast<Value>(root_)};
+  }
+
+  void pop() {
+    modern_cpp_template_assert(!empty());
+    auto& old_root = nodes_[root_];
+    old_root.is_in_heap = false;
+
+    siblings_.clear();
+    for (auto child = old_root.child; child != kNil;) {
+      auto next = nodes_[child].sibling;
+      nodes_[child].sibling = kNil;
+      nodes_[child].previous = kNil;
+      siblings_.push_back(child);
+      child = next;
+    }
+    old_root.child = kNil;
+
+    // first pass: meld pairs left to right
+    std::size_t pairs{0};
+    for (std::size_t sibling = 0; sibling < siblings_.size(); sibling += 2) {
+      siblings_[pairs++] = sibling + 1 < siblings_.size()
+                               ? meld(siblings_[sibling], siblings_[sibling + 1])
+                               : siblings_[sibling];
+    }
+    // second pass: meld the pairs right to left
+    root_ = kNil;
+    while (pairs > 0) {
+      root_ = meld(siblings_[--pairs], root_);
+    }
+    --size_;
+  }
+
+  ///\brief Lower the key of a value in the heap
+  ///\param value the value; must be in the heap
+  ///\param key the new key; must not be larger than the current key
+  void decrease_key(Value value, Key key) {
+    auto position = position_of(value);
+    modern_cpp_template_assert(contains(value));
+    auto& node = nodes_[position];
+    modern_cpp_template_assert(!(node.key < key));
+    node.key = key;
+    if (position == root_) {
+      return;
+    }
+    // cut the subtree rooted at position and meld it with the root
+    auto& previous = nodes_[node.previous];
+    if (previous.child == position) {
+      previous.child = node.sibling;
+    } else {
+      previous.sibling = node.sibling;
+    }
+    if (node.sibling != kNil) {
+      nodes_[node.sibling].previous = node.previous;
+    }
+    node.sibling = kNil;
+    node.previous = kNil;
+    root_ = meld(root_, position);
+  }
+
+ private:
+  static constexpr std::size_t kNil{std::numeric_limits<std::size_t>::max()};
+
+  struct HeapNode {
+    Key key{};
+    std::size_t child{kNil};
+    ///\internal next sibling to the right
+    std::size_t sibling{kNil};
+    ///\internal left sibling, or the parent for the leftmost child
+    std::size_t previous{kNil};
+    bool is_in_heap{false};
+  };
+
+  [[nodiscard]] static std::size_t position_of(Value value) {
+    if constexpr (std::is_signed_v<Value>) {
+      modern_cpp_template_assert(value >= 0);
+    }
+    return static_cast<std::size_t>(value);
+  }
+
+  ///\internal Meld two heap roots, returning the new root
+  std::size_t meld(std::size_t lhs, std::size_t rhs) {
+    if (lhs == kNil) {
+      return rhs;
+    }
+    if (rhs == kNil) {
+      return lhs;
+    }
+    if (nodes_[rhs].key < nodes_[lhs].key) {
+      std::swap(lhs, rhs);
+    }
+    auto& parent = nodes_[lhs];
+    auto& child = nodes_[rhs];
+    child.previous = lhs;
+    child.sibling = parent.child;
+    if (parent.child != kNil) {
+      nodes_[parent.child].previous = rhs;
+    }
+    parent.child = rhs;
+    parent.sibling = kNil;
+    parent.previous = kNil;
+    return lhs;
+  }
+
+  std::vector<HeapNode> nodes_{};
+  std::vector<std::size_t> siblings_{};
+  std::size_t root_{kNil};
+  std::size_t size_{0};
+};
+
+}  // namespace modern_cpp_template::algorithms
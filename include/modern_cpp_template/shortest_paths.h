@@ -0,0 +1,329 @@
+///\file shortest_paths.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Weighted shortest paths (Dijkstra) over the Edge costs of a graph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/priority_queues.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief Single-source shortest path distances and the shortest path tree
+/// Both vectors are indexed by GraphTraits<Graph>::Vertex - the node id for an
+/// UndirectedGraph and the local index for a CsrGraph.
+///\tparam Graph the searched graph type
+template <typename Graph>
+struct ShortestPathTree {
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+
+  ///\brief Distance of a node that is not reachable from the source
+  static constexpr CostType kUnreachable{std::numeric_limits<CostType>::max()};
+  ///\brief Predecessor of the source and of unreachable nodes
+  static constexpr Vertex kNoPredecessor{Traits::kInvalidVertex};
+
+  ///\brief the distance of every vertex from the source
+  std::vector<CostType> distances{};
+  ///\brief the previous vertex on a shortest path from the source
+  std::vector<Vertex> predecessors{};
+};
+
+///\brief One shortest path between two nodes
+///\tparam Graph the searched graph type
+template <typename Graph>
+struct ShortestPath {
+  using NodeIndex = typename GraphTraits<Graph>::NodeIndex;
+  using CostType = typename GraphTraits<Graph>::CostType;
+
+  ///\brief the sum of the edge costs along the path
+  CostType distance{};
+  ///\brief the node ids along the path, from the source to the target
+  std::vector<NodeIndex> nodes{};
+};
+
+namespace internal {
+
+///\internal The state of one Dijkstra search, settled one vertex at a time
+/// so that the unidirectional, point-to-point and bidirectional searches can
+/// share it.
+template <typename Graph, template <typename, typename> class Queue>
+class DijkstraSearch {
+ public:
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+  using Tree = ShortestPathTree<Graph>;
+
+  DijkstraSearch(Graph const& graph, Vertex source)
+      : graph_(graph),
+        queue_(Traits::number_of_nodes(graph)),
+        tree_{std::vector<CostType>(Traits::number_of_nodes(graph),
+                                    Tree::kUnreachable),
+              std::vector<Vertex>(Traits::number_of_nodes(graph),
+                                  Tree::kNoPredecessor)} {
+    // a removed source reaches nothing, not even itself
+    if (is_removed_vertex(graph, source)) {
+      return;
+    }
+    mutable_distance(source) = CostType{0};
+    queue_.push(CostType{0}, source);
+  }
+
+  ///\internal return true once every reachable vertex is settled
+  [[nodiscard]] bool is_done() {
+    discard_stale_entries();
+    return queue_.empty();
+  }
+
+  ///\internal the distance of the next vertex to settle; requires !is_done()
+  [[nodiscard]] CostType next_distance() {
+    discard_stale_entries();
+    return queue_.top().first;
+  }
+
+  ///\internal Settle the closest unsettled vertex and relax its edges
+  ///\param on_improve called as on_improve(neighbor, distance) whenever the
+  /// distance of a neighbor is lowered
+  ///\return Vertex the settled vertex; requires !is_done()
+  template <typename Function>
+  Vertex settle_next(Function&& on_improve) {
+    discard_stale_entries();
+    auto [vertex_distance, vertex] = queue_.top();
+    queue_.pop();
+    Traits::for_each_neighbor(
+        graph_, vertex, [&](Vertex neighbor, CostType cost) {
+          modern_cpp_template_assert_message(!(cost < CostType{0}),
+                                             "edge costs must be non-negative");
+          CostType candidate = vertex_distance + cost;
+          auto& neighbor_distance = mutable_distance(neighbor);
+          if (!(candidate < neighbor_distance)) {
+            return;
+          }
+          if constexpr (Queue<CostType, Vertex>::kSupportsDecreaseKey) {
+            if (queue_.contains(neighbor)) {
+              queue_.decrease_key(neighbor, candidate);
+            } else {
+              queue_.push(candidate, neighbor);
+            }
+          } else {
+            queue_.push(candidate, neighbor);
+          }
+          neighbor_distance = candidate;
+          tree_.predecessors[static_cast<std::size_t>(neighbor)] = vertex;
+          on_improve(neighbor, candidate);
+        });
+    return vertex;
+  }
+
+  [[nodiscard]] CostType distance(Vertex vertex) const {
+    return tree_.distances[static_cast<std::size_t>(vertex)];
+  }
+
+  [[nodiscard]] Vertex predecessor(Vertex vertex) const {
+    return tree_.predecessors[static_cast<std::size_t>(vertex)];
+  }
+
+  [[nodiscard]] Tree release_tree() { return std::move(tree_); }
+
+ private:
+  CostType& mutable_distance(Vertex vertex) {
+    return tree_.distances[static_cast<std::size_t>(vertex)];
+  }
+
+  ///\internal Drop queue entries superseded by a later, smaller key
+  void discard_stale_entries() {
+    if constexpr (!Queue<CostType, Vertex>::kSupportsDecreaseKey) {
+      while (!queue_.empty()) {
+        auto [key, vertex] = queue_.top();
+        if (!(distance(vertex) < key)) {
+          return;
+        }
+        queue_.pop();
+      }
+    }
+  }
+
+  Graph const& graph_;
+  Queue<CostType, Vertex> queue_;
+  Tree tree_;
+};
+
+///\internal Append the path source -> vertex to nodes, following
+/// predecessors of search
+template <typename Graph, typename Search>
+void append_path_to(Graph const& graph, Search const& search,
+                    typename GraphTraits<Graph>::Vertex vertex,
+                    std::vector<typename GraphTraits<Graph>::NodeIndex>& nodes) {
+  using Traits = GraphTraits<Graph>;
+  auto first = nodes.size();
+  for (; vertex != Traits::kInvalidVertex; vertex = search.predecessor(vertex)) {
+    nodes.push_back(Traits::node_index(graph, vertex));
+  }
+  std::reverse(nodes.begin() + static_cast<std::ptrdiff_t>(first), nodes.end());
+}
+
+}  // namespace internal
+
+///\brief Compute the shortest paths from one node to every other node
+/// Classic label-setting Dijkstra over the Edge costs, which must be
+/// non-negative.  The priority queue is a policy:
+/// - BinaryHeap (default): lazy deletion, works for any cost type
+/// - RadixHeap: integer costs only; O(log C) amortized per pop for maximum
+///   edge cost C, usually the fastest choice for integer costs
+/// - PairingHeap: decrease-key instead of duplicate entries, so the queue
+///   never holds more entries than there are vertices
+///\tparam Queue the priority queue template
+///\tparam Graph UndirectedGraph or CsrGraph
+///\param graph the graph to search
+///\param source the id of the start node; from a removed node every vertex
+/// is unreachable
+///\return ShortestPathTree<Graph>
+template <template <typename, typename> class Queue = BinaryHeap,
+          typename Graph>
+[[nodiscard]] ShortestPathTree<Graph> dijkstra_shortest_paths(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex source) {
+  using Traits = GraphTraits<Graph>;
+  internal::DijkstraSearch<Graph, Queue> search(graph,
+                                                Traits::vertex(graph, source));
+  while (!search.is_done()) {
+    search.settle_next([](auto /*neighbor*/, auto /*distance*/) {});
+  }
+  return search.release_tree();
+}
+
+///\brief Compute a shortest path between two nodes
+/// Runs Dijkstra from the source and stops as soon as the target is settled.
+///\tparam Queue the priority queue template, see dijkstra_shortest_paths
+///\tparam Graph UndirectedGraph or CsrGraph
+///\param graph the graph to search
+///\param source the id of the start node
+///\param target the id of the end node
+///\return std::optional<ShortestPath<Graph>> empty if target is not reachable
+/// or either node is removed
+template <template <typename, typename> class Queue = BinaryHeap,
+          typename Graph>
+[[nodiscard]] std::optional<ShortestPath<Graph>> dijkstra_shortest_path(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex source,
+    typename GraphTraits<Graph>::NodeIndex target) {
+  using Traits = GraphTraits<Graph>;
+  auto target_vertex = Traits::vertex(graph, target);
+  if (is_removed_vertex(graph, target_vertex)) {
+    return std::nullopt;
+  }
+  internal::DijkstraSearch<Graph, Queue> search(graph,
+                                                Traits::vertex(graph, source));
+  while (!search.is_done()) {
+    auto vertex =
+        search.settle_next([](auto /*neighbor*/, auto /*distance*/) {});
+    if (vertex == target_vertex) {
+      ShortestPath<Graph> path{search.distance(target_vertex), {}};
+      internal::append_path_to(graph, search, target_vertex, path.nodes);
+      return path;
+    }
+  }
+  return std::nullopt;
+}
+
+///\brief Compute a shortest path between two nodes with a bidirectional
+/// search
+/// Alternates a forward search from the source and a backward search from
+/// the target, always advancing the side whose next vertex is closer.  Every
+/// time either side lowers the label of a vertex already labelled by the
+/// other side, the sum of the two labels is a candidate for the best
+/// source-target distance mu; the search stops once the two next distances
+/// add up to at least mu.  On road-like graphs the two searches together
+/// settle far fewer vertices than one search growing a ball to the full
+/// distance.
+///\tparam Queue the priority queue template, see dijkstra_shortest_paths
+///\tparam Graph UndirectedGraph or CsrGraph
+///\param graph the graph to search
+///\param source the id of the start node
+///\param target the id of the end node
+///\return std::optional<ShortestPath<Graph>> empty if target is not reachable
+/// or either node is removed
+template <template <typename, typename> class Queue = BinaryHeap,
+          typename Graph>
+[[nodiscard]] std::optional<ShortestPath<Graph>>
+bidirectional_dijkstra_shortest_path(
+    Graph const& graph, typename GraphTraits<Graph>::NodeIndex source,
+    typename GraphTraits<Graph>::NodeIndex target) {
+  using Traits = GraphTraits<Graph>;
+  using Vertex = typename Traits::Vertex;
+  using CostType = typename Traits::CostType;
+  using Search = internal::DijkstraSearch<Graph, Queue>;
+  constexpr auto kUnreachable = ShortestPathTree<Graph>::kUnreachable;
+
+  auto source_vertex = Traits::vertex(graph, source);
+  auto target_vertex = Traits::vertex(graph, target);
+  if (is_removed_vertex(graph, source_vertex) ||
+      is_removed_vertex(graph, target_vertex)) {
+    return std::nullopt;
+  }
+  Search forward(graph, source_vertex);
+  Search backward(graph, target_vertex);
+
+  auto best_distance = kUnreachable;
+  Vertex meeting{Traits::kInvalidVertex};
+  if (source_vertex == target_vertex) {
+    best_distance = CostType{0};
+    meeting = source_vertex;
+  }
+
+  auto advance = [&](Search& search, Search const& other) {
+    search.settle_next([&](Vertex neighbor, CostType distance) {
+      auto other_distance = other.distance(neighbor);
+      if (other_distance == kUnreachable) {
+        return;
+      }
+      CostType candidate = distance + other_distance;
+      if (candidate < best_distance) {
+        best_distance = candidate;
+        meeting = neighbor;
+      }
+    });
+  };
+
+  while (!forward.is_done() && !backward.is_done()) {
+    auto forward_distance = forward.next_distance();
+    auto backward_distance = backward.next_distance();
+    if (best_distance != kUnreachable &&
+        !(forward_distance + backward_distance < best_distance)) {
+      break;
+    }
+    if (!(backward_distance < forward_distance)) {
+      advance(forward, backward);
+    } else {
+      advance(backward, forward);
+    }
+  }
+
+  if (meeting == Traits::kInvalidVertex) {
+    return std::nullopt;
+  }
+  ShortestPath<Graph> path{best_distance, {}};
+  internal::append_path_to(graph, forward, meeting, path.nodes);
+  // the backward half runs target -> meeting; append it reversed without
+  // repeating the meeting vertex
+  std::vector<typename Traits::NodeIndex> tail;
+  internal::append_path_to(graph, backward, meeting, tail);
+  path.nodes.insert(path.nodes.end(), std::next(tail.rbegin()), tail.rend());
+  return path;
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
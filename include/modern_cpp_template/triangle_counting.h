@@ -0,0 +1,366 @@
+///\file triangle_counting.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Multi-threaded triangle counting and clustering coefficients over a
+/// CsrGraph
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+///\brief The clustering of a graph, indexed by local index
+struct ClusteringCoefficients {
+  ///\brief The number of distinct triangles in the graph
+  uint64_t triangles{0};
+  ///\brief The number of triangles every node is part of
+  std::vector<uint64_t> node_triangles{};
+  ///\brief The local clustering coefficient of every node: the fraction of
+  /// pairs of its neighbors that are adjacent.  Zero for nodes with fewer
+  /// than two neighbors.
+  std::vector<double> local{};
+  ///\brief The mean of the local coefficients over all nodes
+  double average{0.0};
+  ///\brief The global clustering coefficient (transitivity): three times the
+  /// number of triangles divided by the number of connected triples
+  double global{0.0};
+};
+
+namespace internal {
+
+///\internal Number of nodes a thread claims at a time.  Degree ordering
+/// leaves the hubs with short lists, but the work per node still varies a
+/// lot, so the chunks are small.
+static constexpr std::size_t kTriangleChunkSize{64};
+
+///\brief A callable that ignores the common elements found by
+/// intersect_sorted(), for when only their number is needed
+struct IgnoreCommon {
+  template <typename Value>
+  void operator()(Value /*value*/) const {}
+};
+
+///\brief Intersect two strictly ascending lists of 32-bit values
+/// With SSE2 four values of each list are compared all-against-all per step
+/// - the block merge of Schlegel, Willhalm and Lehner - and the block with
+/// the smaller last value is advanced.  The tails fall back to a scalar
+/// merge.
+///\param lhs a strictly ascending list
+///\param rhs a strictly ascending list
+///\param on_common called with every value found in both lists
+///\return the number of values found in both lists
+template <typename Function = IgnoreCommon>
+std::size_t intersect_sorted(std::span<uint32_t const> lhs,
+                             std::span<uint32_t const> rhs,
+                             Function&& on_common = {}) {
+  constexpr bool kReportsCommon =
+      !std::is_same_v<std::remove_cvref_t<Function>, IgnoreCommon>;
+  std::size_t common{0};
+  std::size_t left{0};
+  std::size_t right{0};
+#if defined(__SSE2__)
+  constexpr std::size_t kBlock{4};
+  constexpr std::array<uint8_t, 16> kFourBitCounts{0, 1, 1, 2, 1, 2, 2, 3,
+                                                   1, 2, 2, 3, 2, 3, 3, 4};
+  while (left + kBlock <= lhs.size() && right + kBlock <= rhs.size()) {
+    auto const lhs_block = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(lhs.data() + left));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto const rhs_block = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(rhs.data() + right));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi32(lhs_block, rhs_block),
+                     _mm_cmpeq_epi32(lhs_block, _mm_shuffle_epi32(
+                                                    rhs_block, 0b00'11'10'01))),
+        _mm_or_si128(
+            _mm_cmpeq_epi32(lhs_block,
+                            _mm_shuffle_epi32(rhs_block, 0b01'00'11'10)),
+            _mm_cmpeq_epi32(lhs_block,
+                            _mm_shuffle_epi32(rhs_block, 0b10'01'00'11))));
+    auto mask = static_cast<unsigned>(
+        _mm_movemask_ps(_mm_castsi128_ps(matches)));
+    // a table, because std::popcount is a library call without -mpopcnt
+    common += kFourBitCounts[mask];
+    if constexpr (kReportsCommon) {
+      while (mask != 0) {
+        on_common(lhs[left + static_cast<std::size_t>(std::countr_zero(mask))]);
+        mask &= mask - 1;
+      }
+    }
+    auto const lhs_last = lhs[left + kBlock - 1];
+    auto const rhs_last = rhs[right + kBlock - 1];
+    // unpredictable, so computed without branches
+    left += static_cast<std::size_t>(lhs_last <= rhs_last) * kBlock;
+    right += static_cast<std::size_t>(rhs_last <= lhs_last) * kBlock;
+  }
+#endif
+  while (left < lhs.size() && right < rhs.size()) {
+    if (lhs[left] < rhs[right]) {
+      ++left;
+    } else if (rhs[right] < lhs[left]) {
+      ++right;
+    } else {
+      ++common;
+      if constexpr (kReportsCommon) {
+        on_common(lhs[left]);
+      }
+      ++left;
+      ++right;
+    }
+  }
+  return common;
+}
+
+///\brief A per-thread counter on its own cache line
+struct alignas(64) ThreadTriangleCount {
+  uint64_t value{0};
+};
+
+///\brief The graph oriented from lower to higher (degree, local index) rank
+/// Every undirected edge is kept once, parallel edges and self loops are
+/// dropped and every list is sorted, so each triangle appears exactly once as
+/// u -> v, u -> w, v -> w.  Orienting towards the higher degree bounds every
+/// out-degree by O(sqrt(E)), which keeps the hubs of skewed graphs cheap.
+struct OrientedGraph {
+  std::vector<std::size_t> offsets{};
+  std::vector<uint32_t> targets{};
+  ///\brief distinct neighbors of every node, ignoring self loops
+  std::vector<std::size_t> degrees{};
+
+  [[nodiscard]] std::span<uint32_t const> out(std::size_t node) const {
+    return std::span<uint32_t const>(targets).subspan(
+        offsets[node], offsets[node + 1] - offsets[node]);
+  }
+};
+
+///\brief Orient a graph by degree
+/// Every row is copied, sorted and deduplicated in place once; the distinct
+/// neighbors then select the out-list twice, to size and to fill it.
+template <typename NodeValue, typename CostType>
+[[nodiscard]] OrientedGraph orient_by_degree(
+    CsrGraph<NodeValue, CostType> const& graph, WorkerPool& pool) {
+  auto const number_of_nodes = graph.number_of_nodes();
+  auto const offsets = graph.offsets();
+  std::vector<uint32_t> neighbors(graph.targets().begin(),
+                                  graph.targets().end());
+  OrientedGraph oriented;
+  oriented.degrees.resize(number_of_nodes);
+  // the distinct neighbors of a node are the prefix of its row
+  auto distinct_neighbors = [&](std::size_t node) {
+    return std::span<uint32_t const>(neighbors).subspan(
+        offsets[node], oriented.degrees[node]);
+  };
+  parallel_for(
+      pool, number_of_nodes, kTriangleChunkSize,
+      [&](std::size_t node, std::size_t /*thread*/) {
+        auto const first =
+            neighbors.begin() + static_cast<std::ptrdiff_t>(offsets[node]);
+        auto const last =
+            neighbors.begin() + static_cast<std::ptrdiff_t>(offsets[node + 1]);
+        std::sort(first, last);
+        auto distinct_last = std::unique(first, last);
+        distinct_last = std::remove(first, distinct_last,
+                                    static_cast<uint32_t>(node));
+        oriented.degrees[node] =
+            static_cast<std::size_t>(distinct_last - first);
+      });
+
+  auto is_higher = [&oriented](std::size_t node, uint32_t neighbor) {
+    auto const node_degree = oriented.degrees[node];
+    auto const neighbor_degree = oriented.degrees[neighbor];
+    return node_degree < neighbor_degree ||
+           (node_degree == neighbor_degree && node < neighbor);
+  };
+  std::vector<std::size_t> out_degrees(number_of_nodes);
+  parallel_for(
+      pool, number_of_nodes, kTriangleChunkSize,
+      [&](std::size_t node, std::size_t /*thread*/) {
+        auto const distinct = distinct_neighbors(node);
+        out_degrees[node] = static_cast<std::size_t>(
+            std::count_if(distinct.begin(), distinct.end(),
+                          [&](uint32_t neighbor) {
+                            return is_higher(node, neighbor);
+                          }));
+      });
+  oriented.offsets.assign(number_of_nodes + 1, 0);
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    oriented.offsets[node + 1] = oriented.offsets[node] + out_degrees[node];
+  }
+  oriented.targets.resize(oriented.offsets.back());
+  parallel_for(
+      pool, number_of_nodes, kTriangleChunkSize,
+      [&](std::size_t node, std::size_t /*thread*/) {
+        auto const distinct = distinct_neighbors(node);
+        std::copy_if(distinct.begin(), distinct.end(),
+                     oriented.targets.begin() +
+                         static_cast<std::ptrdiff_t>(oriented.offsets[node]),
+                     [&](uint32_t neighbor) {
+                       return is_higher(node, neighbor);
+                     });
+      });
+  return oriented;
+}
+
+}  // namespace internal
+
+///\brief Count the distinct triangles of a graph with multiple threads
+/// Parallel edges and self loops are ignored.  The graph is oriented by
+/// degree, then every oriented edge u -> v contributes the size of the
+/// intersection of the out-lists of u and v.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to count
+///\param pool the worker threads to run on
+///\return uint64_t the number of triangles
+template <typename NodeValue, typename CostType>
+[[nodiscard]] uint64_t count_triangles(
+    CsrGraph<NodeValue, CostType> const& graph, WorkerPool& pool) {
+  auto const oriented = internal::orient_by_degree(graph, pool);
+  std::vector<internal::ThreadTriangleCount> thread_triangles(pool.size());
+  parallel_for(
+      pool, graph.number_of_nodes(), internal::kTriangleChunkSize,
+      [&](std::size_t node, std::size_t thread_index) {
+        auto const node_out = oriented.out(node);
+        uint64_t node_triangles{0};
+        for (auto neighbor : node_out) {
+          node_triangles +=
+              internal::intersect_sorted(node_out, oriented.out(neighbor));
+        }
+        thread_triangles[thread_index].value += node_triangles;
+      });
+  uint64_t triangles{0};
+  for (auto const& count : thread_triangles) {
+    triangles += count.value;
+  }
+  return triangles;
+}
+
+///\brief Count the distinct triangles of a graph on the calling thread
+///\see count_triangles(graph, pool)
+template <typename NodeValue, typename CostType>
+[[nodiscard]] uint64_t count_triangles(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  WorkerPool pool(1);
+  return count_triangles(graph, pool);
+}
+
+///\brief Count the distinct triangles of an UndirectedGraph
+/// Freezes the graph into a CsrGraph first.
+///\see count_triangles(graph, pool)
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+[[nodiscard]] uint64_t count_triangles(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph,
+    WorkerPool& pool) {
+  return count_triangles(freeze(graph), pool);
+}
+
+///\brief Compute the triangles and clustering coefficients of every node
+/// with multiple threads
+/// Parallel edges and self loops are ignored.  Each triangle found from
+/// u -> v is credited to u, v and the common neighbor with relaxed atomic
+/// increments.
+///\tparam NodeValue The value stored in a Node
+///\tparam CostType The type of the cost of an Edge
+///\param graph the graph to measure
+///\param pool the worker threads to run on
+///\return ClusteringCoefficients indexed by local index
+template <typename NodeValue, typename CostType>
+[[nodiscard]] ClusteringCoefficients clustering_coefficients(
+    CsrGraph<NodeValue, CostType> const& graph, WorkerPool& pool) {
+  auto const number_of_nodes = graph.number_of_nodes();
+  auto const oriented = internal::orient_by_degree(graph, pool);
+  std::vector<std::atomic<uint64_t>> node_triangles(number_of_nodes);
+  parallel_for(
+      pool, number_of_nodes, internal::kTriangleChunkSize,
+      [&](std::size_t node, std::size_t /*thread*/) {
+        node_triangles[node].store(0, std::memory_order_relaxed);
+      });
+  parallel_for(
+      pool, number_of_nodes, internal::kTriangleChunkSize,
+      [&](std::size_t node, std::size_t /*thread*/) {
+        auto const node_out = oriented.out(node);
+        uint64_t found{0};
+        for (auto neighbor : node_out) {
+          auto const common = internal::intersect_sorted(
+              node_out, oriented.out(neighbor), [&](uint32_t third) {
+                node_triangles[third].fetch_add(1, std::memory_order_relaxed);
+              });
+          node_triangles[neighbor].fetch_add(common,
+                                             std::memory_order_relaxed);
+          found += common;
+        }
+        node_triangles[node].fetch_add(found, std::memory_order_relaxed);
+      });
+
+  ClusteringCoefficients result;
+  result.node_triangles.resize(number_of_nodes);
+  result.local.resize(number_of_nodes);
+  uint64_t triangle_corners{0};
+  double triples{0.0};
+  double local_sum{0.0};
+  for (std::size_t node = 0; node < number_of_nodes; ++node) {
+    auto const triangles = node_triangles[node].load(std::memory_order_relaxed);
+    auto const degree = static_cast<double>(oriented.degrees[node]);
+    auto const node_triples = degree * (degree - 1.0) / 2.0;
+    result.node_triangles[node] = triangles;
+    result.local[node] =
+        node_triples > 0.0 ? static_cast<double>(triangles) / node_triples
+                           : 0.0;
+    triangle_corners += triangles;
+    triples += node_triples;
+    local_sum += result.local[node];
+  }
+  result.triangles = triangle_corners / 3;
+  if (number_of_nodes > 0) {
+    result.average = local_sum / static_cast<double>(number_of_nodes);
+  }
+  if (triples > 0.0) {
+    result.global = static_cast<double>(triangle_corners) / triples;
+  }
+  return result;
+}
+
+///\brief Compute the clustering coefficients on the calling thread
+///\see clustering_coefficients(graph, pool)
+template <typename NodeValue, typename CostType>
+[[nodiscard]] ClusteringCoefficients clustering_coefficients(
+    CsrGraph<NodeValue, CostType> const& graph) {
+  WorkerPool pool(1);
+  return clustering_coefficients(graph, pool);
+}
+
+///\brief Compute the clustering coefficients of an UndirectedGraph
+/// Freezes the graph into a CsrGraph first, so the results are indexed by
+/// the local index of the frozen graph - ascending node id.
+///\see clustering_coefficients(graph, pool)
+template <typename NodeValue, typename CostType, typename Allocator,
+          template <typename, typename, typename> class Map>
+[[nodiscard]] ClusteringCoefficients clustering_coefficients(
+    UndirectedGraph<NodeValue, CostType, Allocator, Map> const& graph,
+    WorkerPool& pool) {
+  return clustering_coefficients(freeze(graph), pool);
+}
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
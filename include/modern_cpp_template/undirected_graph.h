@@ -9,21 +9,35 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <gsl/gsl>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <new>
+#include <optional>
 #include <queue>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
 
+#include "modern_cpp_template/connectivity_index.h"
 #include "modern_cpp_template/macros.h"
+#include "modern_cpp_template/visitation_context.h"
 
 namespace modern_cpp_template::algorithms::undirected_graph {
 
+///\brief The default map type of UndirectedGraph - a std::unordered_map
+/// allocating through Allocator
+///\tparam Key The key type
+///\tparam Value The mapped type
+///\tparam Allocator The allocator of std::pair<Key const, Value>
+template <typename Key, typename Value, typename Allocator>
+using UnorderedNodeMap = std::unordered_map<Key, Value, std::hash<Key>,
+                                            std::equal_to<Key>, Allocator>;
+
 ///\brief Represent the Node of a graph
 ///\tparam NodeValue The type of the Value - must support operator<<
 template <typename NodeValue>
@@ -40,6 +54,10 @@ struct Node {
   ///\brief The value of the Node
   NodeValue value{};
 
+  ///\brief true once the node has been removed from its graph; the entry is
+  /// kept as a tombstone so that node ids stay dense
+  bool is_removed{false};
+
   ///\brief return the nodes Key which can be hashed
   ///\return NodeIndex
   [[gnu::nothrow]] NodeIndex key() const { return id; }
@@ -97,6 +115,19 @@ struct Edge {
 
   ///\brief The cost of this edge
   CostType cost{0};
+
+  ///\brief The tail_node_index of a removed edge
+  /// Node ids are never negative, so a removed edge needs no extra field.
+  static constexpr NodeIndex kRemovedNodeIndex{-1};
+
+  ///\brief return true once the edge has been removed; traversals skip it
+  /// until the adjacency list it lives in is compacted
+  [[nodiscard]] bool is_removed() const {
+    return tail_node_index == kRemovedNodeIndex;
+  }
+
+  ///\brief Mark the edge as removed
+  void mark_removed() { tail_node_index = kRemovedNodeIndex; }
 };
 
 ///\brief An undirected graph
@@ -104,19 +135,71 @@ struct Edge {
 /// this, when we add an edge we add its mirror copy.  For example, if adding
 /// and edge between two nodes A and B, then we have edge 1 from from A to B and
 /// then its opposite copy, edge 2 going from B to A.
+///
+/// Every container of the graph - both maps and every adjacency list -
+/// allocates through a rebound copy of Allocator_T.  A stateful allocator
+/// reaches the adjacency lists through uses-allocator construction, so use
+/// one that propagates itself, such as std::pmr::polymorphic_allocator (see
+/// pmr::UndirectedGraph) or std::scoped_allocator_adaptor.
+///
+/// All maps are instances of Map_T, which takes the key, the mapped type and
+/// the allocator, and must provide the std::unordered_map members used here:
+/// find, emplace, erase, clear, empty, operator[], reserve, size,
+/// get_allocator and iteration over std::pair<NodeIndex const, Value>.
+/// FlatHashMap is a drop-in open addressing alternative that makes get_node
+/// and get_edges a probe of one flat array instead of a pointer chase; with
+/// it, references to nodes and edge lists are invalidated when adding an edge
+/// adds a node.
+///
+/// An optional ConnectivityIndex, turned on with
+/// enable_connectivity_index(), is updated by add_edge() and answers
+/// is_connected() and component_size() without a search.  Edges inserted
+/// through the adjacency_map() accessor bypass it.
+///
+/// remove_edge() and remove_node() mark entries as removed instead of erasing
+/// them, so a removal never shifts an adjacency list.  Removed entries are
+/// skipped by every traversal and by the builders that read this graph.  An
+/// adjacency list is compacted as soon as more than compaction_threshold() of
+/// its entries are removed, which keeps the cost of compaction amortized
+/// constant per removal; compact() drops every removed entry at once.  A
+/// removed node keeps its id, and still counts in number_of_nodes(), until
+/// add_edge() brings it back.
 ///\tparam NodeValue_T The value stored in a Node
 ///\tparam CostType_T The type of the cost of an Edge
-template <typename NodeValue_T, typename CostType_T>
+///\tparam Allocator_T The allocator of the graph containers; any value type
+///\tparam Map_T The map type of the node and adjacency maps
+template <typename NodeValue_T, typename CostType_T,
+          typename Allocator_T = std::allocator<std::byte>,
+          template <typename, typename, typename> class Map_T =
+              UnorderedNodeMap>
 class UndirectedGraph {
+  template <typename T>
+  using RebindAllocator =
+      typename std::allocator_traits<Allocator_T>::template rebind_alloc<T>;
+
  public:
   using NodeValue = NodeValue_T;
   using CostType = CostType_T;
+  using Allocator = Allocator_T;
   using Edge_T = Edge<NodeValue, CostType>;
   using Node = typename Edge_T::Node_T;
   using NodeIndex = typename Edge_T::NodeIndex;
-  using EdgeList = std::vector<Edge_T>;
-  using NodeAdjacencyMap = std::unordered_map<NodeIndex, EdgeList>;
-  using NodeMap = std::unordered_map<NodeIndex, Node>;
+  using EdgeList = std::vector<Edge_T, RebindAllocator<Edge_T>>;
+  using NodeAdjacencyMap =
+      Map_T<NodeIndex, EdgeList,
+            RebindAllocator<std::pair<NodeIndex const, EdgeList>>>;
+  using NodeMap =
+      Map_T<NodeIndex, Node, RebindAllocator<std::pair<NodeIndex const, Node>>>;
+  using RemovedEdgeCountMap =
+      Map_T<NodeIndex, std::size_t,
+            RebindAllocator<std::pair<NodeIndex const, std::size_t>>>;
+  using VisitationContext =
+      modern_cpp_template::algorithms::VisitationContext<NodeIndex>;
+  using ConnectivityIndex =
+      modern_cpp_template::algorithms::ConnectivityIndex<NodeIndex, Allocator>;
+
+  ///\brief The default compaction_threshold()
+  static constexpr double kDefaultCompactionThreshold{0.5};
 
   ///\brief Construct a new Undirected Graph object
   /// Sets the initial size for the number of nodes and number of edges.  For
@@ -124,19 +207,42 @@ class UndirectedGraph {
   /// makes creating the graph much more efficient.
   ///\param num_nodes the initial number of nodes
   ///\param num_edges the initial number of edges
-  explicit UndirectedGraph(std::size_t num_nodes, std::size_t num_edges)
-      : node_map_(num_nodes), adjacency_map_(num_edges) {}
+  ///\param allocator the allocator of the graph containers
+  explicit UndirectedGraph(std::size_t num_nodes, std::size_t num_edges,
+                           Allocator const& allocator = Allocator())
+      : node_map_(num_nodes, typename NodeMap::allocator_type(allocator)),
+        adjacency_map_(num_edges,
+                       typename NodeAdjacencyMap::allocator_type(allocator)),
+        kEmptyEdgeList(allocator),
+        removed_edge_counts_(
+            typename RemovedEdgeCountMap::allocator_type(allocator)) {}
 
   ///\brief Construct a new Undirected Graph object
   UndirectedGraph() = default;
 
+  ///\brief Construct a new, empty Undirected Graph object that allocates
+  /// through allocator
+  ///\param allocator the allocator of the graph containers
+  explicit UndirectedGraph(Allocator const& allocator)
+      : node_map_(typename NodeMap::allocator_type(allocator)),
+        adjacency_map_(typename NodeAdjacencyMap::allocator_type(allocator)),
+        kEmptyEdgeList(allocator),
+        removed_edge_counts_(
+            typename RemovedEdgeCountMap::allocator_type(allocator)) {}
+
+  ///\brief return the allocator of the graph containers
+  ///\return Allocator
+  [[nodiscard]] Allocator get_allocator() const {
+    return Allocator(node_map_.get_allocator());
+  }
+
   ///\brief return the number of nodes in the graph
   ///\return auto the number of nodes in the graph
-  auto number_of_nodes() { return node_map_.size(); }
+  auto number_of_nodes() const { return node_map_.size(); }
 
   ///\brief return the number of edges in the graph
   ///\return auto the number of edges in the graph
-  auto number_of_edges() { return adjacency_map_.size(); }
+  auto number_of_edges() const { return adjacency_map_.size(); }
 
   ///\brief Readonly accessor for the adjacency map
   /// The adjacency map maps the key of a Node (NodeIndex) to its
@@ -164,23 +270,22 @@ class UndirectedGraph {
   ///\return NodeMap const&
   [[gnu::nothrow]] NodeMap& node_map() { return node_map_; }
 
-  // ///\brief Return the readonly list of Edge objects for a specific node
-  // /// This will return the list of Edge objects that are directly connected
-  // to
-  // /// the Node represented by the NodeIndex
-  // ///\param node_index The key of the Node whose Edge objects you want to
-  // return
-  // ///\return EdgeList&
-  // EdgeList const& get_edges(NodeIndex node_index) const {
-  //   modern_cpp_template_assert(node_index >= 0 &&
-  //                              node_index < adjacency_map().size());
-  //   typename NodeAdjacencyMap::const_iterator edge_iterator =
-  //       adjacency_map().find(node_index);
-  //   [[likely]] if (edge_iterator != adjacency_map().end()) {
-  //     return edge_iterator->second;
-  //   }
-  //   return kEmptyEdgeList;
-  // }
+  ///\brief Return the readonly list of Edge objects for a specific node
+  /// This will return the list of Edge objects that are directly connected to
+  /// the Node represented by the NodeIndex
+  ///\param node_index The key of the Node whose Edge objects you want to return
+  ///\return EdgeList const&
+  EdgeList const& get_edges(NodeIndex node_index) const {
+    modern_cpp_template_assert(node_index >= 0 &&
+                               static_cast<size_t>(node_index) <
+                                   adjacency_map().size());
+    typename NodeAdjacencyMap::const_iterator edge_iterator =
+        adjacency_map().find(node_index);
+    [[likely]] if (edge_iterator != adjacency_map().end()) {
+      return edge_iterator->second;
+    }
+    return kEmptyEdgeList;
+  }
 
   ///\brief Return the list of Edge objects for a specific node
   /// This will return the list of Edge objects that are directly connected to
@@ -199,20 +304,58 @@ class UndirectedGraph {
     return kEmptyEdgeList;
   }
 
-  // ///\brief Return the readonly Node from the node index
-  // ///\param node_index The node index
-  // ///\return Node const&
-  // Node const& get_node(NodeIndex node_index) const {
-  //   modern_cpp_template_assert(
-  //       node_index >= 0 && static_cast<size_t>(node_index) <
-  //       node_map().size());
-  //   typename NodeMap ::const_iterator node_iterator =
-  //   node_map().find(node_index);
-  //   [[likely]] if (node_iterator != node_map().end()) {
-  //     return node_iterator->second;
-  //   }
-  //   return kEmptyNode;
-  // }
+  ///\brief return the number of edges incident to a node
+  /// A self loop counts twice and removed edges do not count.  See
+  /// degree_statistics() in k_core.h for the degree distribution of the whole
+  /// graph.
+  ///\param node_index The key of the Node
+  ///\return std::size_t
+  [[nodiscard]] std::size_t degree(NodeIndex node_index) const {
+    return get_edges(node_index).size() -
+           number_of_removed_edges(node_index);
+  }
+
+  ///\brief return the number of removed entries still stored in the
+  /// adjacency list of a node
+  ///\param node_index The key of the Node
+  ///\return std::size_t
+  [[nodiscard]] std::size_t number_of_removed_edges(
+      NodeIndex node_index) const {
+    [[likely]] if (removed_edge_counts_.empty()) {
+      return 0;
+    }
+    auto count_iterator = removed_edge_counts_.find(node_index);
+    if (count_iterator == removed_edge_counts_.end()) {
+      return 0;
+    }
+    return count_iterator->second;
+  }
+
+  ///\brief return the number of removed entries still stored in all
+  /// adjacency lists; an edge between two nodes has two entries
+  ///\return std::size_t
+  [[nodiscard]] std::size_t number_of_removed_edges() const {
+    return number_of_removed_edges_;
+  }
+
+  ///\brief return the number of removed nodes kept as tombstones
+  ///\return std::size_t
+  [[nodiscard]] std::size_t number_of_removed_nodes() const {
+    return number_of_removed_nodes_;
+  }
+
+  ///\brief Return the readonly Node from the node index
+  ///\param node_index The node index
+  ///\return Node const&
+  Node const& get_node(NodeIndex node_index) const {
+    modern_cpp_template_assert(
+        node_index >= 0 && static_cast<size_t>(node_index) < node_map().size());
+    typename NodeMap::const_iterator node_iterator = node_map().find(node_index);
+    [[likely]] if (node_iterator != node_map().end()) {
+      return node_iterator->second;
+    }
+    return kEmptyNode;
+  }
 
   ///\brief Return the Node from the node index
   ///\param node_index The node index
@@ -238,12 +381,17 @@ class UndirectedGraph {
   // place... similar to emplace_back for a std::vector.
   void add_edge(Node head_node, Node tail_node,
                 CostType edge_cost = static_cast<CostType>(0)) {
-    node_map()[head_node.id] = head_node;
-    node_map()[tail_node.id] = tail_node;
+    head_node.is_removed = false;
+    tail_node.is_removed = false;
+    revive_node(node_map()[head_node.id]) = head_node;
+    revive_node(node_map()[tail_node.id]) = tail_node;
     adjacency_map()[head_node.id].emplace_back(
         Edge_T{head_node.id, tail_node.id, edge_cost});
     adjacency_map()[tail_node.id].emplace_back(
         Edge_T{tail_node.id, head_node.id, edge_cost});
+    if (connectivity_index_.has_value()) {
+      connectivity_index_->add_edge(head_node.id, tail_node.id);
+    }
   }
 
   ///\brief Add an edge to the Graph
@@ -258,14 +406,161 @@ class UndirectedGraph {
   void add_edge(NodeIndex head_node_index, NodeValue head_node_value,
                 NodeIndex tail_node_index, NodeValue tail_node_value,
                 CostType edge_cost = 0) {
-    node_map().emplace(head_node_index,
-                       Node{false, head_node_index, head_node_value});
-    node_map().emplace(tail_node_index,
-                       Node{false, tail_node_index, tail_node_value});
+    insert_node(head_node_index, head_node_value);
+    insert_node(tail_node_index, tail_node_value);
     adjacency_map()[head_node_index].emplace_back(
         Edge_T{head_node_index, tail_node_index, edge_cost});
     adjacency_map()[tail_node_index].emplace_back(
         Edge_T{tail_node_index, head_node_index, edge_cost});
+    if (connectivity_index_.has_value()) {
+      connectivity_index_->add_edge(head_node_index, tail_node_index);
+    }
+  }
+
+  ///\brief Remove one edge between two nodes
+  /// Mirrors add_edge(): the entry in the list of the head node and its copy
+  /// in the list of the tail node are both marked as removed.  Finding them
+  /// scans the two adjacency lists; marking them is constant time.  With
+  /// parallel edges, the first one still present is removed.  A union-find
+  /// cannot forget an edge, so this drops the ConnectivityIndex; call
+  /// enable_connectivity_index() again to rebuild it.
+  ///\param head_node_index Index of the head Node
+  ///\param tail_node_index Index of the tail Node
+  ///\return true if an edge was removed; false if there is none
+  bool remove_edge(NodeIndex head_node_index, NodeIndex tail_node_index) {
+    auto const cost = mark_edge_removed(head_node_index, tail_node_index);
+    if (!cost.has_value()) {
+      return false;
+    }
+    [[maybe_unused]] auto const mirror_cost =
+        mark_edge_removed(tail_node_index, head_node_index, cost);
+    modern_cpp_template_assert_message(mirror_cost.has_value(),
+                                       "an edge is missing its mirror copy");
+    compact_if_needed(head_node_index);
+    compact_if_needed(tail_node_index);
+    connectivity_index_.reset();
+    return true;
+  }
+
+  ///\brief Remove a node and every edge incident to it
+  /// The node stays in the node map, marked as removed, so that node ids stay
+  /// dense; its own adjacency list is released at once and the mirror copies
+  /// of its edges are marked as removed in the lists of its neighbors.
+  /// add_edge() on the id brings the node back with no edges.  This drops the
+  /// ConnectivityIndex, as remove_edge() does.
+  ///\param node_index Index of the Node
+  ///\return true if the node was removed; false if it was already removed
+  /// or is not in the graph
+  bool remove_node(NodeIndex node_index) {
+    auto node_iterator = node_map().find(node_index);
+    if (node_iterator == node_map().end() ||
+        node_iterator->second.is_removed) {
+      return false;
+    }
+    auto& node = node_iterator->second;
+    node.is_removed = true;
+    ++number_of_removed_nodes_;
+    auto& node_edges = get_edges(node_index);
+    for (auto const& node_edge : node_edges) {
+      if (!node_edge.is_removed() && node_edge.tail_node_index != node_index) {
+        [[maybe_unused]] auto const mirror_cost = mark_edge_removed(
+            node_edge.tail_node_index, node_index, node_edge.cost);
+        modern_cpp_template_assert_message(
+            mirror_cost.has_value(), "an edge is missing its mirror copy");
+        compact_if_needed(node_edge.tail_node_index);
+      }
+    }
+    forget_removed_edges(node_index);
+    node_edges = EdgeList(node_edges.get_allocator());
+    connectivity_index_.reset();
+    return true;
+  }
+
+  ///\brief return the fraction of removed entries that triggers the
+  /// compaction of an adjacency list
+  [[nodiscard]] double compaction_threshold() const {
+    return compaction_threshold_;
+  }
+
+  ///\brief Set the fraction of removed entries that triggers the compaction
+  /// of an adjacency list
+  /// Lower values keep the lists denser at the cost of compacting more often;
+  /// 1 turns automatic compaction off, leaving it to compact().
+  ///\param compaction_threshold a fraction in (0, 1]
+  void set_compaction_threshold(double compaction_threshold) {
+    modern_cpp_template_assert_message(
+        compaction_threshold > 0.0 && compaction_threshold <= 1.0,
+        "the compaction threshold must be in (0, 1]");
+    compaction_threshold_ = compaction_threshold;
+  }
+
+  ///\brief Drop every removed edge entry from the adjacency lists
+  /// Only lists that hold removed entries are visited.  Removed nodes stay as
+  /// tombstones.
+  void compact() {
+    for (auto const& [node_index, count] : removed_edge_counts_) {
+      std::erase_if(get_edges(node_index),
+                    [](Edge_T const& edge) { return edge.is_removed(); });
+    }
+    removed_edge_counts_.clear();
+    number_of_removed_edges_ = 0;
+  }
+
+  ///\brief Start maintaining a ConnectivityIndex
+  /// The index is built from the current edges, then kept up to date by every
+  /// add_edge() call at the cost of a near constant time union-find update.
+  /// Calling this again rebuilds the index, e.g. after edges were inserted
+  /// through adjacency_map().
+  void enable_connectivity_index() {
+    connectivity_index_.emplace(get_allocator());
+    connectivity_index_->reserve(number_of_nodes());
+    for (auto const& [node_index, node] : node_map()) {
+      if (!node.is_removed) {
+        connectivity_index_->add_node(node_index);
+      }
+    }
+    for (auto const& [node_index, node_edges] : adjacency_map()) {
+      for (auto const& node_edge : node_edges) {
+        if (!node_edge.is_removed()) {
+          connectivity_index_->add_edge(node_index, node_edge.tail_node_index);
+        }
+      }
+    }
+  }
+
+  ///\brief Stop maintaining the ConnectivityIndex and release it
+  void disable_connectivity_index() { connectivity_index_.reset(); }
+
+  ///\brief return true if add_edge() maintains a ConnectivityIndex
+  [[nodiscard]] bool has_connectivity_index() const {
+    return connectivity_index_.has_value();
+  }
+
+  ///\brief Readonly accessor for the ConnectivityIndex
+  /// Requires enable_connectivity_index().
+  ///\return ConnectivityIndex const&
+  [[nodiscard]] ConnectivityIndex const& connectivity_index() const {
+    modern_cpp_template_assert_message(connectivity_index_.has_value(),
+                                       "the connectivity index is disabled");
+    return *connectivity_index_;
+  }
+
+  ///\brief Test whether a path connects two nodes
+  /// Requires enable_connectivity_index().
+  ///\param first_node_index a Node of the graph
+  ///\param second_node_index a Node of the graph
+  ///\return true if both nodes are in the same connected component
+  [[nodiscard]] bool is_connected(NodeIndex first_node_index,
+                                  NodeIndex second_node_index) const {
+    return connectivity_index().connected(first_node_index,
+                                          second_node_index);
+  }
+
+  ///\brief return the number of nodes in the connected component of a node
+  /// Requires enable_connectivity_index().
+  ///\param node_index a Node of the graph
+  [[nodiscard]] std::size_t component_size(NodeIndex node_index) const {
+    return connectivity_index().component_size(node_index);
   }
 
   ///\brief Perform the BFS (breadth first search) algorithm on the graph
@@ -274,7 +569,8 @@ class UndirectedGraph {
   /// callback function that returns a bool.  If this optional callback return
   /// true, then this algorithm will terminate early.  This is useful if you
   /// are searching for a specific Node.  You would naturally want to
-  /// terminate the search when the Node has been located.
+  /// terminate the search when the Node has been located.  Removed edges are
+  /// skipped and a search from a removed node visits nothing.
   ///\param start_node_index the Node to start the algorithm at
   ///\param callback the optional function to call to process each new node
   /// found in the search.  This function will return a bool type.  If the
@@ -285,6 +581,9 @@ class UndirectedGraph {
     // "Visit" the start_node and add it to the queue and call the callback if
     // it exists
     auto& start_node = get_node(start_node_index);
+    if (start_node.is_removed) {
+      return;
+    }
     std::queue<NodeIndex> node_queue;
     start_node.is_visited = true;
     if (callback != nullptr) {
@@ -301,6 +600,9 @@ class UndirectedGraph {
       // the current "head node" to the "tail node") from "node".  Process means
       // to call the callback function and add the tail node to the node_queue
       for (auto& node_edge : node_edges) {
+        if (node_edge.is_removed()) {
+          continue;
+        }
         auto& tail_node = get_node(node_edge.tail_node_index);
         if (!tail_node.is_visited) {
           tail_node.is_visited = true;
@@ -315,11 +617,129 @@ class UndirectedGraph {
     }
   }
 
+  ///\brief Perform a re-entrant BFS (breadth first search) on the graph
+  /// Same contract as the overload above, except that the visited state is
+  /// kept in the caller supplied context instead of Node::is_visited.  The
+  /// graph is not modified, so the search can be repeated and any number of
+  /// searches can run concurrently on the same graph as long as each one uses
+  /// its own context.  Node ids are used to index the context, so they must be
+  /// dense, as already required by get_node().
+  ///\param start_node_index the Node to start the algorithm at
+  ///\param context the visitation context; it is reset by this call and can
+  /// be reused for the next search
+  ///\param callback the optional function to call to process each new node
+  /// found in the search.  This function will return a bool type.  If the
+  /// function returns true, then this algorithm is terminated early.
+  void breadth_first_search(
+      NodeIndex start_node_index, VisitationContext& context,
+      std::function<bool(Node const&)> callback = nullptr) const {
+    context.reset(number_of_nodes());
+    auto const& start_node = get_node(start_node_index);
+    if (start_node.is_removed) {
+      return;
+    }
+    context.visit(start_node.id);
+    if (callback != nullptr) {
+      callback(start_node);
+    }
+    context.push(start_node.id);
+    while (!context.empty()) {
+      for (auto const& node_edge : get_edges(context.pop())) {
+        if (!node_edge.is_removed() &&
+            context.visit(node_edge.tail_node_index)) {
+          auto const& tail_node = get_node(node_edge.tail_node_index);
+          if (callback != nullptr) {
+            if (callback(tail_node)) {
+              return;
+            }
+          }
+          context.push(tail_node.id);
+        }
+      }
+    }
+  }
+
  private:
+  ///\brief Add a node, or bring back a removed one with a new value
+  void insert_node(NodeIndex node_index, NodeValue const& node_value) {
+    auto [node_iterator, is_inserted] =
+        node_map().emplace(node_index, Node{false, node_index, node_value});
+    if (!is_inserted && node_iterator->second.is_removed) {
+      node_iterator->second = Node{false, node_index, node_value};
+      --number_of_removed_nodes_;
+    }
+  }
+
+  ///\brief Account for a removed node that is about to be overwritten
+  Node& revive_node(Node& node) {
+    if (node.is_removed) {
+      --number_of_removed_nodes_;
+    }
+    return node;
+  }
+
+  ///\brief Mark the first edge still present from a node to a neighbor
+  ///\param cost if set, only an edge of this cost matches
+  ///\return the cost of the removed edge; std::nullopt if none matched
+  std::optional<CostType> mark_edge_removed(
+      NodeIndex node_index, NodeIndex neighbor_index,
+      std::optional<CostType> cost = std::nullopt) {
+    for (auto& node_edge : get_edges(node_index)) {
+      if (node_edge.tail_node_index == neighbor_index &&
+          (!cost.has_value() || node_edge.cost == *cost)) {
+        node_edge.mark_removed();
+        ++removed_edge_counts_[node_index];
+        ++number_of_removed_edges_;
+        return node_edge.cost;
+      }
+    }
+    return std::nullopt;
+  }
+
+  ///\brief Compact the adjacency list of a node if enough of it is removed
+  void compact_if_needed(NodeIndex node_index) {
+    auto count_iterator = removed_edge_counts_.find(node_index);
+    if (count_iterator == removed_edge_counts_.end()) {
+      return;
+    }
+    auto& node_edges = get_edges(node_index);
+    if (static_cast<double>(count_iterator->second) <=
+        compaction_threshold_ * static_cast<double>(node_edges.size())) {
+      return;
+    }
+    std::erase_if(node_edges,
+                  [](Edge_T const& edge) { return edge.is_removed(); });
+    forget_removed_edges(node_index);
+  }
+
+  ///\brief Drop the count of removed entries of a list that no longer has any
+  void forget_removed_edges(NodeIndex node_index) {
+    auto count_iterator = removed_edge_counts_.find(node_index);
+    if (count_iterator != removed_edge_counts_.end()) {
+      number_of_removed_edges_ -= count_iterator->second;
+      removed_edge_counts_.erase(count_iterator);
+    }
+  }
+
   NodeMap node_map_{};
   NodeAdjacencyMap adjacency_map_{};
   Node kEmptyNode{};
   EdgeList kEmptyEdgeList{};
+  std::optional<ConnectivityIndex> connectivity_index_{};
+  RemovedEdgeCountMap removed_edge_counts_{};
+  std::size_t number_of_removed_edges_{0};
+  std::size_t number_of_removed_nodes_{0};
+  double compaction_threshold_{kDefaultCompactionThreshold};
 };
 
+namespace pmr {
+
+///\brief An UndirectedGraph whose containers allocate from a
+/// std::pmr::memory_resource, such as ArenaResource or SizeClassPoolResource
+template <typename NodeValue, typename CostType>
+using UndirectedGraph = undirected_graph::UndirectedGraph<
+    NodeValue, CostType, std::pmr::polymorphic_allocator<std::byte>>;
+
+}  // namespace pmr
+
 }  // namespace modern_cpp_template::algorithms::undirected_graph
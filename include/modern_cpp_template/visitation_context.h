@@ -0,0 +1,115 @@
+///\file visitation_context.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Reusable, epoch-stamped visited state for graph traversals
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+///\brief Visited state and work queue for one traversal at a time
+/// A node counts as visited when its stamp equals the current epoch, so
+/// starting a new traversal with reset() is O(1): it only bumps the epoch.
+/// The stamps are cleared for real only when the epoch counter wraps around.
+/// Keeping this state outside of the graph lets any number of traversals run
+/// concurrently over one const graph, one context per thread, and lets a
+/// thread reuse its context (and its queue allocation) across queries.
+///\tparam Index the node index type used by the graph being traversed
+///\tparam Epoch the unsigned stamp type
+template <typename Index, typename Epoch = uint32_t>
+class VisitationContext {
+  static_assert(std::is_unsigned_v<Epoch>, "Epoch must be unsigned");
+
+ public:
+  ///\brief Construct an empty VisitationContext
+  VisitationContext() = default;
+
+  ///\brief Construct a VisitationContext for node indices in [0, size)
+  ///\param size the number of node indices
+  explicit VisitationContext(std::size_t size) { reset(size); }
+
+  ///\brief Start a new traversal over node indices in [0, size)
+  /// Marks every node as not visited and empties the queue.  The stamp array
+  /// only grows, so a context sized for the largest graph can be reused for
+  /// smaller ones.
+  ///\param size the number of node indices
+  void reset(std::size_t size) {
+    if (size > stamps_.size()) {
+      stamps_.resize(size, Epoch{0});
+    }
+    if (epoch_ == std::numeric_limits<Epoch>::max()) [[unlikely]] {
+      std::fill(stamps_.begin(), stamps_.end(), Epoch{0});
+      epoch_ = 0;
+    }
+    ++epoch_;
+    queue_.clear();
+    queue_head_ = 0;
+  }
+
+  ///\brief return the number of node indices the context can track
+  [[nodiscard]] std::size_t size() const { return stamps_.size(); }
+
+  ///\brief return the current epoch
+  [[nodiscard]] Epoch epoch() const { return epoch_; }
+
+  ///\brief Test whether a node has been visited in the current traversal
+  ///\param index the node index
+  ///\return true if visited
+  [[nodiscard]] bool is_visited(Index index) const {
+    return stamps_[position(index)] == epoch_;
+  }
+
+  ///\brief Mark a node as visited
+  ///\param index the node index
+  ///\return true if the node was not visited before this call
+  bool visit(Index index) {
+    auto& stamp = stamps_[position(index)];
+    if (stamp == epoch_) {
+      return false;
+    }
+    stamp = epoch_;
+    return true;
+  }
+
+  ///\brief Append a node to the FIFO work queue
+  ///\param index the node index
+  void push(Index index) { queue_.push_back(index); }
+
+  ///\brief return true if the work queue has no pending nodes
+  [[nodiscard]] bool empty() const { return queue_head_ == queue_.size(); }
+
+  ///\brief Remove and return the oldest pending node of the work queue
+  /// Popped entries are not erased, so the queue never shifts its elements
+  /// and its capacity is kept for the next traversal.
+  ///\return Index
+  Index pop() {
+    modern_cpp_template_assert(!empty());
+    return queue_[queue_head_++];
+  }
+
+ private:
+  [[nodiscard]] std::size_t position(Index index) const {
+    auto offset = static_cast<std::size_t>(index);
+    modern_cpp_template_assert(offset < stamps_.size());
+    return offset;
+  }
+
+  std::vector<Epoch> stamps_{};
+  Epoch epoch_{0};
+  std::vector<Index> queue_{};
+  std::size_t queue_head_{0};
+};
+
+}  // namespace modern_cpp_template::algorithms
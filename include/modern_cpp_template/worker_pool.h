@@ -0,0 +1,232 @@
+///\file worker_pool.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief A small fork-join pool of persistent worker threads used by the
+/// parallel graph algorithms
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/macros.h"
+
+namespace modern_cpp_template::algorithms {
+
+///\brief A fixed set of persistent threads that run one job at a time
+/// run() hands the same job to every thread of the pool - the calling thread
+/// participates as thread 0 - and returns once all of them have finished.
+/// Threads are created once, so a pool can be shared by many short parallel
+/// algorithms without paying for thread creation on every call.  Jobs that
+/// need to synchronize between phases can use a std::barrier sized with
+/// size(), together with a BarrierJobException.
+class WorkerPool {
+ public:
+  using Job = std::function<void(std::size_t thread_index)>;
+
+  ///\brief Construct a pool
+  ///\param num_threads the total number of threads including the caller of
+  /// run(); zero selects std::thread::hardware_concurrency()
+  explicit WorkerPool(std::size_t num_threads = 0) {
+    if (num_threads == 0) {
+      num_threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    threads_.reserve(num_threads - 1);
+    for (std::size_t thread_index = 1; thread_index < num_threads;
+         ++thread_index) {
+      threads_.emplace_back([this, thread_index] { worker_loop(thread_index); });
+    }
+  }
+
+  WorkerPool(WorkerPool const&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  WorkerPool& operator=(WorkerPool const&) = delete;
+  WorkerPool& operator=(WorkerPool&&) = delete;
+
+  ///\brief Stop and join all worker threads
+  ~WorkerPool() {
+    {
+      std::lock_guard lock(mutex_);
+      is_stopping_ = true;
+    }
+    start_condition_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ///\brief return the number of threads that execute a job
+  [[nodiscard]] std::size_t size() const { return threads_.size() + 1; }
+
+  ///\brief Run a job on every thread of the pool and wait for completion
+  /// If any invocation throws, the first exception is rethrown here after all
+  /// threads have finished.  run() must not be called concurrently or from
+  /// inside a job.
+  ///\param job the function to run; it receives the thread index in
+  /// [0, size())
+  void run(Job const& job) {
+    {
+      std::lock_guard lock(mutex_);
+      job_ = &job;
+      pending_workers_ = threads_.size();
+      first_exception_ = nullptr;
+      ++generation_;
+    }
+    start_condition_.notify_all();
+    execute(job, 0);
+    std::unique_lock lock(mutex_);
+    done_condition_.wait(lock, [this] { return pending_workers_ == 0; });
+    job_ = nullptr;
+    if (first_exception_ != nullptr) {
+      std::rethrow_exception(std::exchange(first_exception_, nullptr));
+    }
+  }
+
+ private:
+  void worker_loop(std::size_t thread_index) {
+    uint64_t seen_generation{0};
+    while (true) {
+      Job const* job{nullptr};
+      {
+        std::unique_lock lock(mutex_);
+        start_condition_.wait(lock, [this, seen_generation] {
+          return is_stopping_ || generation_ != seen_generation;
+        });
+        if (is_stopping_) {
+          return;
+        }
+        seen_generation = generation_;
+        job = job_;
+      }
+      execute(*job, thread_index);
+      std::lock_guard lock(mutex_);
+      if (--pending_workers_ == 0) {
+        done_condition_.notify_one();
+      }
+    }
+  }
+
+  void execute(Job const& job, std::size_t thread_index) {
+    try {
+      job(thread_index);
+    } catch (...) {
+      std::lock_guard lock(mutex_);
+      if (first_exception_ == nullptr) {
+        first_exception_ = std::current_exception();
+      }
+    }
+  }
+
+  std::mutex mutex_{};
+  std::condition_variable start_condition_{};
+  std::condition_variable done_condition_{};
+  Job const* job_{nullptr};
+  uint64_t generation_{0};
+  std::size_t pending_workers_{0};
+  bool is_stopping_{false};
+  std::exception_ptr first_exception_{};
+  std::vector<std::thread> threads_{};
+};
+
+///\brief The first exception thrown by the threads of a job that
+/// synchronizes on a std::barrier
+/// A thread that lets an exception escape such a job never arrives at the
+/// barrier again and leaves the other threads waiting forever.  Instead, each
+/// phase of the job runs through capture() and the thread arrives at the
+/// barrier as usual.  The barrier completion reads has_exception() and turns
+/// it into the flag that ends the phase loop of every thread - a thread must
+/// not read it directly after the barrier, since a faster thread may already
+/// have thrown in the next phase.  The caller of WorkerPool::run then calls
+/// rethrow_if_any().
+class BarrierJobException {
+ public:
+  ///\brief Run one phase of a job and keep the exception it throws, if any
+  ///\param phase the function to run
+  template <typename Phase>
+  void capture(Phase&& phase) noexcept {
+    try {
+      std::forward<Phase>(phase)();
+    } catch (...) {
+      std::lock_guard lock(mutex_);
+      if (exception_ == nullptr) {
+        exception_ = std::current_exception();
+      }
+      has_exception_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  ///\brief return true if a phase has thrown; read it from the barrier
+  /// completion, where the arrival of every thread makes it exact
+  [[nodiscard]] bool has_exception() const {
+    return has_exception_.load(std::memory_order_relaxed);
+  }
+
+  ///\brief Rethrow the first captured exception, once the job has finished
+  void rethrow_if_any() {
+    if (has_exception()) {
+      has_exception_.store(false, std::memory_order_relaxed);
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+  }
+
+ private:
+  std::mutex mutex_{};
+  std::exception_ptr exception_{};
+  std::atomic<bool> has_exception_{false};
+};
+
+///\brief Split [0, size) into num_parts contiguous ranges of nearly equal
+/// length and return the range of one part
+///\param size the number of items
+///\param part the part to return, in [0, num_parts)
+///\param num_parts the number of parts
+///\return std::pair<std::size_t, std::size_t> the half open [begin, end)
+[[nodiscard]] inline std::pair<std::size_t, std::size_t> partition_range(
+    std::size_t size, std::size_t part, std::size_t num_parts) {
+  modern_cpp_template_assert(part < num_parts);
+  auto chunk = size / num_parts;
+  auto remainder = size % num_parts;
+  auto begin = part * chunk + std::min(part, remainder);
+  return {begin, begin + chunk + (part < remainder ? 1 : 0)};
+}
+
+///\brief Call a function for every index of [0, size), handing out chunks
+/// of consecutive indices to the threads of a pool as they become free
+/// Dynamic chunks balance loops whose iterations cost very different amounts
+/// of work, at the price of one atomic increment per chunk.
+///\param pool the threads to use
+///\param size the number of indices
+///\param chunk_size the number of indices a thread claims at a time
+///\param function called with the index and the thread index
+template <typename Function>
+void parallel_for(WorkerPool& pool, std::size_t size, std::size_t chunk_size,
+                  Function const& function) {
+  modern_cpp_template_assert(chunk_size > 0);
+  std::atomic<std::size_t> cursor{0};
+  pool.run([&](std::size_t thread_index) {
+    while (true) {
+      auto begin = cursor.fetch_add(chunk_size, std::memory_order_relaxed);
+      if (begin >= size) {
+        return;
+      }
+      auto end = std::min(begin + chunk_size, size);
+      for (auto index = begin; index < end; ++index) {
+        function(index, thread_index);
+      }
+    }
+  });
+}
+
+}  // namespace modern_cpp_template::algorithms
@@ -0,0 +1,119 @@
+///\file graph_factories.h
+///\author Jamie LaPointe (jamie.lapointe@gmail.com)
+///\brief Small deterministic graphs shared by the graph tests
+///\version 0.1
+///\date 2026-10-17
+///
+///\copyright Copyright (c) 2026
+///
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace modern_cpp_template::tests {
+
+using DefaultGraph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+
+///\brief Build a tree of ten German cities joined by nine roads, costed
+/// with their distances in km and rooted at Frankfurt (0)
+///\tparam Graph a graph type with add_edge(id, value, id, value, cost)
+///\return Graph
+template <typename Graph = DefaultGraph>
+[[nodiscard]] Graph make_city_graph() {
+  Graph graph;
+  graph.add_edge(0, "Frankfurt", 1, "Mannheim", 85);
+  graph.add_edge(0, "Frankfurt", 2, "Würzburg", 217);
+  graph.add_edge(0, "Frankfurt", 3, "Kassel", 173);
+  graph.add_edge(1, "Mannheim", 4, "Karlsruhe", 80);
+  graph.add_edge(2, "Würzburg", 5, "Nürnberg", 103);
+  graph.add_edge(2, "Würzburg", 6, "Erfurt", 186);
+  graph.add_edge(3, "Kassel", 7, "München", 502);
+  graph.add_edge(4, "Karlsruhe", 8, "Augsburg", 250);
+  graph.add_edge(5, "Nürnberg", 9, "Stuttgart", 183);
+  return graph;
+}
+
+///\brief Build a random multigraph: num_edges edges between uniformly drawn
+/// endpoints in [0, num_nodes), with empty values and zero costs
+/// Ids that no edge draws are missing from the graph, so a frozen copy has
+/// fewer nodes than num_nodes.
+///\tparam Graph a graph type with add_edge(id, value, id, value)
+///\param seed the seed of the generator
+///\param num_nodes the number of ids to draw from
+///\param num_edges the number of edges
+///\return Graph
+template <typename Graph = DefaultGraph>
+[[nodiscard]] Graph make_random_graph(uint64_t seed, int64_t num_nodes,
+                                      int64_t num_edges) {
+  std::mt19937_64 generator{seed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  Graph graph;
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    auto const head = node_distribution(generator);
+    auto const tail = node_distribution(generator);
+    graph.add_edge(head, "", tail, "");
+  }
+  return graph;
+}
+
+///\brief Build a random multigraph with random costs in [0, max_cost]
+/// Edge e < num_nodes starts at node e, so that every id exists and the ids
+/// are dense; the other endpoints are drawn uniformly.
+///\tparam Graph a graph type with add_edge(id, value, id, value, cost)
+///\param seed the seed of the generator
+///\param num_nodes the number of nodes, at most num_edges
+///\param num_edges the number of edges
+///\param max_cost the largest cost
+///\return Graph
+template <typename Graph = DefaultGraph>
+[[nodiscard]] Graph make_random_weighted_graph(uint64_t seed,
+                                               int64_t num_nodes,
+                                               int64_t num_edges,
+                                               int64_t max_cost) {
+  using CostType = typename Graph::CostType;
+  std::mt19937_64 generator{seed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  std::uniform_int_distribution<int64_t> cost_distribution{0, max_cost};
+  Graph graph;
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    auto const head = edge < num_nodes ? edge : node_distribution(generator);
+    auto const tail = node_distribution(generator);
+    auto const cost = static_cast<CostType>(cost_distribution(generator));
+    graph.add_edge(head, "", tail, "", cost);
+  }
+  return graph;
+}
+
+///\brief Build a random multigraph in which every id of [0, num_nodes)
+/// exists: each node first gets a self loop, valued with its id as a
+/// string, then num_edges edges join uniformly drawn endpoints
+///\tparam Graph a graph type with add_edge(id, value, id, value)
+///\param seed the seed of the generator
+///\param num_nodes the number of nodes
+///\param num_edges the number of edges on top of the self loops
+///\return Graph
+template <typename Graph = DefaultGraph>
+[[nodiscard]] Graph make_looped_random_graph(uint64_t seed, int64_t num_nodes,
+                                             int64_t num_edges) {
+  std::mt19937_64 generator{seed};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  Graph graph;
+  for (int64_t node = 0; node < num_nodes; ++node) {
+    graph.add_edge(node, std::to_string(node), node, std::to_string(node));
+  }
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    auto const head = node_distribution(generator);
+    auto const tail = node_distribution(generator);
+    graph.add_edge(head, "", tail, "");
+  }
+  return graph;
+}
+
+}  // namespace modern_cpp_template::tests
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "modern_cpp_template/bitmap.h"
+
+namespace {
+
+using modern_cpp_template::algorithms::Bitmap;
+
+// clang-format off
+TEST(BitmapTest, Basic00) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Bitmap bitmap(130);
+  ASSERT_EQ(bitmap.size(), 130U);
+  ASSERT_EQ(bitmap.words().size(), 3U);
+  ASSERT_EQ(bitmap.count(), 0U);
+
+  bitmap.set(0);
+  bitmap.set(63);
+  bitmap.set(64);
+  bitmap.set(129);
+  ASSERT_TRUE(bitmap.test(63));
+  ASSERT_FALSE(bitmap.test(62));
+  ASSERT_EQ(bitmap.count(), 4U);
+
+  bitmap.reset(63);
+  std::vector<std::size_t> set_bits;
+  bitmap.for_each_set_bit(
+      [&set_bits](std::size_t bit) { set_bits.push_back(bit); });
+  ASSERT_EQ(set_bits, (std::vector<std::size_t>{0, 64, 129}));
+
+  bitmap.clear();
+  ASSERT_EQ(bitmap.count(), 0U);
+  ASSERT_EXIT(bitmap.set(130), testing::KilledBySignal(SIGABRT), "");
+}
+
+}  // namespace
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/breadth_first_view.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using View =
+    modern_cpp_template::algorithms::undirected_graph::BreadthFirstView<Graph>;
+using modern_cpp_template::algorithms::undirected_graph::breadth_first_view;
+using modern_cpp_template::tests::make_looped_random_graph;
+
+static_assert(std::ranges::input_range<View>);
+static_assert(std::ranges::view<View>);
+
+///\brief the BFS order and depths, by a reference search over whole levels
+std::vector<std::pair<NodeIndex, std::size_t>> reference_order(
+    Graph const& graph, NodeIndex start) {
+  std::vector<std::pair<NodeIndex, std::size_t>> order;
+  std::vector<bool> is_visited(graph.number_of_nodes(), false);
+  std::vector<NodeIndex> level{start};
+  is_visited[static_cast<std::size_t>(start)] = true;
+  for (std::size_t depth = 0; !level.empty(); ++depth) {
+    std::vector<NodeIndex> next_level;
+    for (auto node : level) {
+      order.emplace_back(node, depth);
+      for (auto const& edge : graph.get_edges(node)) {
+        auto const tail = static_cast<std::size_t>(edge.tail_node_index);
+        if (!edge.is_removed() && !is_visited[tail]) {
+          is_visited[tail] = true;
+          next_level.push_back(edge.tail_node_index);
+        }
+      }
+    }
+    level = std::move(next_level);
+  }
+  return order;
+}
+
+// clang-format off
+TEST(BreadthFirstViewTest, MatchesBreadthFirstSearch) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_looped_random_graph(24, 300, 330);
+  Graph::VisitationContext context;
+  for (NodeIndex start = 0; start < 300; start += 11) {
+    std::vector<NodeIndex> expected;
+    graph.breadth_first_search(start, context, [&expected](Node const& node) {
+      expected.push_back(node.id);
+      return false;
+    });
+
+    std::vector<std::pair<NodeIndex, std::size_t>> order;
+    for (auto step : breadth_first_view(graph, start, context)) {
+      order.emplace_back(step.node->id, step.depth);
+    }
+    ASSERT_EQ(order, reference_order(graph, start));
+    ASSERT_EQ(order.size(), expected.size());
+    for (std::size_t position = 0; position < order.size(); ++position) {
+      ASSERT_EQ(order[position].first, expected[position]);
+    }
+  }
+}
+
+// clang-format off
+TEST(BreadthFirstViewTest, ComposesWithViews) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a path 0 - 1 - ... - 9 with a shortcut 0 - 5; edge 5 - 6 removed
+  Graph graph;
+  for (NodeIndex node = 0; node < 9; ++node) {
+    graph.add_edge(node, std::to_string(node), node + 1,
+                   std::to_string(node + 1));
+  }
+  graph.add_edge(0, "0", 5, "5");
+  graph.remove_edge(5, 6);
+  Graph::VisitationContext context;
+
+  std::vector<std::string> values;
+  for (auto step : breadth_first_view(graph, 0, context) | std::views::take(3)) {
+    values.push_back(step.node->value);
+  }
+  ASSERT_EQ(values, (std::vector<std::string>{"0", "1", "5"}));
+
+  std::vector<NodeIndex> within_two;
+  for (auto step : breadth_first_view(graph, 0, context) |
+                       std::views::take_while([](auto const& reached) {
+                         return reached.depth <= 2;
+                       })) {
+    within_two.push_back(step.node->id);
+  }
+  ASSERT_EQ(within_two, (std::vector<NodeIndex>{0, 1, 5, 2, 4}));
+
+  std::vector<std::pair<NodeIndex, std::size_t>> deep;
+  for (auto step : breadth_first_view(graph, 0, context) |
+                       std::views::filter([](auto const& reached) {
+                         return reached.depth >= 3;
+                       })) {
+    deep.emplace_back(step.node->id, step.depth);
+  }
+  ASSERT_EQ(deep, (std::vector<std::pair<NodeIndex, std::size_t>>{{3, 3}}));
+
+  // the search stops where the consumer stops: after take(2) the list of the
+  // start node has been scanned up to node 1 only
+  auto view = breadth_first_view(graph, 0, context);
+  auto prefix = view | std::views::take(2);
+  ASSERT_EQ(std::ranges::distance(prefix.begin(), prefix.end()), 2);
+  ASSERT_TRUE(context.is_visited(1));
+  ASSERT_FALSE(context.is_visited(5));
+
+  graph.remove_node(9);
+  auto removed_view = breadth_first_view(graph, 9, context);
+  ASSERT_TRUE(removed_view.begin() == removed_view.end());
+}
+
+}  // namespace
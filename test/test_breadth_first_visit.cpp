@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/breadth_first_visit.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::undirected_graph::breadth_first_visit;
+using modern_cpp_template::algorithms::undirected_graph::BreadthFirstVisitor;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::GraphTraits;
+using modern_cpp_template::tests::make_looped_random_graph;
+
+///\brief records every hook call as (hook, first, second)
+template <typename GraphType>
+struct RecordingVisitor : BreadthFirstVisitor<GraphType> {
+  using Vertex = typename GraphTraits<GraphType>::Vertex;
+
+  explicit RecordingVisitor(GraphType const& searched_graph)
+      : graph(searched_graph) {}
+
+  void discover_vertex(Vertex vertex) {
+    events.emplace_back('d', GraphTraits<GraphType>::node_index(graph, vertex),
+                        -1);
+  }
+
+  void examine_edge(Vertex source, Vertex target, int64_t /*cost*/) {
+    events.emplace_back('e', GraphTraits<GraphType>::node_index(graph, source),
+                        GraphTraits<GraphType>::node_index(graph, target));
+  }
+
+  void finish_vertex(Vertex vertex) {
+    events.emplace_back('f', GraphTraits<GraphType>::node_index(graph, vertex),
+                        -1);
+  }
+
+  GraphType const& graph;
+  std::vector<std::tuple<char, NodeIndex, NodeIndex>> events{};
+};
+
+// clang-format off
+TEST(BreadthFirstVisitTest, MatchesBreadthFirstSearch) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_looped_random_graph(23, 200, 300);
+  auto const csr_graph = freeze(graph);
+  Graph::VisitationContext context;
+  CsrGraph::VisitationContext csr_context;
+  for (NodeIndex start = 0; start < 200; start += 7) {
+    std::vector<NodeIndex> expected;
+    graph.breadth_first_search(start, context, [&expected](Node const& node) {
+      expected.push_back(node.id);
+      return false;
+    });
+
+    std::vector<NodeIndex> visited;
+    breadth_first_visit(graph, start, context,
+                        [&visited](NodeIndex node) { visited.push_back(node); });
+    ASSERT_EQ(visited, expected);
+
+    std::vector<NodeIndex> csr_visited;
+    breadth_first_visit(
+        csr_graph, start, csr_context,
+        [&csr_visited, &csr_graph](CsrGraph::LocalIndex local) {
+          csr_visited.push_back(csr_graph.original_id(local));
+        });
+    std::vector<NodeIndex> csr_expected;
+    csr_graph.breadth_first_search(start, [&csr_expected](Node const& node) {
+      csr_expected.push_back(node.id);
+      return false;
+    });
+    ASSERT_EQ(csr_visited, csr_expected);
+  }
+}
+
+// clang-format off
+TEST(BreadthFirstVisitTest, HooksAndEarlyExit) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // 0 - 1 - 2 and 0 - 3, plus a second edge between 1 and 0
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  graph.add_edge(1, "b", 2, "c");
+  graph.add_edge(0, "a", 3, "d");
+  graph.add_edge(1, "b", 0, "a");
+
+  RecordingVisitor<Graph> visitor(graph);
+  breadth_first_visit(graph, 0, visitor);
+  using Events = std::vector<std::tuple<char, NodeIndex, NodeIndex>>;
+  ASSERT_EQ(visitor.events,
+            (Events{{'d', 0, -1},
+                    {'e', 0, 1},
+                    {'d', 1, -1},
+                    {'e', 0, 3},
+                    {'d', 3, -1},
+                    {'e', 0, 1},
+                    {'f', 0, -1},
+                    {'e', 1, 0},
+                    {'e', 1, 2},
+                    {'d', 2, -1},
+                    {'e', 1, 0},
+                    {'f', 1, -1},
+                    {'e', 3, 0},
+                    {'f', 3, -1},
+                    {'e', 2, 1},
+                    {'f', 2, -1}}));
+
+  auto const csr_graph = freeze(graph);
+  RecordingVisitor<CsrGraph> csr_visitor(csr_graph);
+  breadth_first_visit(csr_graph, 0, csr_visitor);
+  ASSERT_EQ(csr_visitor.events, visitor.events);
+
+  // a discover hook returning true stops the search at once
+  std::vector<NodeIndex> visited;
+  breadth_first_visit(graph, 0, [&visited](NodeIndex node) {
+    visited.push_back(node);
+    return node == 1;
+  });
+  ASSERT_EQ(visited, (std::vector<NodeIndex>{0, 1}));
+  visited.clear();
+  breadth_first_visit(graph, 2, [&visited](NodeIndex node) {
+    visited.push_back(node);
+    return true;
+  });
+  ASSERT_EQ(visited, (std::vector<NodeIndex>{2}));
+
+  // removed edges are skipped
+  graph.remove_edge(0, 3);
+  visited.clear();
+  breadth_first_visit(graph, 0,
+                      [&visited](NodeIndex node) { visited.push_back(node); });
+  ASSERT_EQ(visited, (std::vector<NodeIndex>{0, 1, 2}));
+}
+
+
+// clang-format off
+TEST(BreadthFirstVisitTest, RemovedStartVisitsNothing) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_looped_random_graph(23, 200, 300);
+  ASSERT_TRUE(graph.remove_node(5));
+  Graph::VisitationContext context;
+  std::vector<NodeIndex> expected;
+  graph.breadth_first_search(5, context, [&expected](Node const& node) {
+    expected.push_back(node.id);
+    return false;
+  });
+  ASSERT_TRUE(expected.empty());
+
+  RecordingVisitor<Graph> visitor(graph);
+  breadth_first_visit(graph, 5, context, visitor);
+  ASSERT_TRUE(visitor.events.empty());
+  ASSERT_FALSE(context.is_visited(5));
+
+  // the removed node is not reached from its former neighbors either
+  std::vector<NodeIndex> visited;
+  breadth_first_visit(graph, 0, context,
+                      [&visited](NodeIndex node) { visited.push_back(node); });
+  graph.breadth_first_search(0, context, [&expected](Node const& node) {
+    expected.push_back(node.id);
+    return false;
+  });
+  ASSERT_EQ(visited, expected);
+  ASSERT_EQ(std::ranges::count(visited, 5), 0);
+}
+
+}  // namespace
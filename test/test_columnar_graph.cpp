@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/columnar_graph.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using ColumnarGraph =
+    modern_cpp_template::algorithms::undirected_graph::ColumnarGraph<
+        std::string, int64_t>;
+using ArenaGraph =
+    modern_cpp_template::algorithms::undirected_graph::ColumnarGraph<
+        std::string, int64_t,
+        modern_cpp_template::algorithms::undirected_graph::StringArena>;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::StringArena;
+using modern_cpp_template::tests::make_city_graph;
+
+// clang-format off
+TEST(ColumnarGraphTest, Columns) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_city_graph<ArenaGraph>();
+  ASSERT_EQ(graph.number_of_nodes(), 10U);
+  ASSERT_EQ(graph.number_of_edges(), 18U);
+  ASSERT_EQ(graph.values().size(), 10U);
+  ASSERT_EQ(graph.find_local(42), ArenaGraph::kInvalidLocalIndex);
+
+  auto local2 = graph.find_local(2);
+  ASSERT_EQ(graph.node(local2).value, "Würzburg");
+  ASSERT_EQ(graph.degree(local2), 3U);
+  std::vector<NodeIndex> neighbor_ids;
+  for (auto const& edge : graph.edges(local2)) {
+    neighbor_ids.push_back(graph.original_id(edge.target));
+  }
+  ASSERT_EQ(neighbor_ids, (std::vector<NodeIndex>{0, 5, 6}));
+
+  // sparse ids and repeated nodes keep their first value
+  graph.add_edge(1000, "Bremen", 0, "ignored", 1);
+  ASSERT_EQ(graph.number_of_nodes(), 11U);
+  ASSERT_EQ(graph.node(graph.find_local(0)).value, "Frankfurt");
+  ASSERT_EQ(graph.node(graph.find_local(1000)).value, "Bremen");
+
+  StringArena arena;
+  arena.push_back("");
+  arena.push_back("abc");
+  ASSERT_EQ(arena.size(), 2U);
+  ASSERT_EQ(arena.bytes(), 3U);
+  ASSERT_TRUE(arena[0].empty());
+  ASSERT_EQ(arena[1], "abc");
+  ASSERT_EXIT(static_cast<void>(arena[2]), testing::KilledBySignal(SIGABRT),
+              "");
+}
+
+// clang-format off
+TEST(ColumnarGraphTest, BreadthFirstSearchMatchesUndirectedGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{500};
+  std::mt19937_64 generator{9};
+  std::uniform_int_distribution<int64_t> node_distribution{0, kNodes - 1};
+  Graph expected;
+  ColumnarGraph graph;
+  ArenaGraph arena_graph;
+  for (int64_t edge = 0; edge < 2 * kNodes; ++edge) {
+    auto head = node_distribution(generator);
+    auto tail = edge < kNodes ? edge : node_distribution(generator);
+    expected.add_edge(head, std::to_string(head), tail, std::to_string(tail),
+                      edge);
+    graph.add_edge(head, std::to_string(head), tail, std::to_string(tail),
+                   edge);
+    arena_graph.add_edge(head, std::to_string(head), tail,
+                         std::to_string(tail), edge);
+  }
+
+  std::vector<std::string> expected_visits;
+  expected.breadth_first_search(7, [&expected_visits](Graph::Node const& node) {
+    expected_visits.push_back(node.value);
+    return false;
+  });
+
+  std::vector<std::string> visits;
+  graph.breadth_first_search(7, [&visits](ColumnarGraph::Node const& node) {
+    visits.push_back(node.value);
+    return false;
+  });
+  ASSERT_EQ(visits, expected_visits);
+  ASSERT_EQ(graph.visited().count(), visits.size());
+  ASSERT_TRUE(graph.is_visited(graph.find_local(7)));
+  graph.clear_visited();
+  ASSERT_EQ(graph.visited().count(), 0U);
+
+  ArenaGraph::VisitationContext context;
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    std::vector<std::string> arena_visits;
+    arena_graph.breadth_first_search(
+        7, context, [&arena_visits](ArenaGraph::Node const& node) {
+          arena_visits.emplace_back(node.value);
+          return false;
+        });
+    ASSERT_EQ(arena_visits, expected_visits);
+  }
+
+  // GraphTraits lets the shortest path algorithms run on the columns
+  auto expected_tree = dijkstra_shortest_paths(expected, 7);
+  auto tree = dijkstra_shortest_paths(arena_graph, 7);
+  for (int64_t node = 0; node < kNodes; ++node) {
+    ASSERT_EQ(tree.distances[arena_graph.find_local(node)],
+              expected_tree.distances[static_cast<std::size_t>(node)]);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/compressed_csr_graph.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CompressedCsrGraph =
+    modern_cpp_template::algorithms::undirected_graph::CompressedCsrGraph<
+        std::string, int64_t>;
+using LocalIndex = CompressedCsrGraph::LocalIndex;
+using modern_cpp_template::algorithms::undirected_graph::compress;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::internal::
+    StreamVByte;
+
+// clang-format off
+TEST(CompressedCsrGraphTest, StreamVByteRoundTrip) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::mt19937 generator{17};
+  std::uniform_int_distribution<int> width_distribution{0, 32};
+  for (std::size_t count = 0; count < 40; ++count) {
+    // gaps of every byte length, including zero gaps for parallel edges
+    std::vector<uint32_t> values;
+    uint32_t previous{0};
+    for (std::size_t position = 0; position < count; ++position) {
+      auto const width = width_distribution(generator);
+      auto const bits = static_cast<uint32_t>(generator()) >> 6U;
+      auto const gap = width == 0 ? 0U : bits >> (32 - width);
+      previous += gap;
+      values.push_back(previous);
+    }
+    std::vector<uint8_t> bytes{0xFF};  // lists start at arbitrary positions
+    auto const base = values.empty() ? 0U : values[count / 2] + 1;
+    StreamVByte::encode(values, base, bytes);
+    bytes.resize(bytes.size() + StreamVByte::kPadding, 0xFF);
+    std::vector<uint32_t> decoded(count);
+    StreamVByte::decode(bytes.data() + 1, count, base, decoded.data());
+    ASSERT_EQ(decoded, values) << count;
+  }
+}
+
+// clang-format off
+TEST(CompressedCsrGraphTest, MatchesCsrGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{2000};
+  std::mt19937_64 generator{23};
+  std::uniform_int_distribution<int64_t> node_distribution{0, kNodes - 1};
+  std::uniform_int_distribution<int64_t> near_distribution{-8, 8};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, 50};
+  Graph graph;
+  for (int64_t node = 0; node < kNodes; ++node) {
+    // mostly local edges plus a few long ones, and parallel edges
+    auto const near = std::clamp<int64_t>(node + near_distribution(generator),
+                                          0, kNodes - 1);
+    graph.add_edge(node, std::to_string(node), near, std::to_string(near),
+                   cost_distribution(generator));
+    auto const far = node_distribution(generator);
+    graph.add_edge(node, std::to_string(node), far, std::to_string(far),
+                   cost_distribution(generator));
+    graph.add_edge(node, std::to_string(node), far, std::to_string(far),
+                   cost_distribution(generator));
+  }
+  auto const csr_graph = freeze(graph);
+  auto const compressed = compress(csr_graph);
+  ASSERT_EQ(compressed.number_of_nodes(), csr_graph.number_of_nodes());
+  ASSERT_EQ(compressed.number_of_edges(), csr_graph.number_of_edges());
+  ASSERT_LT(compressed.encoded_bytes(), 2 * compressed.number_of_edges());
+
+  std::vector<LocalIndex> buffer;
+  for (LocalIndex local = 0; local < csr_graph.number_of_nodes(); ++local) {
+    std::vector<std::pair<LocalIndex, int64_t>> expected;
+    auto const csr_neighbors = csr_graph.neighbors(local);
+    auto const csr_costs = csr_graph.neighbor_costs(local);
+    for (std::size_t edge = 0; edge < csr_neighbors.size(); ++edge) {
+      expected.emplace_back(csr_neighbors[edge], csr_costs[edge]);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](auto const& lhs, auto const& rhs) {
+                       return lhs.first < rhs.first;
+                     });
+
+    std::vector<std::pair<LocalIndex, int64_t>> actual;
+    auto const neighbors = compressed.neighbors(local, buffer);
+    auto const costs = compressed.neighbor_costs(local);
+    ASSERT_EQ(neighbors.size(), compressed.degree(local));
+    for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+      actual.emplace_back(neighbors[edge], costs[edge]);
+    }
+    ASSERT_EQ(actual, expected);
+
+    actual.clear();
+    compressed.for_each_neighbor(local, [&actual](auto target, auto cost) {
+      actual.emplace_back(target, cost);
+    });
+    ASSERT_EQ(actual, expected);
+  }
+
+  std::vector<int64_t> csr_visits;
+  csr_graph.breadth_first_search(5, [&csr_visits](auto const& node) {
+    csr_visits.push_back(node.id);
+    return false;
+  });
+  std::vector<int64_t> visits;
+  compressed.breadth_first_search(5, [&visits](auto const& node) {
+    visits.push_back(node.id);
+    return false;
+  });
+  ASSERT_EQ(visits.front(), 5);
+  std::sort(csr_visits.begin(), csr_visits.end());
+  std::sort(visits.begin(), visits.end());
+  ASSERT_EQ(visits, csr_visits);
+
+  auto const expected_tree = dijkstra_shortest_paths(csr_graph, 5);
+  auto const tree = dijkstra_shortest_paths(compressed, 5);
+  ASSERT_EQ(tree.distances, expected_tree.distances);
+}
+
+}  // namespace
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "modern_cpp_template/concurrent_graph.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/epoch_reclamation.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using ConcurrentGraph =
+    modern_cpp_template::algorithms::undirected_graph::ConcurrentGraph<
+        std::string, int64_t>;
+using modern_cpp_template::algorithms::EpochDomain;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+
+void expect_same_graph(CsrGraph const& actual, CsrGraph const& expected) {
+  ASSERT_EQ(actual.number_of_nodes(), expected.number_of_nodes());
+  for (CsrGraph::LocalIndex local = 0; local < expected.number_of_nodes();
+       ++local) {
+    ASSERT_EQ(actual.node(local).id, expected.node(local).id);
+    ASSERT_EQ(actual.node(local).value, expected.node(local).value);
+  }
+  ASSERT_TRUE(std::equal(actual.offsets().begin(), actual.offsets().end(),
+                         expected.offsets().begin(), expected.offsets().end()));
+  ASSERT_TRUE(std::equal(actual.targets().begin(), actual.targets().end(),
+                         expected.targets().begin(), expected.targets().end()));
+  ASSERT_TRUE(std::equal(actual.costs().begin(), actual.costs().end(),
+                         expected.costs().begin(), expected.costs().end()));
+}
+
+// clang-format off
+TEST(ConcurrentGraphTest, PublishMatchesUndirectedGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::mt19937_64 generator{21};
+  std::uniform_int_distribution<int64_t> node_distribution{0, 300};
+  ConcurrentGraph concurrent_graph;
+  Graph graph;
+  auto reader = concurrent_graph.make_reader();
+  ASSERT_EQ(reader.pin()->number_of_nodes(), 0U);
+
+  for (uint64_t batch = 1; batch <= 5; ++batch) {
+    for (int edge = 0; edge < 200; ++edge) {
+      // sparse ids, so later batches insert nodes between existing ones
+      auto const head = node_distribution(generator) * 7;
+      auto const tail = node_distribution(generator) * 7;
+      auto const cost = node_distribution(generator);
+      concurrent_graph.add_edge(head, std::to_string(batch), tail,
+                                std::to_string(batch), cost);
+      graph.add_edge(head, std::to_string(batch), tail, std::to_string(batch),
+                     cost);
+    }
+    ASSERT_EQ(concurrent_graph.number_of_pending_edges(), 200U);
+    ASSERT_EQ(concurrent_graph.version(), batch - 1);
+    ASSERT_EQ(concurrent_graph.publish(), batch);
+    ASSERT_EQ(concurrent_graph.number_of_pending_edges(), 0U);
+
+    auto const guard = reader.pin();
+    ASSERT_EQ(guard.version(), batch);
+    expect_same_graph(*guard, freeze(graph));
+  }
+  ASSERT_EQ(concurrent_graph.publish(), 5U);
+}
+
+// clang-format off
+TEST(ConcurrentGraphTest, PinnedVersionsOutliveTheirReplacement) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ConcurrentGraph concurrent_graph;
+  concurrent_graph.add_edge(0, "a", 1, "b", 5);
+  concurrent_graph.publish();
+  auto first_reader = concurrent_graph.make_reader();
+  auto second_reader = concurrent_graph.make_reader();
+  {
+    auto const old_guard = first_reader.pin();
+    concurrent_graph.add_edge(1, "ignored", 2, "c", 6);
+    concurrent_graph.publish();
+    ASSERT_EQ(concurrent_graph.number_of_retired_versions(), 1U);
+
+    ASSERT_EQ(old_guard.version(), 1U);
+    ASSERT_EQ(old_guard->number_of_nodes(), 2U);
+    ASSERT_EQ(old_guard->number_of_edges(), 2U);
+    auto const new_guard = second_reader.pin();
+    ASSERT_EQ(new_guard.version(), 2U);
+    ASSERT_EQ(new_guard->number_of_nodes(), 3U);
+    ASSERT_EQ(new_guard->node(1).value, "b");
+    ASSERT_EQ(new_guard->node(2).value, "c");
+  }
+  ASSERT_EQ(concurrent_graph.publish(), 2U);
+  ASSERT_EQ(concurrent_graph.number_of_retired_versions(), 0U);
+
+  // a released slot is reused
+  EpochDomain<int> domain;
+  {
+    auto reader = domain.make_reader();
+    reader.enter();
+    domain.retire(new int{1});
+    ASSERT_EQ(domain.reclaim(), 1U);
+    reader.exit();
+    ASSERT_EQ(domain.reclaim(), 0U);
+  }
+  auto reader = domain.make_reader();
+  reader.enter();
+  domain.retire(new int{2});
+  ASSERT_EQ(domain.reclaim(), 1U);
+  reader.exit();
+}
+
+// clang-format off
+TEST(ConcurrentGraphTest, ReadersRunDuringPublishes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a growing path 0 - 1 - 2 - ...; every version must be a whole path
+  constexpr int64_t kBatches{200};
+  constexpr int64_t kBatchSize{10};
+  ConcurrentGraph concurrent_graph;
+  std::atomic<bool> is_done{false};
+  std::atomic<bool> is_consistent{true};
+  std::vector<std::thread> readers;
+  for (int thread = 0; thread < 3; ++thread) {
+    readers.emplace_back([&concurrent_graph, &is_done, &is_consistent] {
+      auto reader = concurrent_graph.make_reader();
+      uint64_t last_version{0};
+      while (!is_done.load()) {
+        auto const guard = reader.pin();
+        auto const& graph = *guard;
+        auto const edges = static_cast<int64_t>(guard.version()) * kBatchSize;
+        std::size_t reached{0};
+        if (graph.number_of_nodes() > 0) {
+          graph.breadth_first_search(0, [&reached](auto const& /*node*/) {
+            ++reached;
+            return false;
+          });
+        }
+        if (guard.version() < last_version ||
+            graph.number_of_edges() != static_cast<std::size_t>(2 * edges) ||
+            reached != graph.number_of_nodes() ||
+            (edges > 0 && graph.number_of_nodes() !=
+                              static_cast<std::size_t>(edges + 1))) {
+          is_consistent = false;
+        }
+        last_version = guard.version();
+      }
+    });
+  }
+  for (int64_t batch = 0; batch < kBatches; ++batch) {
+    for (int64_t edge = batch * kBatchSize; edge < (batch + 1) * kBatchSize;
+         ++edge) {
+      concurrent_graph.add_edge(edge, "", edge + 1, "");
+    }
+    concurrent_graph.publish();
+  }
+  is_done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  ASSERT_TRUE(is_consistent);
+  ASSERT_EQ(concurrent_graph.publish(), static_cast<uint64_t>(kBatches));
+  ASSERT_EQ(concurrent_graph.number_of_retired_versions(), 0U);
+}
+
+
+// clang-format off
+TEST(ConcurrentGraphTest, VersionDuringPublishes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // version() pins nothing, so it must not touch versions being retired
+  constexpr int64_t kBatches{300};
+  ConcurrentGraph concurrent_graph;
+  std::atomic<bool> is_done{false};
+  std::atomic<bool> is_monotonic{true};
+  std::thread watcher([&concurrent_graph, &is_done, &is_monotonic] {
+    uint64_t last_version{0};
+    while (!is_done.load()) {
+      auto const version = concurrent_graph.version();
+      if (version < last_version) {
+        is_monotonic = false;
+      }
+      last_version = version;
+    }
+  });
+  bool is_counted{true};
+  for (int64_t batch = 0; batch < kBatches; ++batch) {
+    concurrent_graph.add_edge(batch, "", batch + 1, "");
+    auto const expected = static_cast<uint64_t>(batch + 1);
+    if (concurrent_graph.publish() != expected ||
+        concurrent_graph.version() != expected) {
+      is_counted = false;
+    }
+  }
+  is_done = true;
+  watcher.join();
+  ASSERT_TRUE(is_counted);
+  ASSERT_TRUE(is_monotonic);
+  ASSERT_EQ(concurrent_graph.version(), static_cast<uint64_t>(kBatches));
+  ASSERT_EQ(concurrent_graph.number_of_retired_versions(), 0U);
+}
+
+}  // namespace
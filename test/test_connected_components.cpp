@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/connected_components.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using LocalIndex = CsrGraph::LocalIndex;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::connected_components;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+
+// clang-format off
+TEST(ConnectedComponentsTest, MatchesBreadthFirstSearch) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a giant component plus many small ones: fewer edges than nodes
+  constexpr int64_t kNodes{20000};
+  std::mt19937_64 generator{11};
+  std::uniform_int_distribution<int64_t> distribution{0, kNodes - 1};
+  Graph graph;
+  for (int64_t node = 0; node < kNodes; ++node) {
+    graph.add_edge(node, "", node, "");
+  }
+  for (int64_t edge = 0; edge < kNodes * 3 / 5; ++edge) {
+    graph.add_edge(distribution(generator), "", distribution(generator), "");
+  }
+  auto const csr_graph = freeze(graph);
+
+  // label every component with BFS, numbered by smallest local index
+  std::vector<LocalIndex> expected_labels(csr_graph.number_of_nodes(),
+                                          CsrGraph::kInvalidLocalIndex);
+  std::vector<std::size_t> expected_sizes;
+  for (LocalIndex local = 0; local < csr_graph.number_of_nodes(); ++local) {
+    if (expected_labels[local] != CsrGraph::kInvalidLocalIndex) {
+      continue;
+    }
+    auto label = static_cast<LocalIndex>(expected_sizes.size());
+    expected_sizes.push_back(0);
+    csr_graph.breadth_first_search(
+        csr_graph.original_id(local),
+        [&](CsrGraph::Node const& node) {
+          expected_labels[csr_graph.find_local(node.id)] = label;
+          ++expected_sizes.back();
+          return false;
+        });
+  }
+  ASSERT_GT(expected_sizes.size(), 1000U);
+
+  for (std::size_t num_threads : {1U, 2U, 4U}) {
+    WorkerPool pool(num_threads);
+    auto const components = connected_components(csr_graph, pool);
+    ASSERT_EQ(components.number_of_components(), expected_sizes.size());
+    ASSERT_EQ(components.labels, expected_labels);
+    ASSERT_EQ(components.sizes, expected_sizes);
+  }
+}
+
+// clang-format off
+TEST(ConnectedComponentsTest, SmallGraphs) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ASSERT_EQ(connected_components(CsrGraph{}).number_of_components(), 0U);
+
+  // a path whose ids link from the largest end first
+  Graph graph;
+  for (int64_t node = 9; node > 0; --node) {
+    graph.add_edge(node, "", node - 1, "");
+  }
+  graph.add_edge(20, "", 21, "");
+  auto const components = connected_components(freeze(graph));
+  ASSERT_EQ(components.sizes, (std::vector<std::size_t>{10, 2}));
+  ASSERT_EQ(components.labels,
+            (std::vector<LocalIndex>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1}));
+}
+
+}  // namespace
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/connectivity_index.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using NodeIndex = Graph::NodeIndex;
+using ConnectivityIndex =
+    modern_cpp_template::algorithms::ConnectivityIndex<NodeIndex>;
+
+// clang-format off
+TEST(ConnectivityIndexTest, UnionFind) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ConnectivityIndex index;
+  ASSERT_EQ(index.number_of_components(), 0U);
+  ASSERT_FALSE(index.contains(0));
+  ASSERT_FALSE(index.contains(-1));
+
+  ASSERT_TRUE(index.add_edge(0, 1));
+  ASSERT_TRUE(index.add_edge(5, 4));
+  ASSERT_FALSE(index.add_edge(1, 0));
+  index.add_node(7);
+  // 2, 3 and 6 were never added
+  ASSERT_EQ(index.number_of_nodes(), 5U);
+  ASSERT_EQ(index.number_of_components(), 3U);
+  ASSERT_FALSE(index.contains(3));
+  ASSERT_TRUE(index.connected(1, 0));
+  ASSERT_FALSE(index.connected(1, 4));
+  ASSERT_EQ(index.component_size(7), 1U);
+
+  ASSERT_TRUE(index.add_edge(0, 4));
+  ASSERT_TRUE(index.connected(1, 5));
+  ASSERT_EQ(index.component_size(5), 4U);
+  ASSERT_EQ(index.number_of_components(), 2U);
+  ASSERT_EXIT(static_cast<void>(index.find(3)),
+              testing::KilledBySignal(SIGABRT), "");
+
+  index.clear();
+  ASSERT_EQ(index.number_of_nodes(), 0U);
+  ASSERT_FALSE(index.contains(0));
+}
+
+// clang-format off
+TEST(ConnectivityIndexTest, UndirectedGraphMatchesBreadthFirstSearch) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{2000};
+  std::mt19937_64 generator{5};
+  std::uniform_int_distribution<NodeIndex> distribution{0, kNodes - 1};
+  Graph graph;
+  ASSERT_FALSE(graph.has_connectivity_index());
+  ASSERT_EXIT(static_cast<void>(graph.is_connected(0, 1)),
+              testing::KilledBySignal(SIGABRT), "");
+
+  // half the edges before the index exists, half maintained by add_edge
+  for (NodeIndex node = 0; node < kNodes; ++node) {
+    graph.add_edge(node, "", node, "");
+  }
+  for (int64_t edge = 0; edge < kNodes / 2; ++edge) {
+    if (edge == kNodes / 4) {
+      graph.enable_connectivity_index();
+    }
+    graph.add_edge(distribution(generator), "", distribution(generator), "");
+  }
+  ASSERT_TRUE(graph.has_connectivity_index());
+
+  Graph::VisitationContext context;
+  std::size_t components{0};
+  std::vector<bool> seen(kNodes, false);
+  for (NodeIndex node = 0; node < kNodes; ++node) {
+    std::vector<NodeIndex> component;
+    graph.breadth_first_search(node, context,
+                               [&component](Graph::Node const& found) {
+                                 component.push_back(found.id);
+                                 return false;
+                               });
+    ASSERT_EQ(graph.component_size(node), component.size());
+    for (auto member : component) {
+      ASSERT_TRUE(graph.is_connected(node, member));
+    }
+    if (!seen[static_cast<std::size_t>(node)]) {
+      ++components;
+      for (auto member : component) {
+        seen[static_cast<std::size_t>(member)] = true;
+      }
+    }
+    auto other = distribution(generator);
+    ASSERT_EQ(graph.is_connected(node, other),
+              std::find(component.begin(), component.end(), other) !=
+                  component.end());
+  }
+  ASSERT_EQ(graph.connectivity_index().number_of_components(), components);
+
+  graph.disable_connectivity_index();
+  ASSERT_FALSE(graph.has_connectivity_index());
+}
+
+}  // namespace
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::tests::make_city_graph;
+
+// clang-format off
+TEST(CsrGraphTest, Layout) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_city_graph();
+  auto csr_graph = freeze(graph);
+
+  ASSERT_EQ(csr_graph.number_of_nodes(), 10U);
+  ASSERT_EQ(csr_graph.number_of_edges(), 18U);
+  ASSERT_EQ(csr_graph.offsets().size(), 11U);
+  ASSERT_EQ(csr_graph.degree(csr_graph.find_local(0)), 3U);
+  ASSERT_EQ(csr_graph.degree(csr_graph.find_local(9)), 1U);
+  ASSERT_EQ(csr_graph.find_local(42), CsrGraph::kInvalidLocalIndex);
+
+  auto local2 = csr_graph.find_local(2);
+  ASSERT_EQ(csr_graph.node(local2).value, "Würzburg");
+  std::vector<NodeIndex> neighbor_ids;
+  for (auto neighbor : csr_graph.neighbors(local2)) {
+    neighbor_ids.push_back(csr_graph.original_id(neighbor));
+  }
+  ASSERT_EQ(neighbor_ids, (std::vector<NodeIndex>{0, 5, 6}));
+  auto costs = csr_graph.neighbor_costs(local2);
+  ASSERT_EQ(std::vector<int64_t>(costs.begin(), costs.end()),
+            (std::vector<int64_t>{217, 103, 186}));
+}
+
+// clang-format off
+TEST(CsrGraphTest, SparseIdsAreRemapped) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(1000000, "a", 7, "b");
+  graph.add_edge(7, "b", 123456789, "c");
+  auto csr_graph = freeze(graph);
+
+  ASSERT_EQ(csr_graph.number_of_nodes(), 3U);
+  ASSERT_EQ(csr_graph.find_local(7), 0U);
+  ASSERT_EQ(csr_graph.find_local(1000000), 1U);
+  ASSERT_EQ(csr_graph.find_local(123456789), 2U);
+  ASSERT_EQ(csr_graph.original_id(2), 123456789);
+}
+
+// clang-format off
+TEST(CsrGraphTest, BreadthFirstSearchMatchesSourceGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_city_graph();
+  auto csr_graph = freeze(graph);
+
+  std::vector<NodeIndex> expected_order;
+  graph.breadth_first_search(0, [&expected_order](Node const& node) {
+    expected_order.push_back(node.id);
+    return false;
+  });
+
+  // the snapshot is not mutated by a search, so it can be searched repeatedly
+  for (int run = 0; run < 2; ++run) {
+    std::vector<NodeIndex> order;
+    csr_graph.breadth_first_search(0, [&order](Node const& node) {
+      order.push_back(node.id);
+      return false;
+    });
+    ASSERT_EQ(order, expected_order);
+  }
+}
+
+// clang-format off
+TEST(CsrGraphTest, BreadthFirstSearchReturnEarly) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto csr_graph = freeze(make_city_graph());
+
+  std::vector<NodeIndex> order;
+  csr_graph.breadth_first_search(0, [&order](Node const& node) {
+    order.push_back(node.id);
+    return node.key() == 5;
+  });
+  ASSERT_EQ(order, (std::vector<NodeIndex>{0, 1, 2, 3, 4, 5}));
+  ASSERT_EXIT(csr_graph.breadth_first_search(42),
+              testing::KilledBySignal(SIGABRT), "");
+}
+
+}  // namespace
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/delta_stepping.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::
+    delta_stepping_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::ShortestPathTree;
+using modern_cpp_template::tests::make_random_weighted_graph;
+
+///\brief a CsrGraph whose neighbor scan throws at one vertex
+struct ThrowingGraph {
+  CsrGraph const& graph;
+  CsrGraph::LocalIndex throwing_vertex;
+};
+
+}  // namespace
+
+namespace modern_cpp_template::algorithms::undirected_graph {
+
+template <>
+struct GraphTraits<ThrowingGraph>
+    : GraphTraits<CsrGraph<std::string, int64_t>> {
+  using Graph = ThrowingGraph;
+  using Base = GraphTraits<CsrGraph<std::string, int64_t>>;
+
+  [[nodiscard]] static std::size_t number_of_nodes(Graph const& graph) {
+    return graph.graph.number_of_nodes();
+  }
+
+  [[nodiscard]] static Vertex vertex(Graph const& graph,
+                                     NodeIndex node_index) {
+    return Base::vertex(graph.graph, node_index);
+  }
+
+  template <typename Function>
+  static void for_each_neighbor(Graph const& graph, Vertex vertex,
+                                Function&& function) {
+    if (vertex == graph.throwing_vertex) {
+      throw std::runtime_error("neighbor scan failed");
+    }
+    Base::for_each_neighbor(graph.graph, vertex, function);
+  }
+};
+
+}  // namespace modern_cpp_template::algorithms::undirected_graph
+
+namespace {
+
+// clang-format off
+TEST(DeltaSteppingTest, MatchesDijkstra) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_random_weighted_graph<Graph>(11, 3000, 9000, 100);
+  auto csr_graph = freeze(graph);
+  auto expected = dijkstra_shortest_paths(graph, 0).distances;
+
+  for (std::size_t num_threads : {1U, 3U, 8U}) {
+    WorkerPool pool(num_threads);
+    // from "Dijkstra-like" through to "Bellman-Ford-like"
+    for (int64_t delta : {1, 7, 50, 100000}) {
+      ASSERT_EQ(delta_stepping_shortest_paths(csr_graph, 0, delta, pool),
+                expected);
+    }
+    ASSERT_EQ(delta_stepping_shortest_paths(graph, 0, 25, pool), expected);
+  }
+}
+
+// clang-format off
+TEST(DeltaSteppingTest, FloatingPointCosts) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  using DoubleGraph =
+      modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+          std::string, double>;
+  auto graph = make_random_weighted_graph<DoubleGraph>(11, 1000, 3000, 10);
+  auto csr_graph = freeze(graph);
+  auto expected = dijkstra_shortest_paths(csr_graph, 0).distances;
+
+  WorkerPool pool(4);
+  auto distances = delta_stepping_shortest_paths(csr_graph, 0, 2.5, pool);
+  ASSERT_EQ(distances.size(), expected.size());
+  for (std::size_t node = 0; node < expected.size(); ++node) {
+    ASSERT_DOUBLE_EQ(distances[node], expected[node]);
+  }
+}
+
+// clang-format off
+TEST(DeltaSteppingTest, LongPathKeepsBucketsBounded) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a path whose distance spans far more buckets than an edge does
+  static constexpr int64_t kPathLength{2000};
+  Graph graph;
+  for (int64_t node = 1; node < kPathLength; ++node) {
+    graph.add_edge(node - 1, "", node, "", 3 + node % 5);
+  }
+  auto csr_graph = freeze(graph);
+  WorkerPool pool(3);
+  ASSERT_EQ(delta_stepping_shortest_paths(csr_graph, 0, 2, pool),
+            dijkstra_shortest_paths(csr_graph, 0).distances);
+
+  // the ring only grows to the window of the largest jump
+  modern_cpp_template::algorithms::undirected_graph::internal::
+      DeltaSteppingThreadState<uint32_t>
+          state;
+  std::vector<uint32_t> taken;
+  for (std::size_t current = 0; current < 10000; ++current) {
+    state.push(current + 1, static_cast<uint32_t>(current), current);
+    state.push(current + 1 + current % 5, static_cast<uint32_t>(current),
+               current);
+    state.take(current, taken);
+    ASSERT_EQ(state.next_bucket(current), current + 1);
+  }
+  ASSERT_LE(state.buckets.size(), 8U);
+  // pushed into buckets 10000 (twice), 10002 and 10004
+  ASSERT_EQ(state.pending, 4U);
+}
+
+// clang-format off
+TEST(DeltaSteppingTest, ExceptionReachesCaller) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto csr_graph = freeze(make_random_weighted_graph<Graph>(11, 3000, 9000, 100));
+  ThrowingGraph throwing_graph{csr_graph, csr_graph.find_local(1500)};
+  for (std::size_t num_threads : {1U, 4U}) {
+    WorkerPool pool(num_threads);
+    ASSERT_THROW(
+        static_cast<void>(delta_stepping_shortest_paths(throwing_graph, 0, 7,
+                                                        pool)),
+        std::runtime_error);
+    // the pool is still usable afterwards
+    ASSERT_EQ(delta_stepping_shortest_paths(csr_graph, 0, 7, pool),
+              dijkstra_shortest_paths(csr_graph, 0).distances);
+  }
+}
+
+// clang-format off
+TEST(DeltaSteppingTest, UnreachableNodes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b", 3);
+  graph.add_edge(1, "b", 2, "c", 10);
+  graph.add_edge(0, "a", 2, "c", 20);
+  graph.add_edge(3, "d", 4, "e", 1);
+  constexpr auto kUnreachable = ShortestPathTree<Graph>::kUnreachable;
+
+  WorkerPool pool(2);
+  ASSERT_EQ(delta_stepping_shortest_paths(freeze(graph), 0, 5, pool),
+            (std::vector<int64_t>{0, 3, 13, kUnreachable, kUnreachable}));
+  ASSERT_EQ(delta_stepping_shortest_paths(graph, 4, 5, pool),
+            (std::vector<int64_t>{kUnreachable, kUnreachable, kUnreachable, 1,
+                                  0}));
+
+  // a removed source reaches nothing, not even itself
+  graph.remove_node(3);
+  ASSERT_EQ(delta_stepping_shortest_paths(graph, 3, 5, pool),
+            std::vector<int64_t>(5, kUnreachable));
+  ASSERT_EQ(delta_stepping_shortest_paths(graph, 4, 5, pool),
+            (std::vector<int64_t>{kUnreachable, kUnreachable, kUnreachable,
+                                  kUnreachable, 0}));
+}
+
+}  // namespace
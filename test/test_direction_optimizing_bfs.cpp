@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/direction_optimizing_bfs.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using LocalIndex = CsrGraph::LocalIndex;
+using modern_cpp_template::algorithms::undirected_graph::BfsDirection;
+using modern_cpp_template::algorithms::undirected_graph::
+    direction_optimizing_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::
+    DirectionOptimizingParameters;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::tests::make_random_graph;
+
+std::vector<int64_t> reference_levels(CsrGraph const& graph,
+                                      LocalIndex start) {
+  std::vector<int64_t> levels(graph.number_of_nodes(), -1);
+  std::vector<LocalIndex> queue{start};
+  levels[start] = 0;
+  for (std::size_t head = 0; head < queue.size(); ++head) {
+    for (auto neighbor : graph.neighbors(queue[head])) {
+      if (levels[neighbor] < 0) {
+        levels[neighbor] = levels[queue[head]] + 1;
+        queue.push_back(neighbor);
+      }
+    }
+  }
+  return levels;
+}
+
+void expect_valid_tree(CsrGraph const& graph, LocalIndex start,
+                       std::vector<int64_t> const& levels,
+                       std::vector<LocalIndex> const& parents) {
+  ASSERT_EQ(parents[start], start);
+  for (LocalIndex node = 0; node < graph.number_of_nodes(); ++node) {
+    if (levels[node] <= 0) {
+      continue;
+    }
+    auto parent = parents[node];
+    ASSERT_EQ(levels[parent], levels[node] - 1);
+    auto neighbors = graph.neighbors(node);
+    ASSERT_NE(std::find(neighbors.begin(), neighbors.end(), parent),
+              neighbors.end());
+  }
+}
+
+// clang-format off
+TEST(DirectionOptimizingBfsTest, MatchesClassicLevels) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(42, 2000, 6000));
+  auto start = graph.find_local(0);
+  auto expected_levels = reference_levels(graph, start);
+
+  // default heuristics, always top-down and always bottom-up
+  for (auto alpha : {15.0, 0.0, std::numeric_limits<double>::infinity()}) {
+    DirectionOptimizingParameters parameters{alpha, 18.0};
+    auto tree =
+        direction_optimizing_breadth_first_search(graph, 0, parameters);
+    ASSERT_EQ(tree.levels, expected_levels);
+    expect_valid_tree(graph, start, tree.levels, tree.parents);
+    auto max_level =
+        *std::max_element(expected_levels.begin(), expected_levels.end());
+    ASSERT_EQ(tree.level_directions.size(),
+              static_cast<std::size_t>(max_level));
+  }
+}
+
+// clang-format off
+TEST(DirectionOptimizingBfsTest, SwitchHeuristics) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(42, 2000, 20000));
+
+  DirectionOptimizingParameters top_down_only{0.0, 18.0};
+  auto top_down = direction_optimizing_breadth_first_search(graph, 0,
+                                                            top_down_only);
+  ASSERT_TRUE(std::all_of(
+      top_down.level_directions.begin(), top_down.level_directions.end(),
+      [](BfsDirection direction) { return direction == BfsDirection::kTopDown; }));
+
+  auto optimized = direction_optimizing_breadth_first_search(graph, 0);
+  ASSERT_NE(std::find(optimized.level_directions.begin(),
+                      optimized.level_directions.end(),
+                      BfsDirection::kBottomUp),
+            optimized.level_directions.end());
+  ASSERT_EQ(optimized.levels, top_down.levels);
+}
+
+// clang-format off
+TEST(DirectionOptimizingBfsTest, SwitchesAgainAfterBottomUp) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a dense cluster around node 0, a path of kPathLength nodes and a small
+  // dense cluster at its end: the edges of the first cluster must leave the
+  // unexplored count while it is searched bottom-up, or the second cluster
+  // looks too small to switch to bottom-up again
+  static constexpr int64_t kLargeCluster{400};
+  static constexpr int64_t kPathLength{30};
+  static constexpr int64_t kSmallCluster{300};
+  std::mt19937_64 generator{2};
+  Graph graph;
+  auto add_cluster = [&graph, &generator](int64_t first, int64_t size,
+                                          int64_t num_edges) {
+    std::uniform_int_distribution<int64_t> distribution{first,
+                                                        first + size - 1};
+    for (int64_t node = first + 1; node < first + size; ++node) {
+      graph.add_edge(node - 1, "", node, "");
+    }
+    for (int64_t edge = 0; edge < num_edges; ++edge) {
+      graph.add_edge(distribution(generator), "", distribution(generator), "");
+    }
+  };
+  add_cluster(0, kLargeCluster, 16000);
+  for (int64_t node = kLargeCluster; node < kLargeCluster + kPathLength;
+       ++node) {
+    graph.add_edge(node - 1, "", node, "");
+  }
+  auto const small_cluster = kLargeCluster + kPathLength;
+  graph.add_edge(small_cluster - 1, "", small_cluster, "");
+  add_cluster(small_cluster, kSmallCluster, 900);
+  auto const csr_graph = freeze(graph);
+
+  auto tree = direction_optimizing_breadth_first_search(csr_graph, 0);
+  ASSERT_EQ(tree.levels, reference_levels(csr_graph, csr_graph.find_local(0)));
+  auto const& directions = tree.level_directions;
+  ASSERT_EQ(directions[1], BfsDirection::kBottomUp);
+  // the path is searched top-down
+  ASSERT_EQ(directions[static_cast<std::size_t>(kPathLength / 2)],
+            BfsDirection::kTopDown);
+  ASSERT_NE(std::find(directions.begin() + kPathLength, directions.end(),
+                      BfsDirection::kBottomUp),
+            directions.end());
+}
+
+// clang-format off
+TEST(DirectionOptimizingBfsTest, UnreachableNodes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  graph.add_edge(2, "c", 3, "d");
+  auto csr_graph = freeze(graph);
+  auto tree = direction_optimizing_breadth_first_search(csr_graph, 0);
+  ASSERT_EQ(tree.levels, (std::vector<int64_t>{0, 1, -1, -1}));
+  ASSERT_EQ(tree.parents[3], CsrGraph::kInvalidLocalIndex);
+}
+
+}  // namespace
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::internal::
+    kMaxEdgeSlices;
+using modern_cpp_template::algorithms::undirected_graph::internal::
+    slice_edges;
+
+std::vector<Entry> make_random_edges(int64_t num_nodes, int64_t num_edges) {
+  std::mt19937_64 generator{5};
+  std::uniform_int_distribution<int64_t> node_distribution{0, num_nodes - 1};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, 100};
+  std::vector<Entry> edges;
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    edges.push_back({node_distribution(generator),
+                     node_distribution(generator),
+                     cost_distribution(generator)});
+  }
+  return edges;
+}
+
+std::vector<std::string> make_values(int64_t num_nodes) {
+  std::vector<std::string> values;
+  for (int64_t node = 0; node < num_nodes; ++node) {
+    values.push_back("node " + std::to_string(node));
+  }
+  return values;
+}
+
+void expect_same_graph(Graph const& expected, Graph const& actual) {
+  ASSERT_EQ(expected.number_of_nodes(), actual.number_of_nodes());
+  for (auto const& [id, node] : expected.node_map()) {
+    ASSERT_EQ(actual.get_node(id).value, node.value);
+    auto const& expected_edges = expected.get_edges(id);
+    auto const& actual_edges = actual.get_edges(id);
+    ASSERT_EQ(actual_edges.size(), expected_edges.size());
+    ASSERT_EQ(actual_edges.capacity(), actual_edges.size());
+    for (std::size_t edge = 0; edge < expected_edges.size(); ++edge) {
+      ASSERT_EQ(actual_edges[edge].head_node_index,
+                expected_edges[edge].head_node_index);
+      ASSERT_EQ(actual_edges[edge].tail_node_index,
+                expected_edges[edge].tail_node_index);
+      ASSERT_EQ(actual_edges[edge].cost, expected_edges[edge].cost);
+    }
+  }
+}
+
+// clang-format off
+TEST(EdgeListTest, MatchesAddEdge) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{500};
+  auto edges = make_random_edges(kNodes, 3000);
+  edges.push_back({7, 7, 3});  // self loop
+  auto values = make_values(kNodes);
+
+  Graph expected;
+  for (auto const& edge : edges) {
+    expected.add_edge(edge.head, values[static_cast<std::size_t>(edge.head)],
+                      edge.tail, values[static_cast<std::size_t>(edge.tail)],
+                      edge.cost);
+  }
+  ASSERT_EQ(expected.number_of_nodes(), static_cast<std::size_t>(kNodes));
+
+  auto built = build_undirected_graph(std::span<Entry const>(edges), values);
+  expect_same_graph(expected, built);
+
+  for (std::size_t num_threads : {2U, 5U}) {
+    WorkerPool pool(num_threads);
+    expect_same_graph(expected, build_undirected_graph(
+                                    std::span<Entry const>(edges), values, pool));
+  }
+}
+
+// clang-format off
+TEST(EdgeListTest, CsrMatchesFreeze) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{300};
+  auto edges = make_random_edges(kNodes, 2000);
+  auto values = make_values(kNodes);
+  auto expected =
+      freeze(build_undirected_graph(std::span<Entry const>(edges), values));
+
+  WorkerPool pool(3);
+  for (auto const& csr_graph :
+       {build_csr_graph(std::span<Entry const>(edges), values),
+        build_csr_graph(std::span<Entry const>(edges), values, pool)}) {
+    ASSERT_EQ(csr_graph.number_of_nodes(), expected.number_of_nodes());
+    ASSERT_TRUE(std::equal(csr_graph.offsets().begin(),
+                           csr_graph.offsets().end(),
+                           expected.offsets().begin()));
+    ASSERT_TRUE(std::equal(csr_graph.targets().begin(),
+                           csr_graph.targets().end(),
+                           expected.targets().begin()));
+    ASSERT_TRUE(std::equal(csr_graph.costs().begin(), csr_graph.costs().end(),
+                           expected.costs().begin()));
+    ASSERT_EQ(csr_graph.node(42).value, "node 42");
+    ASSERT_EQ(csr_graph.find_local(42), 42U);
+  }
+}
+
+// clang-format off
+TEST(EdgeListTest, MoreThreadsThanEdges) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // most slices are empty; the entries of node 1 come from different slices
+  std::vector<Entry> edges{{0, 1, 4}, {1, 2, 5}, {1, 1, 6}};
+  auto values = make_values(4);
+  auto expected = build_csr_graph(std::span<Entry const>(edges), values);
+  WorkerPool pool(8);
+  auto csr_graph = build_csr_graph(std::span<Entry const>(edges), values, pool);
+  ASSERT_TRUE(std::equal(csr_graph.targets().begin(), csr_graph.targets().end(),
+                         expected.targets().begin(), expected.targets().end()));
+  ASSERT_TRUE(std::equal(csr_graph.costs().begin(), csr_graph.costs().end(),
+                         expected.costs().begin(), expected.costs().end()));
+  auto neighbors = csr_graph.neighbors(1);
+  ASSERT_EQ(std::vector<CsrGraph::LocalIndex>(neighbors.begin(),
+                                              neighbors.end()),
+            (std::vector<CsrGraph::LocalIndex>{0, 2, 1, 1}));
+  ASSERT_TRUE(csr_graph.neighbors(3).empty());
+}
+
+// clang-format off
+TEST(EdgeListTest, MoreThreadsThanSlices) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // the threads past kMaxEdgeSlices only help summing the row positions
+  constexpr int64_t kNodes{200};
+  auto edges = make_random_edges(kNodes, 1000);
+  auto values = make_values(kNodes);
+  auto expected = build_csr_graph(std::span<Entry const>(edges), values);
+
+  WorkerPool pool(kMaxEdgeSlices + 3);
+  auto slices = slice_edges(std::span<Entry const>(edges),
+                            static_cast<std::size_t>(kNodes), pool);
+  ASSERT_EQ(slices.row_positions.size(), kMaxEdgeSlices);
+
+  auto csr_graph = build_csr_graph(std::span<Entry const>(edges), values, pool);
+  ASSERT_TRUE(std::equal(csr_graph.offsets().begin(),
+                         csr_graph.offsets().end(), expected.offsets().begin(),
+                         expected.offsets().end()));
+  ASSERT_TRUE(std::equal(csr_graph.targets().begin(), csr_graph.targets().end(),
+                         expected.targets().begin(), expected.targets().end()));
+  ASSERT_TRUE(std::equal(csr_graph.costs().begin(), csr_graph.costs().end(),
+                         expected.costs().begin(), expected.costs().end()));
+}
+
+// clang-format off
+TEST(EdgeListTest, IsolatedNodesAndBadIds) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::vector<Entry> edges{{0, 1, 4}, {1, 2, 5}};
+  auto graph = build_undirected_graph(std::span<Entry const>(edges),
+                                      make_values(5));
+  ASSERT_EQ(graph.number_of_nodes(), 5U);
+  ASSERT_EQ(graph.get_node(4).value, "node 4");
+  ASSERT_TRUE(graph.get_edges(4).empty());
+  ASSERT_EQ(graph.get_edges(1).size(), 2U);
+
+  auto csr_graph =
+      build_csr_graph(std::span<Entry const>(edges), make_values(5));
+  ASSERT_EQ(csr_graph.degree(3), 0U);
+  ASSERT_EQ(csr_graph.number_of_edges(), 4U);
+
+  edges.push_back({2, 5, 1});
+  ASSERT_EXIT(auto unused = build_csr_graph(std::span<Entry const>(edges),
+                                            make_values(5)),
+              testing::KilledBySignal(SIGABRT), "");
+}
+
+}  // namespace
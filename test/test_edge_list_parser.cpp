@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/edge_list_parser.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using Options = modern_cpp_template::algorithms::undirected_graph::
+    EdgeListParseOptions<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::EdgeListFormat;
+using modern_cpp_template::algorithms::undirected_graph::read_edge_list;
+
+std::vector<std::tuple<int64_t, int64_t, int64_t>> as_tuples(
+    std::vector<Entry> const& edges) {
+  std::vector<std::tuple<int64_t, int64_t, int64_t>> tuples;
+  for (auto const& edge : edges) {
+    tuples.emplace_back(edge.head, edge.tail, edge.cost);
+  }
+  return tuples;
+}
+
+std::string make_large_edge_list(int64_t num_edges) {
+  std::string text = "# generated\n";
+  for (int64_t edge = 0; edge < num_edges; ++edge) {
+    text += std::to_string(edge % 997) + "\t" + std::to_string(edge % 13) +
+            " " + std::to_string(edge) + "\n";
+    if (edge % 100 == 0) {
+      text += "% comment\n\n";
+    }
+  }
+  return text;
+}
+
+// clang-format off
+TEST(EdgeListParserTest, Whitespace) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::istringstream input(
+      "# comment\n"
+      "0 1 5\n"
+      "  1\t2\t7  \r\n"
+      "\n"
+      "% another comment\n"
+      "2 4\n"
+      "3 0 9");
+  Options options;
+  options.default_cost = 42;
+  auto parsed = read_edge_list(input, options);
+  ASSERT_EQ(parsed.number_of_nodes, 5U);
+  ASSERT_EQ(as_tuples(parsed.edges),
+            (std::vector<std::tuple<int64_t, int64_t, int64_t>>{
+                {0, 1, 5}, {1, 2, 7}, {2, 4, 42}, {3, 0, 9}}));
+}
+
+// clang-format off
+TEST(EdgeListParserTest, Csv) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::istringstream input("# head,tail,cost\n0,1,5\n1 , 2 ,7\n2,3\n");
+  Options options;
+  options.format = EdgeListFormat::kCsv;
+  auto parsed = read_edge_list(input, options);
+  ASSERT_EQ(as_tuples(parsed.edges),
+            (std::vector<std::tuple<int64_t, int64_t, int64_t>>{
+                {0, 1, 5}, {1, 2, 7}, {2, 3, 1}}));
+
+  std::istringstream whitespace_is_not_csv("0 1 5\n");
+  ASSERT_THROW(auto unused = read_edge_list(whitespace_is_not_csv, options),
+               std::runtime_error);
+}
+
+// clang-format off
+TEST(EdgeListParserTest, MatrixMarket) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::istringstream input(
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "% a comment\n"
+      "6 6 3\n"
+      "2 1 1.5\n"
+      "3 2 2e1\n"
+      "4 1 3\n");
+  modern_cpp_template::algorithms::undirected_graph::EdgeListParseOptions<
+      double>
+      options;
+  options.format = EdgeListFormat::kMatrixMarket;
+  auto parsed = read_edge_list(input, options);
+  // the dimension counts isolated nodes 4 and 5 too
+  ASSERT_EQ(parsed.number_of_nodes, 6U);
+  ASSERT_EQ(parsed.edges.size(), 3U);
+  ASSERT_EQ(parsed.edges[0].head, 1);
+  ASSERT_EQ(parsed.edges[0].tail, 0);
+  ASSERT_DOUBLE_EQ(parsed.edges[0].cost, 1.5);
+  ASSERT_DOUBLE_EQ(parsed.edges[1].cost, 20.0);
+
+  std::istringstream pattern(
+      "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n1 2\n");
+  options.default_cost = 0.5;
+  parsed = read_edge_list(pattern, options);
+  ASSERT_EQ(parsed.edges.size(), 1U);
+  ASSERT_DOUBLE_EQ(parsed.edges[0].cost, 0.5);
+
+  std::istringstream dense("%%MatrixMarket matrix array real general\n");
+  ASSERT_THROW(auto unused = read_edge_list(dense, options),
+               std::runtime_error);
+  std::istringstream zero_based(
+      "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n0 1\n");
+  ASSERT_THROW(auto unused = read_edge_list(zero_based, options),
+               std::runtime_error);
+}
+
+// clang-format off
+TEST(EdgeListParserTest, ChunksAndThreadsDoNotChangeTheResult) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto text = make_large_edge_list(5000);
+  std::istringstream reference_input(text);
+  auto expected = read_edge_list(reference_input, Options{});
+  ASSERT_EQ(expected.edges.size(), 5000U);
+  ASSERT_EQ(expected.number_of_nodes, 997U);
+
+  for (std::size_t num_threads : {1U, 4U}) {
+    WorkerPool pool(num_threads);
+    // chunks smaller than a line force the buffer to grow
+    for (std::size_t chunk_size : {3U, 64U, 4096U}) {
+      Options options;
+      options.chunk_size = chunk_size;
+      std::istringstream input(text);
+      auto parsed = read_edge_list(input, options, pool);
+      ASSERT_EQ(parsed.number_of_nodes, expected.number_of_nodes);
+      ASSERT_EQ(as_tuples(parsed.edges), as_tuples(expected.edges));
+    }
+  }
+
+  std::istringstream input(text);
+  auto parsed = read_edge_list(input, Options{});
+  std::vector<std::string> values(parsed.number_of_nodes);
+  auto csr_graph = build_csr_graph(
+      std::span<Entry const>(parsed.edges), std::move(values));
+  ASSERT_EQ(csr_graph.number_of_edges(), 10000U);
+}
+
+// clang-format off
+TEST(EdgeListParserTest, ErrorsNameTheLine) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto text = make_large_edge_list(300);
+  text += "7 x 3\n";
+  auto const bad_line = static_cast<std::size_t>(
+      std::count(text.begin(), text.end(), '\n'));
+  text += make_large_edge_list(300);
+
+  WorkerPool pool(3);
+  Options options;
+  options.chunk_size = 256;
+  std::istringstream input(text);
+  try {
+    auto unused = read_edge_list(input, options, pool);
+    FAIL() << "expected a parse error";
+  } catch (std::runtime_error const& error) {
+    ASSERT_EQ(std::string(error.what()),
+              "edge list line " + std::to_string(bad_line) +
+                  ": cannot parse \"7 x 3\"");
+  }
+
+  for (auto const* bad_text :
+       {"1 -2\n", "1\n", "1 2 3 4\n", "12345678901234567890 1\n"}) {
+    std::istringstream bad_input(bad_text);
+    ASSERT_THROW(auto unused = read_edge_list(bad_input, Options{}),
+                 std::runtime_error);
+  }
+}
+
+}  // namespace
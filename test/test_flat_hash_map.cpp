@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/flat_hash_map.h"
+#include "modern_cpp_template/memory_resources.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using modern_cpp_template::algorithms::FlatHashMap;
+using modern_cpp_template::algorithms::SizeClassPoolResource;
+using modern_cpp_template::algorithms::undirected_graph::
+    build_undirected_graph;
+using modern_cpp_template::algorithms::undirected_graph::EdgeListEntry;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::UndirectedGraph;
+
+using FlatGraph =
+    UndirectedGraph<std::string, int64_t, std::allocator<std::byte>,
+                    FlatHashMap>;
+
+// clang-format off
+TEST(FlatHashMapTest, MatchesStdMap) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  FlatHashMap<int64_t, int64_t> map;
+  std::map<int64_t, int64_t> expected;
+  std::mt19937_64 generator{11};
+  std::uniform_int_distribution<int64_t> key_distribution{-2000, 2000};
+  std::uniform_int_distribution<int> operation_distribution{0, 3};
+  for (int step = 0; step < 50000; ++step) {
+    auto key = key_distribution(generator);
+    switch (operation_distribution(generator)) {
+      case 0:
+        ASSERT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 1:
+        ASSERT_EQ(map.try_emplace(key, step).second,
+                  expected.try_emplace(key, step).second);
+        break;
+      default:
+        map[key] += step;
+        expected[key] += step;
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  std::size_t iterated{0};
+  for (auto const& [key, value] : map) {
+    ASSERT_EQ(expected.at(key), value);
+    ++iterated;
+  }
+  ASSERT_EQ(iterated, expected.size());
+  for (int64_t key = -2100; key <= 2100; ++key) {
+    auto found = map.find(key);
+    ASSERT_EQ(found != map.end(), expected.contains(key));
+    if (found != map.end()) {
+      ASSERT_EQ(found->second, expected[key]);
+    }
+  }
+
+  for (auto position = map.begin(); position != map.end();) {
+    position = position->first % 2 == 0 ? map.erase(position)
+                                        : std::next(position);
+  }
+  std::erase_if(expected, [](auto const& entry) {
+    return entry.first % 2 == 0;
+  });
+  ASSERT_EQ(map.size(), expected.size());
+  ASSERT_FALSE(map.contains(0));
+
+  auto copy = map;
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.find(1), map.end());
+  ASSERT_EQ(copy.size(), expected.size());
+  auto moved = std::move(copy);
+  for (auto const& [key, value] : expected) {
+    ASSERT_EQ(moved.find(key)->second, value);
+  }
+}
+
+// clang-format off
+TEST(FlatHashMapTest, ReserveKeepsReferences) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  FlatHashMap<int32_t, std::string> map;
+  map.reserve(1000);
+  auto const capacity = map.capacity();
+  auto& first = map[0];
+  first = "first";
+  for (int32_t key = 1; key < 1000; ++key) {
+    map.try_emplace(key, std::to_string(key));
+  }
+  ASSERT_EQ(map.capacity(), capacity);
+  ASSERT_EQ(&first, &map.find(0)->second);
+
+  // erasing and inserting forever must not grow the table
+  for (int32_t key = 1000; key < 100000; ++key) {
+    map.erase(key - 999);
+    map.try_emplace(key, "x");
+  }
+  ASSERT_EQ(map.size(), 1000U);
+  ASSERT_EQ(map.capacity(), capacity);
+}
+
+// clang-format off
+TEST(FlatHashMapTest, UndirectedGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kNodes{400};
+  std::mt19937_64 generator{3};
+  std::uniform_int_distribution<int64_t> node_distribution{0, kNodes - 1};
+  std::vector<EdgeListEntry<int64_t>> edges;
+  std::vector<std::string> values;
+  for (int64_t node = 0; node < kNodes; ++node) {
+    edges.push_back({node, node_distribution(generator), node});
+    values.push_back(std::to_string(node));
+  }
+
+  FlatGraph graph;
+  UndirectedGraph<std::string, int64_t> expected;
+  for (auto const& edge : edges) {
+    graph.add_edge(edge.head, values[static_cast<std::size_t>(edge.head)],
+                   edge.tail, values[static_cast<std::size_t>(edge.tail)],
+                   edge.cost);
+    expected.add_edge(edge.head, values[static_cast<std::size_t>(edge.head)],
+                      edge.tail, values[static_cast<std::size_t>(edge.tail)],
+                      edge.cost);
+  }
+  auto built = build_undirected_graph<FlatHashMap>(
+      std::span<EdgeListEntry<int64_t> const>(edges), values);
+
+  for (auto const* flat_graph : {&graph, &built}) {
+    ASSERT_EQ(flat_graph->number_of_nodes(), expected.number_of_nodes());
+    for (auto const& [id, node] : expected.node_map()) {
+      ASSERT_EQ(flat_graph->get_node(id).value, node.value);
+      ASSERT_EQ(flat_graph->get_edges(id).size(),
+                expected.get_edges(id).size());
+    }
+    FlatGraph::VisitationContext context;
+    std::vector<int64_t> visited;
+    flat_graph->breadth_first_search(0, context,
+                                     [&visited](auto const& node) {
+                                       visited.push_back(node.id);
+                                       return false;
+                                     });
+    decltype(visited) expected_visited;
+    expected.breadth_first_search(0, context,
+                                  [&expected_visited](auto const& node) {
+                                    expected_visited.push_back(node.id);
+                                    return false;
+                                  });
+    ASSERT_EQ(visited, expected_visited);
+  }
+  ASSERT_EQ(freeze(graph).number_of_edges(),
+            freeze(expected).number_of_edges());
+
+  // the maps allocate from the graph's memory resource
+  SizeClassPoolResource pool;
+  UndirectedGraph<std::string, int64_t, std::pmr::polymorphic_allocator<>,
+                  FlatHashMap>
+      pmr_graph(&pool);
+  pmr_graph.add_edge(0, "zero", 1, "one", 5);
+  ASSERT_GT(pool.bytes_reserved(), 0U);
+  ASSERT_EQ(pmr_graph.get_allocator().resource(), &pool);
+  ASSERT_EQ(pmr_graph.get_edges(1).get_allocator().resource(), &pool);
+}
+
+}  // namespace
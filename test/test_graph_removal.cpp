@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/flat_hash_map.h"
+#include "modern_cpp_template/k_core.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using FlatGraph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t, std::allocator<std::byte>,
+        modern_cpp_template::algorithms::FlatHashMap>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::undirected_graph::degree_statistics;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+
+///\brief the live adjacency of a graph as sorted (head, tail, cost) triples
+template <typename GraphType>
+std::vector<std::tuple<NodeIndex, NodeIndex, int64_t>> live_edges(
+    GraphType const& graph) {
+  std::vector<std::tuple<NodeIndex, NodeIndex, int64_t>> edges;
+  for (auto const& [node_index, node_edges] : graph.adjacency_map()) {
+    for (auto const& edge : node_edges) {
+      if (!edge.is_removed()) {
+        edges.emplace_back(node_index, edge.tail_node_index, edge.cost);
+      }
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+template <typename GraphType>
+std::vector<NodeIndex> reached_nodes(GraphType& graph, NodeIndex start) {
+  std::vector<NodeIndex> reached;
+  typename GraphType::VisitationContext context;
+  graph.breadth_first_search(start, context, [&reached](Node const& node) {
+    reached.push_back(node.id);
+    return false;
+  });
+  std::sort(reached.begin(), reached.end());
+  return reached;
+}
+
+// clang-format off
+TEST(GraphRemovalTest, RemoveEdge) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.set_compaction_threshold(1.0);
+  graph.add_edge(0, "a", 1, "b", 5);
+  graph.add_edge(1, "b", 2, "c", 6);
+  graph.add_edge(0, "a", 1, "b", 7);
+  graph.add_edge(2, "c", 2, "c", 8);
+  graph.enable_connectivity_index();
+
+  ASSERT_FALSE(graph.remove_edge(0, 2));
+  ASSERT_TRUE(graph.has_connectivity_index());
+  ASSERT_TRUE(graph.remove_edge(1, 0));
+  ASSERT_FALSE(graph.has_connectivity_index());
+  // the first parallel edge goes, along with its own mirror
+  ASSERT_EQ(graph.degree(0), 1U);
+  ASSERT_EQ(graph.degree(1), 2U);
+  ASSERT_EQ(graph.number_of_removed_edges(), 2U);
+  ASSERT_EQ(graph.number_of_removed_edges(0), 1U);
+  ASSERT_EQ(live_edges(graph),
+            (std::vector<std::tuple<NodeIndex, NodeIndex, int64_t>>{
+                {0, 1, 7}, {1, 0, 7}, {1, 2, 6}, {2, 1, 6}, {2, 2, 8},
+                {2, 2, 8}}));
+
+  // a self loop has both of its entries in one list
+  ASSERT_TRUE(graph.remove_edge(2, 2));
+  ASSERT_FALSE(graph.remove_edge(2, 2));
+  ASSERT_EQ(graph.degree(2), 1U);
+
+  ASSERT_TRUE(graph.remove_edge(0, 1));
+  ASSERT_EQ(reached_nodes(graph, 0), (std::vector<NodeIndex>{0}));
+  ASSERT_EQ(reached_nodes(graph, 1), (std::vector<NodeIndex>{1, 2}));
+  std::vector<NodeIndex> reached;
+  graph.breadth_first_search(2, [&reached](Node const& node) {
+    reached.push_back(node.id);
+    return false;
+  });
+  ASSERT_EQ(reached, (std::vector<NodeIndex>{2, 1}));
+
+  auto const frozen = freeze(graph);
+  ASSERT_EQ(frozen.number_of_nodes(), 3U);
+  ASSERT_EQ(frozen.number_of_edges(), 2U);
+
+  graph.compact();
+  ASSERT_EQ(graph.number_of_removed_edges(), 0U);
+  ASSERT_TRUE(graph.get_edges(0).empty());
+  ASSERT_EQ(graph.get_edges(1).size(), 1U);
+  graph.enable_connectivity_index();
+  ASSERT_TRUE(graph.is_connected(1, 2));
+  ASSERT_FALSE(graph.is_connected(0, 1));
+}
+
+// clang-format off
+TEST(GraphRemovalTest, RemoveNode) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  graph.add_edge(1, "b", 2, "c");
+  graph.add_edge(1, "b", 3, "d");
+  graph.add_edge(1, "b", 1, "b");
+  graph.add_edge(2, "c", 3, "d");
+
+  ASSERT_TRUE(graph.remove_node(1));
+  ASSERT_FALSE(graph.remove_node(1));
+  ASSERT_EQ(graph.number_of_nodes(), 4U);
+  ASSERT_EQ(graph.number_of_removed_nodes(), 1U);
+  ASSERT_TRUE(graph.get_edges(1).empty());
+  ASSERT_EQ(graph.degree(0), 0U);
+  ASSERT_EQ(graph.degree(2), 1U);
+  ASSERT_EQ(graph.degree(3), 1U);
+  ASSERT_EQ(reached_nodes(graph, 1), (std::vector<NodeIndex>{}));
+  ASSERT_EQ(reached_nodes(graph, 2), (std::vector<NodeIndex>{2, 3}));
+
+  auto const statistics = degree_statistics(graph);
+  ASSERT_EQ(statistics.number_of_nodes, 3U);
+  ASSERT_EQ(statistics.isolated_nodes, 1U);
+  auto const frozen = freeze(graph);
+  ASSERT_EQ(frozen.number_of_nodes(), 3U);
+  ASSERT_EQ(frozen.find_local(1), decltype(frozen)::kInvalidLocalIndex);
+
+  // adding an edge brings the node back with its new value and no old edges
+  graph.add_edge(1, "e", 0, "ignored");
+  ASSERT_EQ(graph.number_of_removed_nodes(), 0U);
+  ASSERT_EQ(graph.get_node(1).value, "e");
+  ASSERT_EQ(graph.get_node(0).value, "a");
+  ASSERT_EQ(graph.degree(1), 1U);
+  ASSERT_EQ(reached_nodes(graph, 0), (std::vector<NodeIndex>{0, 1}));
+
+  graph.remove_node(3);
+  graph.add_edge(Node{false, 3, "f"}, Node{false, 2, "c"});
+  ASSERT_EQ(graph.number_of_removed_nodes(), 0U);
+  ASSERT_EQ(graph.get_node(3).value, "f");
+}
+
+// clang-format off
+TEST(GraphRemovalTest, RemoveMissingNode) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // ids 0 and 1 exist, 2 and 5 were never added
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  ASSERT_FALSE(graph.remove_node(2));
+  ASSERT_FALSE(graph.remove_node(5));
+  ASSERT_EQ(graph.number_of_removed_nodes(), 0U);
+  ASSERT_EQ(graph.number_of_nodes(), 2U);
+  ASSERT_EQ(reached_nodes(graph, 0), (std::vector<NodeIndex>{0, 1}));
+
+  FlatGraph flat_graph;
+  flat_graph.add_edge(0, "a", 1, "b");
+  ASSERT_FALSE(flat_graph.remove_node(2));
+  ASSERT_EQ(flat_graph.number_of_removed_nodes(), 0U);
+}
+
+template <typename GraphType>
+void check_churn() {
+  // random insertions and removals against the undirected edges in insertion
+  // order; remove_edge() takes the oldest parallel edge
+  constexpr NodeIndex kNodes{40};
+  constexpr double kCompactionThreshold{0.25};
+  std::mt19937_64 generator{22};
+  std::uniform_int_distribution<NodeIndex> node_distribution{0, kNodes - 1};
+  std::uniform_int_distribution<int> action_distribution{0, 9};
+  GraphType graph;
+  graph.set_compaction_threshold(kCompactionThreshold);
+  std::vector<std::tuple<NodeIndex, NodeIndex, int64_t>> expected;
+  std::set<NodeIndex> removed_nodes;
+  for (NodeIndex node = 0; node < kNodes; ++node) {
+    graph.add_edge(node, "", (node + 1) % kNodes, "", node);
+    expected.emplace_back(node, (node + 1) % kNodes, node);
+  }
+  for (int64_t step = 0; step < 4000; ++step) {
+    auto const head = node_distribution(generator);
+    auto const tail = node_distribution(generator);
+    auto const action = action_distribution(generator);
+    if (action < 4) {
+      graph.add_edge(head, "", tail, "", step);
+      expected.emplace_back(head, tail, step);
+      removed_nodes.erase(head);
+      removed_nodes.erase(tail);
+    } else if (action < 9) {
+      auto const oldest =
+          std::find_if(expected.begin(), expected.end(), [&](auto const& edge) {
+            auto const [first, second, cost] = edge;
+            return (first == head && second == tail) ||
+                   (first == tail && second == head);
+          });
+      ASSERT_EQ(graph.remove_edge(head, tail), oldest != expected.end());
+      if (oldest != expected.end()) {
+        expected.erase(oldest);
+      }
+    } else {
+      ASSERT_EQ(graph.remove_node(head), !removed_nodes.contains(head));
+      removed_nodes.insert(head);
+      std::erase_if(expected, [head](auto const& edge) {
+        return std::get<0>(edge) == head || std::get<1>(edge) == head;
+      });
+    }
+    ASSERT_EQ(graph.number_of_removed_nodes(), removed_nodes.size());
+  }
+
+  std::vector<std::tuple<NodeIndex, NodeIndex, int64_t>> expected_entries;
+  for (auto const& [head, tail, cost] : expected) {
+    expected_entries.emplace_back(head, tail, cost);
+    expected_entries.emplace_back(tail, head, cost);
+  }
+  std::sort(expected_entries.begin(), expected_entries.end());
+  auto const edges = live_edges(graph);
+  ASSERT_EQ(edges, expected_entries);
+  std::size_t stored{0};
+  for (NodeIndex node = 0; node < kNodes; ++node) {
+    auto const& node_edges = graph.get_edges(node);
+    stored += node_edges.size();
+    ASSERT_LE(static_cast<double>(graph.number_of_removed_edges(node)),
+              kCompactionThreshold * static_cast<double>(node_edges.size()));
+  }
+  ASSERT_EQ(stored, edges.size() + graph.number_of_removed_edges());
+  graph.compact();
+  ASSERT_EQ(live_edges(graph), edges);
+  ASSERT_EQ(graph.number_of_removed_edges(), 0U);
+}
+
+// clang-format off
+TEST(GraphRemovalTest, ChurnMatchesReference) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  check_churn<Graph>();
+  check_churn<FlatGraph>();
+}
+
+}  // namespace
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/graph_reordering.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using LocalIndex = CsrGraph::LocalIndex;
+using modern_cpp_template::algorithms::undirected_graph::bandwidth;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::relabel;
+using modern_cpp_template::algorithms::undirected_graph::reorder;
+using modern_cpp_template::algorithms::undirected_graph::ReorderingStrategy;
+using modern_cpp_template::algorithms::undirected_graph::
+    reverse_cuthill_mckee_order;
+
+///\brief a side x side grid whose node ids are a random permutation
+Graph make_scrambled_grid(int64_t side) {
+  std::vector<int64_t> ids(static_cast<std::size_t>(side * side));
+  for (std::size_t node = 0; node < ids.size(); ++node) {
+    ids[node] = static_cast<int64_t>(node);
+  }
+  std::shuffle(ids.begin(), ids.end(), std::mt19937_64{31});
+  Graph graph;
+  auto add_edge = [&graph, &ids](int64_t head, int64_t tail) {
+    auto head_id = ids[static_cast<std::size_t>(head)];
+    auto tail_id = ids[static_cast<std::size_t>(tail)];
+    graph.add_edge(head_id, std::to_string(head_id), tail_id,
+                   std::to_string(tail_id), head + tail);
+  };
+  for (int64_t row = 0; row < side; ++row) {
+    for (int64_t column = 0; column < side; ++column) {
+      if (column + 1 < side) {
+        add_edge(row * side + column, row * side + column + 1);
+      }
+      if (row + 1 < side) {
+        add_edge(row * side + column, (row + 1) * side + column);
+      }
+    }
+  }
+  return graph;
+}
+
+// clang-format off
+TEST(GraphReorderingTest, PreservesGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const source = freeze(make_scrambled_grid(20));
+  auto const expected_tree = dijkstra_shortest_paths(source, 0);
+  for (auto strategy : {ReorderingStrategy::kDegreeDescending,
+                        ReorderingStrategy::kBreadthFirst,
+                        ReorderingStrategy::kReverseCuthillMcKee}) {
+    auto const reordered = reorder(source, strategy);
+    auto const& graph = reordered.graph;
+    ASSERT_EQ(graph.number_of_nodes(), source.number_of_nodes());
+    ASSERT_EQ(graph.number_of_edges(), source.number_of_edges());
+    for (LocalIndex local = 0; local < source.number_of_nodes(); ++local) {
+      auto const new_id = reordered.old_to_new[local];
+      ASSERT_EQ(graph.node(new_id).id, new_id);
+      ASSERT_EQ(graph.node(new_id).value, source.node(local).value);
+      ASSERT_EQ(reordered.new_to_old[new_id], source.original_id(local));
+
+      // same edges, sorted by their new id
+      std::vector<std::pair<LocalIndex, int64_t>> expected;
+      auto const neighbors = source.neighbors(local);
+      auto const costs = source.neighbor_costs(local);
+      for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+        expected.emplace_back(reordered.old_to_new[neighbors[edge]],
+                              costs[edge]);
+      }
+      std::sort(expected.begin(), expected.end());
+      std::vector<std::pair<LocalIndex, int64_t>> actual;
+      for (std::size_t edge = 0; edge < graph.degree(new_id); ++edge) {
+        actual.emplace_back(graph.neighbors(new_id)[edge],
+                            graph.neighbor_costs(new_id)[edge]);
+      }
+      ASSERT_EQ(actual, expected);
+    }
+
+    auto const tree = dijkstra_shortest_paths(graph, reordered.old_to_new[0]);
+    for (LocalIndex local = 0; local < source.number_of_nodes(); ++local) {
+      ASSERT_EQ(tree.distances[reordered.old_to_new[local]],
+                expected_tree.distances[local]);
+    }
+  }
+}
+
+// clang-format off
+TEST(GraphReorderingTest, ReverseCuthillMcKeeBandwidth) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  constexpr int64_t kSide{30};
+  auto const graph = make_scrambled_grid(kSide);
+  auto const source = freeze(graph);
+  ASSERT_GT(bandwidth(source), static_cast<std::size_t>(10 * kSide));
+  // a grid numbered by anti-diagonals has a bandwidth of about side
+  auto const reordered = reorder(graph);
+  ASSERT_LE(bandwidth(reordered.graph), static_cast<std::size_t>(kSide + 1));
+
+  // two components and an isolated node are all numbered
+  Graph forest;
+  forest.add_edge(10, "a", 11, "b", 1);
+  forest.add_edge(11, "b", 12, "c", 1);
+  forest.add_edge(20, "d", 21, "e", 1);
+  forest.add_edge(30, "f", 30, "f", 1);
+  auto const forest_csr = freeze(forest);
+  auto order = reverse_cuthill_mckee_order(forest_csr);
+  std::sort(order.begin(), order.end());
+  ASSERT_EQ(order, (std::vector<LocalIndex>{0, 1, 2, 3, 4, 5}));
+
+  ASSERT_EXIT(static_cast<void>(relabel(
+                  forest_csr, std::vector<LocalIndex>{0, 0, 1, 2, 3, 4})),
+              testing::KilledBySignal(SIGABRT), "");
+}
+
+}  // namespace
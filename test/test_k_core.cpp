@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/k_core.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using LocalIndex = CsrGraph::LocalIndex;
+using CoreNumber = modern_cpp_template::algorithms::undirected_graph::
+    CoreDecomposition::CoreNumber;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::core_decomposition;
+using modern_cpp_template::algorithms::undirected_graph::degree_statistics;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+
+///\brief the definition: repeatedly delete every node with fewer than k
+/// remaining neighbors, for k = 1, 2, ...
+std::vector<CoreNumber> reference_core_numbers(CsrGraph const& graph) {
+  auto const number_of_nodes = graph.number_of_nodes();
+  std::vector<CoreNumber> cores(number_of_nodes, 0);
+  std::vector<bool> is_removed(number_of_nodes, false);
+  std::size_t removed{0};
+  for (CoreNumber k = 1; removed < number_of_nodes; ++k) {
+    bool has_removed{true};
+    while (has_removed) {
+      has_removed = false;
+      for (LocalIndex node = 0; node < number_of_nodes; ++node) {
+        if (is_removed[node]) {
+          continue;
+        }
+        std::size_t degree{0};
+        for (auto neighbor : graph.neighbors(node)) {
+          if (neighbor != node && !is_removed[neighbor]) {
+            ++degree;
+          }
+        }
+        if (degree < k) {
+          is_removed[node] = true;
+          cores[node] = k - 1;
+          has_removed = true;
+          ++removed;
+        }
+      }
+    }
+  }
+  return cores;
+}
+
+// clang-format off
+TEST(KCoreTest, MatchesPeelingDefinition) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a skewed random multigraph with self loops, so cores span many levels
+  constexpr int64_t kNodes{2000};
+  std::mt19937_64 generator{20};
+  std::geometric_distribution<int64_t> distribution{0.004};
+  Graph graph;
+  for (int64_t edge = 0; edge < kNodes * 6; ++edge) {
+    graph.add_edge(distribution(generator) % kNodes, "",
+                   distribution(generator) % kNodes, "");
+  }
+  auto const csr_graph = freeze(graph);
+  auto const expected = reference_core_numbers(csr_graph);
+
+  auto const sequential = core_decomposition(csr_graph);
+  ASSERT_EQ(sequential.core_numbers, expected);
+  ASSERT_GT(sequential.degeneracy, 5U);
+  ASSERT_EQ(sequential.degeneracy,
+            *std::max_element(expected.begin(), expected.end()));
+  for (std::size_t num_threads : {1U, 2U, 4U}) {
+    WorkerPool pool(num_threads);
+    auto const parallel = core_decomposition(csr_graph, pool);
+    ASSERT_EQ(parallel.core_numbers, expected);
+    ASSERT_EQ(parallel.degeneracy, sequential.degeneracy);
+  }
+}
+
+// clang-format off
+TEST(KCoreTest, SmallGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ASSERT_TRUE(core_decomposition(CsrGraph{}).core_numbers.empty());
+
+  // a 4-clique {0..3}, a triangle {4, 5, 6} hanging off node 3, a tail node
+  // 7 with a self loop and an isolated node 8
+  Graph graph;
+  for (int64_t head = 0; head < 4; ++head) {
+    for (int64_t tail = head + 1; tail < 4; ++tail) {
+      graph.add_edge(head, "", tail, "");
+    }
+  }
+  graph.add_edge(3, "", 4, "");
+  graph.add_edge(4, "", 5, "");
+  graph.add_edge(5, "", 6, "");
+  graph.add_edge(6, "", 4, "");
+  graph.add_edge(6, "", 7, "");
+  graph.add_edge(7, "", 7, "");
+  graph.add_edge(8, "", 8, "");
+  auto const csr_graph = freeze(graph);
+
+  std::vector<CoreNumber> const expected{3, 3, 3, 3, 2, 2, 2, 1, 0};
+  auto const decomposition = core_decomposition(csr_graph);
+  ASSERT_EQ(decomposition.core_numbers, expected);
+  ASSERT_EQ(decomposition.degeneracy, 3U);
+  ASSERT_EQ(decomposition.core_size(2), 7U);
+  ASSERT_EQ(decomposition.core_nodes(3), (std::vector<uint32_t>{0, 1, 2, 3}));
+  ASSERT_TRUE(decomposition.core_nodes(4).empty());
+  WorkerPool pool(3);
+  ASSERT_EQ(core_decomposition(csr_graph, pool).core_numbers, expected);
+}
+
+// clang-format off
+TEST(KCoreTest, DegreeStatistics) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ASSERT_EQ(degree_statistics(CsrGraph{}).number_of_nodes, 0U);
+  ASSERT_TRUE(degree_statistics(Graph{}).histogram.empty());
+
+  // a star with center 0 and four leaves, a self loop on 5 and a node 6
+  // whose edges are removed through the adjacency map
+  Graph graph;
+  for (int64_t leaf = 1; leaf <= 4; ++leaf) {
+    graph.add_edge(0, "", leaf, "");
+  }
+  graph.add_edge(5, "", 5, "");
+  graph.add_edge(6, "", 6, "");
+  graph.adjacency_map()[6].clear();
+  ASSERT_EQ(graph.degree(0), 4U);
+  ASSERT_EQ(graph.degree(5), 2U);
+  ASSERT_EQ(graph.degree(6), 0U);
+
+  auto const statistics = degree_statistics(graph);
+  ASSERT_EQ(statistics.number_of_nodes, 7U);
+  ASSERT_EQ(statistics.number_of_edges, 10U);
+  ASSERT_EQ(statistics.min_degree, 0U);
+  ASSERT_EQ(statistics.max_degree, 4U);
+  ASSERT_DOUBLE_EQ(statistics.mean_degree, 10.0 / 7.0);
+  ASSERT_EQ(statistics.median_degree, 1U);
+  ASSERT_EQ(statistics.isolated_nodes, 1U);
+  ASSERT_EQ(statistics.histogram, (std::vector<std::size_t>{1, 4, 1, 0, 1}));
+
+  auto const csr_statistics = degree_statistics(freeze(graph));
+  ASSERT_EQ(csr_statistics.histogram, statistics.histogram);
+  ASSERT_EQ(csr_statistics.median_degree, statistics.median_degree);
+  ASSERT_EQ(csr_statistics.number_of_edges, statistics.number_of_edges);
+}
+
+}  // namespace
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/mapped_graph.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using MappedGraph =
+    modern_cpp_template::algorithms::undirected_graph::MappedGraph<
+        std::string, int64_t>;
+using GraphFileHeader =
+    modern_cpp_template::algorithms::undirected_graph::GraphFileHeader;
+using NodeIndex = Graph::NodeIndex;
+using Node = Graph::Node;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::write_graph_file;
+using modern_cpp_template::tests::make_city_graph;
+
+/// A file in the temporary directory that is removed again on destruction
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(std::string const& name)
+      : path_(std::filesystem::temp_directory_path() /
+              (name + "_" + std::to_string(::getpid()) + ".graph")) {}
+  TemporaryFile(TemporaryFile const&) = delete;
+  TemporaryFile& operator=(TemporaryFile const&) = delete;
+  TemporaryFile(TemporaryFile&&) = delete;
+  TemporaryFile& operator=(TemporaryFile&&) = delete;
+  ~TemporaryFile() {
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+  }
+
+  [[nodiscard]] std::filesystem::path const& path() const { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+// clang-format off
+TEST(MappedGraphTest, RoundTrip) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  TemporaryFile file("round_trip");
+  auto graph = make_city_graph();
+  graph.add_edge(1000000, "far away", 9, "Stuttgart", 7);
+  auto csr_graph = freeze(graph);
+  write_graph_file(graph, file.path());
+
+  MappedGraph mapped_graph(file.path());
+  ASSERT_EQ(mapped_graph.number_of_nodes(), csr_graph.number_of_nodes());
+  ASSERT_EQ(mapped_graph.number_of_edges(), csr_graph.number_of_edges());
+  ASSERT_TRUE(std::equal(mapped_graph.offsets().begin(),
+                         mapped_graph.offsets().end(),
+                         csr_graph.offsets().begin()));
+  ASSERT_TRUE(std::equal(mapped_graph.targets().begin(),
+                         mapped_graph.targets().end(),
+                         csr_graph.targets().begin()));
+  ASSERT_TRUE(std::equal(mapped_graph.costs().begin(),
+                         mapped_graph.costs().end(),
+                         csr_graph.costs().begin()));
+  for (std::size_t local = 0; local < csr_graph.number_of_nodes(); ++local) {
+    auto node = mapped_graph.node(static_cast<MappedGraph::LocalIndex>(local));
+    ASSERT_EQ(node.id, csr_graph.nodes()[local].id);
+    ASSERT_EQ(node.value, csr_graph.nodes()[local].value);
+  }
+  ASSERT_EQ(mapped_graph.find_local(1000000), 10U);
+  ASSERT_EQ(mapped_graph.find_local(42), MappedGraph::kInvalidLocalIndex);
+  ASSERT_EQ(mapped_graph.degree(mapped_graph.find_local(2)), 3U);
+
+  // the mapping stays valid when the view is moved
+  MappedGraph moved_graph(std::move(mapped_graph));
+  ASSERT_EQ(moved_graph.node(moved_graph.find_local(7)).value, "München");
+  ASSERT_EQ(mapped_graph.number_of_nodes(), 0U);  // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+}
+
+// clang-format off
+TEST(MappedGraphTest, BreadthFirstSearchMatchesCsrGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  TemporaryFile file("breadth_first_search");
+  auto csr_graph = freeze(make_city_graph());
+  write_graph_file(csr_graph, file.path());
+  MappedGraph mapped_graph(file.path());
+
+  std::vector<NodeIndex> expected_order;
+  csr_graph.breadth_first_search(0, [&expected_order](Node const& node) {
+    expected_order.push_back(node.id);
+    return false;
+  });
+  std::vector<NodeIndex> order;
+  std::vector<std::string> values;
+  mapped_graph.breadth_first_search(
+      0, [&order, &values](MappedGraph::Node const& node) {
+        order.push_back(node.id);
+        values.emplace_back(node.value);
+        return node.value == "Erfurt";
+      });
+  expected_order.resize(order.size());
+  ASSERT_EQ(order, expected_order);
+  ASSERT_EQ(values.back(), "Erfurt");
+
+  ASSERT_EQ(dijkstra_shortest_paths(mapped_graph, 0).distances,
+            dijkstra_shortest_paths(csr_graph, 0).distances);
+}
+
+// clang-format off
+TEST(MappedGraphTest, TriviallyCopyableValues) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  using IntGraph =
+      modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+          int32_t, double>;
+  TemporaryFile file("trivially_copyable");
+  IntGraph graph;
+  graph.add_edge(0, 100, 1, 101, 0.5);
+  graph.add_edge(1, 101, 2, 102, 1.5);
+  write_graph_file(graph, file.path());
+
+  modern_cpp_template::algorithms::undirected_graph::MappedGraph<int32_t,
+                                                                 double>
+      mapped_graph(file.path());
+  ASSERT_EQ(mapped_graph.node(2).value, 102);
+  ASSERT_EQ(mapped_graph.neighbor_costs(1)[1], 1.5);
+}
+
+// clang-format off
+TEST(MappedGraphTest, RejectsIncompatibleFiles) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  TemporaryFile file("incompatible");
+  ASSERT_THROW(MappedGraph{file.path()}, std::system_error);
+
+  {
+    std::ofstream stream(file.path(), std::ios::binary);
+    stream << std::string(1024, 'x');
+  }
+  ASSERT_THROW(MappedGraph{file.path()}, std::runtime_error);
+
+  write_graph_file(make_city_graph(), file.path());
+  using DoubleCostGraph =
+      modern_cpp_template::algorithms::undirected_graph::MappedGraph<
+          std::string, double>;
+  ASSERT_THROW(DoubleCostGraph{file.path()}, std::runtime_error);
+
+  std::filesystem::resize_file(file.path(),
+                               std::filesystem::file_size(file.path()) - 1);
+  ASSERT_THROW(MappedGraph{file.path()}, std::runtime_error);
+}
+
+// clang-format off
+TEST(MappedGraphTest, RejectsOverflowingSectionCounts) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // 2^62 edges of 4-byte targets and 8-byte costs wrap to 0 bytes
+  TemporaryFile file("overflow");
+  write_graph_file(make_city_graph(), file.path());
+  {
+    std::fstream stream(file.path(),
+                        std::ios::binary | std::ios::in | std::ios::out);
+    GraphFileHeader header;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    header.number_of_edges = std::uint64_t{1} << 62U;
+    header.sections[GraphFileHeader::kTargets].size = 0;
+    header.sections[GraphFileHeader::kCosts].size = 0;
+    stream.seekp(0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  }
+  try {
+    MappedGraph graph(file.path());
+    FAIL() << "expected a corrupt section table";
+  } catch (std::runtime_error const& error) {
+    ASSERT_EQ(std::string(error.what()),
+              "graph file " + file.path().string() + ": corrupt section table");
+  }
+}
+
+}  // namespace
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/memory_resources.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using modern_cpp_template::algorithms::ArenaResource;
+using modern_cpp_template::algorithms::SizeClassPoolResource;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using PmrGraph =
+    modern_cpp_template::algorithms::undirected_graph::pmr::UndirectedGraph<
+        std::string, int64_t>;
+
+template <typename GraphType>
+void add_random_edges(GraphType& graph) {
+  for (int64_t edge = 0; edge < 2000; ++edge) {
+    auto head = edge % 500;
+    auto tail = (edge * 7919) % 500;
+    graph.add_edge(head, std::to_string(head), tail, std::to_string(tail),
+                   edge);
+  }
+}
+
+/// Fails the test if anything allocates from the default resource while it
+/// is installed
+class DefaultResourceGuard {
+ public:
+  DefaultResourceGuard()
+      : previous_(std::pmr::set_default_resource(
+            std::pmr::null_memory_resource())) {}
+  DefaultResourceGuard(DefaultResourceGuard const&) = delete;
+  DefaultResourceGuard& operator=(DefaultResourceGuard const&) = delete;
+  DefaultResourceGuard(DefaultResourceGuard&&) = delete;
+  DefaultResourceGuard& operator=(DefaultResourceGuard&&) = delete;
+  ~DefaultResourceGuard() { std::pmr::set_default_resource(previous_); }
+
+ private:
+  std::pmr::memory_resource* previous_;
+};
+
+// clang-format off
+TEST(MemoryResourcesTest, Arena) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ArenaResource arena(128);
+  auto* first = arena.allocate(3, 1);
+  auto* second = arena.allocate(8, 8);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8, 0U);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  ASSERT_NE(first, second);
+  // larger than a block
+  auto* large = arena.allocate(1000, 64);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % 64, 0U);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  arena.deallocate(large, 1000, 64);
+  ASSERT_EQ(arena.bytes_allocated(), 1011U);
+  ASSERT_GE(arena.bytes_reserved(), arena.bytes_allocated());
+
+  arena.release();
+  ASSERT_EQ(arena.bytes_reserved(), 0U);
+  ASSERT_NE(arena.allocate(16, 16), nullptr);
+}
+
+// clang-format off
+TEST(MemoryResourcesTest, SizeClasses) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::size_t previous_size{0};
+  for (std::size_t index = 0; index < SizeClassPoolResource::kNumberOfClasses;
+       ++index) {
+    auto size = SizeClassPoolResource::class_size(index);
+    ASSERT_GT(size, previous_size);
+    ASSERT_EQ(size % SizeClassPoolResource::kPoolAlignment, 0U);
+    ASSERT_EQ(SizeClassPoolResource::size_class(size), index);
+    ASSERT_EQ(SizeClassPoolResource::size_class(previous_size + 1), index);
+    previous_size = size;
+  }
+  ASSERT_EQ(previous_size, SizeClassPoolResource::kMaxPooledSize);
+  // doubling lists of 24 byte edges fit exactly
+  for (std::size_t bytes = 48; bytes <= SizeClassPoolResource::kMaxPooledSize;
+       bytes *= 2) {
+    ASSERT_EQ(SizeClassPoolResource::class_size(
+                  SizeClassPoolResource::size_class(bytes)),
+              bytes);
+  }
+}
+
+// clang-format off
+TEST(MemoryResourcesTest, PoolRecyclesBlocks) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  SizeClassPoolResource pool;
+  auto* block = pool.allocate(90, 8);
+  pool.deallocate(block, 90, 8);
+  // same size class
+  ASSERT_EQ(pool.allocate(96, 16), block);
+  ASSERT_NE(pool.allocate(96, 16), block);
+
+  auto reserved = pool.bytes_reserved();
+  auto* oversized = pool.allocate(SizeClassPoolResource::kMaxPooledSize + 1);
+  ASSERT_EQ(pool.bytes_reserved(), reserved);
+  pool.deallocate(oversized, SizeClassPoolResource::kMaxPooledSize + 1);
+}
+
+// clang-format off
+TEST(MemoryResourcesTest, GraphAllocatesFromItsResource) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph expected;
+  add_random_edges(expected);
+  auto expected_csr = freeze(expected);
+
+  ArenaResource arena;
+  SizeClassPoolResource pool;
+  std::pmr::unsynchronized_pool_resource standard_pool;
+  for (std::pmr::memory_resource* resource :
+       std::vector<std::pmr::memory_resource*>{&arena, &pool,
+                                               &standard_pool}) {
+    auto reserved = arena.bytes_reserved();
+    std::optional<PmrGraph> graph;
+    {
+      // the maps and every adjacency list must use the graph's resource
+      DefaultResourceGuard guard;
+      graph.emplace(resource);
+      add_random_edges(*graph);
+    }
+    ASSERT_EQ(graph->get_allocator().resource(), resource);
+    auto csr_graph = freeze(*graph);
+    ASSERT_TRUE(std::equal(csr_graph.targets().begin(),
+                           csr_graph.targets().end(),
+                           expected_csr.targets().begin(),
+                           expected_csr.targets().end()));
+    if (resource == &arena) {
+      ASSERT_GT(arena.bytes_reserved(), reserved);
+    }
+  }
+  ASSERT_GT(pool.bytes_reserved(), 0U);
+}
+
+}  // namespace
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/direction_optimizing_bfs.h"
+#include "modern_cpp_template/multi_source_bfs.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::undirected_graph::
+    direction_optimizing_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::
+    multi_source_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::MultiSourceDistances;
+using modern_cpp_template::tests::make_random_graph;
+
+template <std::size_t kBatchWidth>
+void expect_matches_single_source(CsrGraph const& graph,
+                                  std::vector<NodeIndex> const& sources) {
+  auto result = multi_source_breadth_first_search<kBatchWidth>(
+      graph, std::span<NodeIndex const>(sources));
+  ASSERT_EQ(result.number_of_sources(), sources.size());
+  for (std::size_t source = 0; source < sources.size(); ++source) {
+    auto levels =
+        direction_optimizing_breadth_first_search(graph, sources[source])
+            .levels;
+    auto distances = result.from(source);
+    for (std::size_t node = 0; node < levels.size(); ++node) {
+      ASSERT_EQ(static_cast<int64_t>(distances[node]), levels[node]);
+    }
+  }
+}
+
+// clang-format off
+TEST(MultiSourceBfsTest, MatchesSingleSourceSearches) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(11, 800, 1200));
+  std::vector<NodeIndex> sources;
+  for (NodeIndex source = 0; source < 300; source += 2) {
+    sources.push_back(graph.original_id(static_cast<CsrGraph::LocalIndex>(source)));
+  }
+  // duplicate sources are allowed
+  sources.push_back(sources.front());
+
+  expect_matches_single_source<64>(graph, sources);
+  expect_matches_single_source<128>(graph, sources);
+  expect_matches_single_source<256>(graph, sources);
+}
+
+// clang-format off
+TEST(MultiSourceBfsTest, DisconnectedGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  graph.add_edge(1, "b", 2, "c");
+  graph.add_edge(3, "d", 4, "e");
+  auto csr_graph = freeze(graph);
+  std::vector<NodeIndex> sources{0, 4};
+  auto result = multi_source_breadth_first_search(
+      csr_graph, std::span<NodeIndex const>(sources));
+  auto from0 = result.from(0);
+  auto from4 = result.from(1);
+  ASSERT_EQ(std::vector<int32_t>(from0.begin(), from0.end()),
+            (std::vector<int32_t>{0, 1, 2, -1, -1}));
+  ASSERT_EQ(std::vector<int32_t>(from4.begin(), from4.end()),
+            (std::vector<int32_t>{-1, -1, -1, 1, 0}));
+  ASSERT_EQ(MultiSourceDistances::kUnreachable, -1);
+}
+
+}  // namespace
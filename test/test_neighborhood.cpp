@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/graph_traits.h"
+#include "modern_cpp_template/neighborhood.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::GraphTraits;
+using modern_cpp_template::algorithms::undirected_graph::k_hop_neighborhood;
+using modern_cpp_template::algorithms::undirected_graph::k_hop_neighborhoods;
+using modern_cpp_template::algorithms::undirected_graph::Neighborhood;
+using modern_cpp_template::tests::make_looped_random_graph;
+
+static constexpr NodeIndex kNumNodes{250};
+
+///\brief the node ids of each level up to a radius, sorted, by a reference
+/// search computing the distance of every node
+template <typename GraphType>
+std::vector<std::vector<NodeIndex>> reference_levels(GraphType const& graph,
+                                                     NodeIndex source,
+                                                     std::size_t radius) {
+  using Traits = GraphTraits<GraphType>;
+  using Vertex = typename Traits::Vertex;
+  std::vector<std::size_t> distances(Traits::number_of_nodes(graph),
+                                     radius + 1);
+  std::vector<Vertex> queue{Traits::vertex(graph, source)};
+  distances[static_cast<std::size_t>(queue.front())] = 0;
+  for (std::size_t position = 0; position < queue.size(); ++position) {
+    auto const vertex = queue[position];
+    auto const distance = distances[static_cast<std::size_t>(vertex)];
+    if (distance == radius) {
+      continue;
+    }
+    Traits::for_each_neighbor(graph, vertex, [&](Vertex target, int64_t) {
+      auto& target_distance = distances[static_cast<std::size_t>(target)];
+      if (target_distance > distance + 1) {
+        target_distance = distance + 1;
+        queue.push_back(target);
+      }
+    });
+  }
+  std::vector<std::vector<NodeIndex>> levels;
+  for (auto vertex : queue) {
+    auto const distance = distances[static_cast<std::size_t>(vertex)];
+    levels.resize(std::max(levels.size(), distance + 1));
+    levels[distance].push_back(Traits::node_index(graph, vertex));
+  }
+  for (auto& level : levels) {
+    std::ranges::sort(level);
+  }
+  return levels;
+}
+
+///\brief the node ids of each level of a Neighborhood, sorted
+template <typename GraphType>
+std::vector<std::vector<NodeIndex>> levels_of(
+    GraphType const& graph, Neighborhood<GraphType> const& neighborhood) {
+  std::vector<std::vector<NodeIndex>> levels;
+  for (std::size_t distance = 0; distance < neighborhood.number_of_levels();
+       ++distance) {
+    auto& level = levels.emplace_back();
+    for (auto vertex : neighborhood.level(distance)) {
+      level.push_back(GraphTraits<GraphType>::node_index(graph, vertex));
+    }
+    std::ranges::sort(level);
+  }
+  return levels;
+}
+
+// clang-format off
+TEST(NeighborhoodTest, MatchesReferenceLevels) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_looped_random_graph(25, kNumNodes, 280);
+  auto const csr_graph = freeze(graph);
+  Graph::VisitationContext context;
+  CsrGraph::VisitationContext csr_context;
+  Neighborhood<Graph> neighborhood;
+  Neighborhood<CsrGraph> csr_neighborhood;
+  for (NodeIndex source = 0; source < kNumNodes; source += 13) {
+    for (std::size_t radius = 0; radius <= 4; ++radius) {
+      auto const expected = reference_levels(graph, source, radius);
+      k_hop_neighborhood(graph, source, radius, context, neighborhood);
+      ASSERT_EQ(levels_of(graph, neighborhood), expected);
+      ASSERT_EQ(neighborhood.vertices.front(), source);
+      ASSERT_LE(neighborhood.number_of_levels(), radius + 1);
+
+      k_hop_neighborhood(csr_graph, source, radius, csr_context,
+                         csr_neighborhood);
+      ASSERT_EQ(levels_of(csr_graph, csr_neighborhood), expected);
+      ASSERT_EQ(csr_neighborhood.size(), neighborhood.size());
+    }
+  }
+}
+
+// clang-format off
+TEST(NeighborhoodTest, PathLevels) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // a path 0 - 1 - 2 - 3 with a leaf 1 - 4; edge 2 - 3 removed later
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b");
+  graph.add_edge(1, "b", 2, "c");
+  graph.add_edge(2, "c", 3, "d");
+  graph.add_edge(1, "b", 4, "e");
+  Graph::VisitationContext context;
+  Neighborhood<Graph> neighborhood;
+
+  k_hop_neighborhood(graph, 0, 0, context, neighborhood);
+  ASSERT_EQ(neighborhood.vertices, (std::vector<NodeIndex>{0}));
+  ASSERT_EQ(neighborhood.number_of_levels(), 1U);
+
+  k_hop_neighborhood(graph, 0, 2, context, neighborhood);
+  ASSERT_EQ(neighborhood.vertices, (std::vector<NodeIndex>{0, 1, 2, 4}));
+  ASSERT_EQ(neighborhood.level_offsets, (std::vector<std::size_t>{0, 1, 2, 4}));
+  ASSERT_FALSE(context.is_visited(3));
+
+  // a radius beyond the eccentricity ends at the last non-empty level
+  k_hop_neighborhood(graph, 0, 10, context, neighborhood);
+  ASSERT_EQ(neighborhood.number_of_levels(), 4U);
+  ASSERT_EQ(neighborhood.level(3).size(), 1U);
+  ASSERT_EQ(neighborhood.level(3).front(), 3);
+
+  graph.remove_edge(2, 3);
+  k_hop_neighborhood(graph, 0, 10, context, neighborhood);
+  ASSERT_EQ(neighborhood.vertices, (std::vector<NodeIndex>{0, 1, 2, 4}));
+  ASSERT_EQ(neighborhood.number_of_levels(), 3U);
+
+  // a removed source reaches nothing, and is reached by no one
+  graph.remove_node(1);
+  k_hop_neighborhood(graph, 1, 2, context, neighborhood);
+  ASSERT_EQ(neighborhood.size(), 0U);
+  ASSERT_EQ(neighborhood.number_of_levels(), 0U);
+  ASSERT_FALSE(context.is_visited(1));
+  k_hop_neighborhood(graph, 0, 2, context, neighborhood);
+  ASSERT_EQ(neighborhood.vertices, (std::vector<NodeIndex>{0}));
+}
+
+// clang-format off
+TEST(NeighborhoodTest, Batches) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_looped_random_graph(25, kNumNodes, 280);
+  auto const csr_graph = freeze(graph);
+  std::vector<NodeIndex> sources;
+  for (NodeIndex source = 0; source < kNumNodes; source += 3) {
+    sources.push_back(source);
+  }
+  sources.push_back(0);
+  std::span<NodeIndex const> const source_span(sources);
+
+  CsrGraph::VisitationContext context;
+  std::vector<Neighborhood<CsrGraph>> expected;
+  k_hop_neighborhoods(csr_graph, source_span, 3, context, expected);
+  ASSERT_EQ(expected.size(), sources.size());
+  Neighborhood<CsrGraph> single;
+  for (std::size_t source = 0; source < sources.size(); ++source) {
+    k_hop_neighborhood(csr_graph, sources[source], 3, context, single);
+    ASSERT_EQ(expected[source].vertices, single.vertices);
+    ASSERT_EQ(expected[source].level_offsets, single.level_offsets);
+  }
+
+  for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads) {
+    WorkerPool pool(num_threads);
+    std::vector<CsrGraph::VisitationContext> contexts(pool.size());
+    // reused buffers, left over from a larger radius
+    std::vector<Neighborhood<CsrGraph>> neighborhoods;
+    k_hop_neighborhoods(csr_graph, source_span, 4, pool,
+                        std::span<CsrGraph::VisitationContext>(contexts),
+                        neighborhoods);
+    k_hop_neighborhoods(csr_graph, source_span, 3, pool,
+                        std::span<CsrGraph::VisitationContext>(contexts),
+                        neighborhoods);
+    ASSERT_EQ(neighborhoods.size(), sources.size());
+    for (std::size_t source = 0; source < sources.size(); ++source) {
+      ASSERT_EQ(neighborhoods[source].vertices, expected[source].vertices);
+      ASSERT_EQ(neighborhoods[source].level_offsets,
+                expected[source].level_offsets);
+    }
+  }
+
+  Graph::VisitationContext graph_context;
+  std::vector<Neighborhood<Graph>> graph_neighborhoods;
+  k_hop_neighborhoods(graph, source_span, 3, graph_context,
+                      graph_neighborhoods);
+  for (std::size_t source = 0; source < sources.size(); ++source) {
+    ASSERT_EQ(levels_of(graph, graph_neighborhoods[source]),
+              levels_of(csr_graph, expected[source]));
+  }
+}
+
+}  // namespace
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/edge_list.h"
+#include "modern_cpp_template/page_rank.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Entry =
+    modern_cpp_template::algorithms::undirected_graph::EdgeListEntry<int64_t>;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::build_csr_graph;
+using modern_cpp_template::algorithms::undirected_graph::page_rank;
+using modern_cpp_template::algorithms::undirected_graph::PageRankParameters;
+using modern_cpp_template::algorithms::undirected_graph::
+    sparse_matrix_vector_product;
+
+///\brief a random multigraph whose last nodes have no edges
+CsrGraph make_graph(std::size_t num_nodes, std::size_t num_edges) {
+  std::mt19937_64 generator{19};
+  std::uniform_int_distribution<int64_t> node_distribution{
+      0, static_cast<int64_t>(num_nodes) - 11};
+  std::uniform_int_distribution<int64_t> cost_distribution{1, 9};
+  std::vector<Entry> entries;
+  for (std::size_t edge = 0; edge < num_edges; ++edge) {
+    entries.push_back({node_distribution(generator),
+                       node_distribution(generator),
+                       cost_distribution(generator)});
+  }
+  return build_csr_graph(std::span<Entry const>(entries),
+                         std::vector<std::string>(num_nodes));
+}
+
+///\brief the textbook power iteration, one node at a time
+std::vector<double> reference_page_rank(CsrGraph const& graph,
+                                        PageRankParameters const& parameters,
+                                        std::size_t iterations) {
+  auto const number_of_nodes = graph.number_of_nodes();
+  auto const nodes = static_cast<double>(number_of_nodes);
+  std::vector<double> ranks(number_of_nodes, 1.0 / nodes);
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    std::vector<double> next(number_of_nodes,
+                             (1.0 - parameters.damping) / nodes);
+    for (CsrGraph::LocalIndex node = 0; node < number_of_nodes; ++node) {
+      auto const neighbors = graph.neighbors(node);
+      if (neighbors.empty()) {
+        for (auto& rank : next) {
+          rank += parameters.damping * ranks[node] / nodes;
+        }
+      }
+      for (auto neighbor : neighbors) {
+        next[neighbor] += parameters.damping * ranks[node] /
+                          static_cast<double>(neighbors.size());
+      }
+    }
+    ranks.swap(next);
+  }
+  return ranks;
+}
+
+// clang-format off
+TEST(PageRankTest, MatchesPowerIteration) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_graph(1000, 3000);
+  PageRankParameters parameters;
+  parameters.tolerance = 1e-12;
+
+  for (std::size_t num_threads : {1U, 2U, 4U}) {
+    WorkerPool pool(num_threads);
+    auto const result = page_rank(graph, pool, parameters);
+    ASSERT_LT(result.error, 1e-12);
+    ASSERT_LT(result.iterations, parameters.max_iterations);
+    auto const expected =
+        reference_page_rank(graph, parameters, result.iterations);
+    ASSERT_NEAR(std::accumulate(result.ranks.begin(), result.ranks.end(), 0.0),
+                1.0, 1e-9);
+    for (std::size_t node = 0; node < expected.size(); ++node) {
+      ASSERT_NEAR(result.ranks[node], expected[node], 1e-12);
+    }
+
+    auto const single = page_rank<float>(graph, pool, parameters);
+    ASSERT_EQ(single.iterations, parameters.max_iterations);
+    for (std::size_t node = 0; node < expected.size(); ++node) {
+      ASSERT_NEAR(single.ranks[node], expected[node], 1e-5);
+    }
+  }
+
+  parameters.max_iterations = 3;
+  auto const three = page_rank(graph, parameters);
+  ASSERT_EQ(three.iterations, 3U);
+  auto const expected = reference_page_rank(graph, parameters, 3);
+  for (std::size_t node = 0; node < expected.size(); ++node) {
+    ASSERT_NEAR(three.ranks[node], expected[node], 1e-12);
+  }
+  ASSERT_TRUE(page_rank(CsrGraph{}).ranks.empty());
+}
+
+// clang-format off
+TEST(PageRankTest, SparseMatrixVectorProduct) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_graph(500, 2000);
+  std::vector<double> input(graph.number_of_nodes());
+  std::iota(input.begin(), input.end(), 1.0);
+  std::vector<double> expected(graph.number_of_nodes(), 0.0);
+  std::vector<double> expected_unit(graph.number_of_nodes(), 0.0);
+  for (CsrGraph::LocalIndex node = 0; node < graph.number_of_nodes(); ++node) {
+    auto const neighbors = graph.neighbors(node);
+    auto const costs = graph.neighbor_costs(node);
+    for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+      expected[node] +=
+          static_cast<double>(costs[edge]) * input[neighbors[edge]];
+      expected_unit[node] += input[neighbors[edge]];
+    }
+  }
+
+  for (std::size_t num_threads : {1U, 3U}) {
+    WorkerPool pool(num_threads);
+    std::vector<double> output(graph.number_of_nodes(), -1.0);
+    sparse_matrix_vector_product(graph, std::span<double const>(input),
+                                 std::span<double>(output), pool);
+    ASSERT_EQ(output, expected);
+    sparse_matrix_vector_product(graph, std::span<double const>(input),
+                                 std::span<double>(output), pool,
+                                 [](int64_t /*cost*/) { return 1.0; });
+    ASSERT_EQ(output, expected_unit);
+  }
+}
+
+}  // namespace
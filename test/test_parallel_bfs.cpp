@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/direction_optimizing_bfs.h"
+#include "modern_cpp_template/parallel_bfs.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::
+    direction_optimizing_breadth_first_search;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::
+    parallel_breadth_first_search;
+using modern_cpp_template::tests::make_random_graph;
+
+// clang-format off
+TEST(ParallelBfsTest, VisitsEveryReachableNodeOnce) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(7, 5000, 8000));
+  std::vector<NodeIndex> expected;
+  graph.breadth_first_search(0, [&expected](Node const& node) {
+    expected.push_back(node.id);
+    return false;
+  });
+  auto levels = direction_optimizing_breadth_first_search(graph, 0).levels;
+
+  for (std::size_t num_threads : {1U, 2U, 4U}) {
+    WorkerPool pool(num_threads);
+    std::mutex mutex;
+    std::vector<NodeIndex> visited;
+    parallel_breadth_first_search(graph, 0, pool,
+                                  [&mutex, &visited](Node const& node) {
+                                    std::lock_guard lock(mutex);
+                                    visited.push_back(node.id);
+                                    return false;
+                                  });
+    // reported level by level, each node exactly once
+    for (std::size_t position = 1; position < visited.size(); ++position) {
+      ASSERT_LE(levels[graph.find_local(visited[position - 1])],
+                levels[graph.find_local(visited[position])]);
+    }
+    std::sort(visited.begin(), visited.end());
+    auto sorted_expected = expected;
+    std::sort(sorted_expected.begin(), sorted_expected.end());
+    ASSERT_EQ(visited, sorted_expected);
+  }
+}
+
+// clang-format off
+TEST(ParallelBfsTest, ReturnEarlyStopsAllThreads) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(7, 5000, 8000));
+  auto levels = direction_optimizing_breadth_first_search(graph, 0).levels;
+  auto target_local = static_cast<CsrGraph::LocalIndex>(
+      std::find(levels.begin(), levels.end(), 3) - levels.begin());
+  auto target = graph.original_id(target_local);
+
+  WorkerPool pool(4);
+  std::mutex mutex;
+  std::vector<NodeIndex> visited;
+  parallel_breadth_first_search(graph, 0, pool,
+                                [&](Node const& node) {
+                                  std::lock_guard lock(mutex);
+                                  visited.push_back(node.id);
+                                  return node.id == target;
+                                });
+  ASSERT_NE(std::find(visited.begin(), visited.end(), target), visited.end());
+  for (auto node_index : visited) {
+    ASSERT_LE(levels[graph.find_local(node_index)], 3);
+  }
+}
+
+// clang-format off
+TEST(ParallelBfsTest, CallbackExceptionReachesCaller) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = freeze(make_random_graph(7, 5000, 8000));
+  auto levels = direction_optimizing_breadth_first_search(graph, 0).levels;
+  WorkerPool pool(4);
+  // the thread that throws no longer takes part in the level, but the others
+  // must still get through the level barrier
+  ASSERT_THROW(parallel_breadth_first_search(
+                   graph, 0, pool,
+                   [&](Node const& node) {
+                     if (levels[graph.find_local(node.id)] == 2) {
+                       throw std::runtime_error("callback failed");
+                     }
+                     return false;
+                   }),
+               std::runtime_error);
+  std::atomic<std::size_t> visited{0};
+  parallel_breadth_first_search(graph, 0, pool, [&visited](Node const&) {
+    ++visited;
+    return false;
+  });
+  ASSERT_EQ(visited.load(), static_cast<std::size_t>(std::count_if(
+                                levels.begin(), levels.end(),
+                                [](int64_t level) { return level >= 0; })));
+}
+
+}  // namespace
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "modern_cpp_template/priority_queues.h"
+
+namespace {
+
+using modern_cpp_template::algorithms::BinaryHeap;
+using modern_cpp_template::algorithms::PairingHeap;
+using modern_cpp_template::algorithms::RadixHeap;
+
+template <typename Queue>
+std::vector<int64_t> drain_keys(Queue& queue) {
+  std::vector<int64_t> keys;
+  while (!queue.empty()) {
+    keys.push_back(queue.top().first);
+    queue.pop();
+  }
+  return keys;
+}
+
+// clang-format off
+TEST(PriorityQueuesTest, PopInKeyOrder) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<int64_t> distribution{0, 1000};
+  std::vector<int64_t> keys(500);
+  std::generate(keys.begin(), keys.end(),
+                [&]() { return distribution(generator); });
+  auto sorted_keys = keys;
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+
+  BinaryHeap<int64_t, uint32_t> binary_heap(keys.size());
+  RadixHeap<int64_t, uint32_t> radix_heap(keys.size());
+  PairingHeap<int64_t, uint32_t> pairing_heap(keys.size());
+  for (uint32_t value = 0; value < keys.size(); ++value) {
+    binary_heap.push(keys[value], value);
+    radix_heap.push(keys[value], value);
+    pairing_heap.push(keys[value], value);
+  }
+  ASSERT_EQ(radix_heap.size(), keys.size());
+  ASSERT_EQ(pairing_heap.size(), keys.size());
+  ASSERT_EQ(drain_keys(binary_heap), sorted_keys);
+  ASSERT_EQ(drain_keys(radix_heap), sorted_keys);
+  ASSERT_EQ(drain_keys(pairing_heap), sorted_keys);
+}
+
+// clang-format off
+TEST(PriorityQueuesTest, RadixHeapMonotonePushes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // interleave pops with pushes of keys >= the last popped key, as Dijkstra
+  // does
+  std::mt19937_64 generator{7};
+  std::uniform_int_distribution<int64_t> distribution{0, 100};
+  RadixHeap<int64_t, int64_t> radix_heap;
+  BinaryHeap<int64_t, int64_t> binary_heap;
+  radix_heap.push(0, 0);
+  binary_heap.push(0, 0);
+  for (int64_t step = 1; step < 2000; ++step) {
+    auto radix_key = radix_heap.top().first;
+    ASSERT_EQ(radix_key, binary_heap.top().first);
+    radix_heap.pop();
+    binary_heap.pop();
+    for (int count = 0; count < 2; ++count) {
+      auto key = radix_key + distribution(generator);
+      radix_heap.push(key, step);
+      binary_heap.push(key, step);
+    }
+  }
+  ASSERT_EQ(radix_heap.size(), binary_heap.size());
+  ASSERT_EXIT(radix_heap.push(-1, 0), testing::KilledBySignal(SIGABRT), "");
+}
+
+// clang-format off
+TEST(PriorityQueuesTest, PairingHeapDecreaseKey) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::mt19937_64 generator{3};
+  std::uniform_int_distribution<int64_t> distribution{0, 10000};
+  constexpr uint32_t kValues{300};
+  std::vector<int64_t> keys(kValues);
+  PairingHeap<int64_t, uint32_t> pairing_heap(kValues);
+  for (uint32_t value = 0; value < kValues; ++value) {
+    keys[value] = distribution(generator);
+    pairing_heap.push(keys[value], value);
+  }
+  // pop a few so that the heap has a non-trivial shape, then lower keys
+  for (int pop = 0; pop < 20; ++pop) {
+    keys[pairing_heap.top().second] = -1;
+    pairing_heap.pop();
+  }
+  for (uint32_t value = 0; value < kValues; value += 3) {
+    if (pairing_heap.contains(value)) {
+      keys[value] /= 2;
+      pairing_heap.decrease_key(value, keys[value]);
+    }
+  }
+
+  std::vector<std::pair<int64_t, uint32_t>> expected;
+  for (uint32_t value = 0; value < kValues; ++value) {
+    if (keys[value] >= 0) {
+      expected.emplace_back(keys[value], value);
+    }
+  }
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(pairing_heap.size(), expected.size());
+  for (auto const& entry : expected) {
+    auto top = pairing_heap.top();
+    ASSERT_EQ(top.first, entry.first);
+    ASSERT_EQ(keys[top.second], entry.first);
+    pairing_heap.pop();
+  }
+  ASSERT_TRUE(pairing_heap.empty());
+}
+
+}  // namespace
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/priority_queues.h"
+#include "modern_cpp_template/shortest_paths.h"
+#include "modern_cpp_template/undirected_graph.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using modern_cpp_template::algorithms::BinaryHeap;
+using modern_cpp_template::algorithms::PairingHeap;
+using modern_cpp_template::algorithms::RadixHeap;
+using modern_cpp_template::algorithms::undirected_graph::
+    bidirectional_dijkstra_shortest_path;
+using modern_cpp_template::algorithms::undirected_graph::dijkstra_shortest_path;
+using modern_cpp_template::algorithms::undirected_graph::
+    dijkstra_shortest_paths;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::ShortestPathTree;
+using modern_cpp_template::tests::make_random_weighted_graph;
+
+constexpr int64_t kUnreachable{ShortestPathTree<Graph>::kUnreachable};
+
+///\brief Bellman-Ford style relaxation until nothing changes
+std::vector<int64_t> reference_distances(Graph const& graph, int64_t source) {
+  std::vector<int64_t> distances(graph.number_of_nodes(), kUnreachable);
+  distances[static_cast<std::size_t>(source)] = 0;
+  bool is_changed{true};
+  while (is_changed) {
+    is_changed = false;
+    for (auto const& [head, edges] : graph.adjacency_map()) {
+      auto head_distance = distances[static_cast<std::size_t>(head)];
+      if (head_distance == kUnreachable) {
+        continue;
+      }
+      for (auto const& edge : edges) {
+        auto& tail_distance =
+            distances[static_cast<std::size_t>(edge.tail_node_index)];
+        if (head_distance + edge.cost < tail_distance) {
+          tail_distance = head_distance + edge.cost;
+          is_changed = true;
+        }
+      }
+    }
+  }
+  return distances;
+}
+
+///\brief Sum the cheapest edge between each pair of consecutive nodes
+int64_t path_cost(Graph const& graph, std::vector<int64_t> const& nodes) {
+  int64_t cost{0};
+  for (std::size_t node = 1; node < nodes.size(); ++node) {
+    int64_t cheapest{kUnreachable};
+    for (auto const& edge : graph.get_edges(nodes[node - 1])) {
+      if (edge.tail_node_index == nodes[node]) {
+        cheapest = std::min(cheapest, edge.cost);
+      }
+    }
+    EXPECT_NE(cheapest, kUnreachable);
+    cost += cheapest;
+  }
+  return cost;
+}
+
+// clang-format off
+TEST(ShortestPathsTest, SingleSourceMatchesReference) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_random_weighted_graph(42, 500, 600, 50);
+  auto csr_graph = freeze(graph);
+  auto expected = reference_distances(graph, 0);
+
+  ASSERT_EQ(dijkstra_shortest_paths(graph, 0).distances, expected);
+  ASSERT_EQ(dijkstra_shortest_paths<RadixHeap>(graph, 0).distances, expected);
+  ASSERT_EQ(dijkstra_shortest_paths<PairingHeap>(graph, 0).distances, expected);
+
+  // ids are dense, so local indices and ids coincide after freezing
+  auto tree = dijkstra_shortest_paths<RadixHeap>(csr_graph, 0);
+  ASSERT_EQ(tree.distances, expected);
+  ASSERT_EQ(dijkstra_shortest_paths<PairingHeap>(csr_graph, 0).distances,
+            expected);
+
+  // every predecessor edge lies on a shortest path
+  for (uint32_t node = 1; node < csr_graph.number_of_nodes(); ++node) {
+    if (tree.distances[node] == kUnreachable) {
+      ASSERT_EQ(tree.predecessors[node], CsrGraph::kInvalidLocalIndex);
+      continue;
+    }
+    auto predecessor = tree.predecessors[node];
+    auto neighbors = csr_graph.neighbors(predecessor);
+    auto costs = csr_graph.neighbor_costs(predecessor);
+    bool is_tight{false};
+    for (std::size_t edge = 0; edge < neighbors.size(); ++edge) {
+      is_tight = is_tight ||
+                 (neighbors[edge] == node &&
+                  tree.distances[predecessor] + costs[edge] ==
+                      tree.distances[node]);
+    }
+    ASSERT_TRUE(is_tight);
+  }
+}
+
+// clang-format off
+TEST(ShortestPathsTest, PointToPoint) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto graph = make_random_weighted_graph(42, 400, 450, 50);
+  auto csr_graph = freeze(graph);
+  auto expected = reference_distances(graph, 7);
+
+  for (int64_t target = 0; target < 400; target += 13) {
+    auto expected_distance = expected[static_cast<std::size_t>(target)];
+    auto unidirectional = dijkstra_shortest_path(graph, 7, target);
+    auto bidirectional = bidirectional_dijkstra_shortest_path(graph, 7, target);
+    auto bidirectional_csr =
+        bidirectional_dijkstra_shortest_path<RadixHeap>(csr_graph, 7, target);
+    auto bidirectional_pairing =
+        bidirectional_dijkstra_shortest_path<PairingHeap>(graph, 7, target);
+    if (expected_distance == kUnreachable) {
+      ASSERT_FALSE(unidirectional.has_value());
+      ASSERT_FALSE(bidirectional.has_value());
+      ASSERT_FALSE(bidirectional_csr.has_value());
+      ASSERT_FALSE(bidirectional_pairing.has_value());
+      continue;
+    }
+    ASSERT_TRUE(bidirectional_csr.has_value());
+    ASSERT_EQ(bidirectional_csr->distance, expected_distance);
+    ASSERT_EQ(path_cost(graph, bidirectional_csr->nodes), expected_distance);
+    for (auto const& path :
+         {unidirectional, bidirectional, bidirectional_pairing}) {
+      ASSERT_TRUE(path.has_value());
+      ASSERT_EQ(path->distance, expected_distance);
+      ASSERT_EQ(path->nodes.front(), 7);
+      ASSERT_EQ(path->nodes.back(), target);
+      ASSERT_EQ(path_cost(graph, path->nodes), expected_distance);
+    }
+  }
+}
+
+// clang-format off
+TEST(ShortestPathsTest, TrivialAndUnreachable) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b", 4);
+  graph.add_edge(1, "b", 2, "c", 1);
+  graph.add_edge(0, "a", 2, "c", 7);
+  graph.add_edge(3, "d", 4, "e", 1);
+
+  auto tree = dijkstra_shortest_paths(graph, 0);
+  ASSERT_EQ(tree.distances,
+            (std::vector<int64_t>{0, 4, 5, kUnreachable, kUnreachable}));
+  ASSERT_EQ(tree.predecessors, (std::vector<int64_t>{-1, 0, 1, -1, -1}));
+
+  auto path = bidirectional_dijkstra_shortest_path(graph, 0, 2);
+  ASSERT_TRUE(path.has_value());
+  ASSERT_EQ(path->distance, 5);
+  ASSERT_EQ(path->nodes, (std::vector<int64_t>{0, 1, 2}));
+
+  auto same = bidirectional_dijkstra_shortest_path(graph, 1, 1);
+  ASSERT_TRUE(same.has_value());
+  ASSERT_EQ(same->distance, 0);
+  ASSERT_EQ(same->nodes, (std::vector<int64_t>{1}));
+
+  ASSERT_FALSE(dijkstra_shortest_path(graph, 0, 4).has_value());
+  ASSERT_FALSE(bidirectional_dijkstra_shortest_path(graph, 4, 0).has_value());
+
+  graph.add_edge(2, "c", 3, "d", -1);
+  ASSERT_EXIT(auto unused = dijkstra_shortest_paths(graph, 0),
+              testing::KilledBySignal(SIGABRT), "");
+}
+
+
+// clang-format off
+TEST(ShortestPathsTest, RemovedNodes) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // 0 - 1 - 2 and 0 - 2; node 1 removed
+  Graph graph;
+  graph.add_edge(0, "a", 1, "b", 4);
+  graph.add_edge(1, "b", 2, "c", 1);
+  graph.add_edge(0, "a", 2, "c", 7);
+  ASSERT_TRUE(graph.remove_node(1));
+
+  auto tree = dijkstra_shortest_paths(graph, 1);
+  ASSERT_EQ(tree.distances,
+            (std::vector<int64_t>{kUnreachable, kUnreachable, kUnreachable}));
+  ASSERT_EQ(tree.predecessors, (std::vector<int64_t>{-1, -1, -1}));
+  tree = dijkstra_shortest_paths(graph, 0);
+  ASSERT_EQ(tree.distances, (std::vector<int64_t>{0, kUnreachable, 7}));
+
+  for (auto [source, target] : {std::pair<int64_t, int64_t>{1, 1},
+                                {1, 0},
+                                {0, 1}}) {
+    ASSERT_FALSE(dijkstra_shortest_path(graph, source, target).has_value());
+    ASSERT_FALSE(bidirectional_dijkstra_shortest_path(graph, source, target)
+                     .has_value());
+  }
+  auto path = bidirectional_dijkstra_shortest_path(graph, 0, 2);
+  ASSERT_TRUE(path.has_value());
+  ASSERT_EQ(path->nodes, (std::vector<int64_t>{0, 2}));
+}
+
+}  // namespace
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/triangle_counting.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using CsrGraph = modern_cpp_template::algorithms::undirected_graph::CsrGraph<
+    std::string, int64_t>;
+using LocalIndex = CsrGraph::LocalIndex;
+using modern_cpp_template::algorithms::WorkerPool;
+using modern_cpp_template::algorithms::undirected_graph::
+    clustering_coefficients;
+using modern_cpp_template::algorithms::undirected_graph::count_triangles;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::algorithms::undirected_graph::internal::
+    intersect_sorted;
+
+// clang-format off
+TEST(TriangleCountingTest, IntersectSorted) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  std::mt19937 generator{3};
+  for (uint32_t range : {8U, 40U, 1000U}) {
+    std::uniform_int_distribution<uint32_t> distribution{0, range};
+    for (int repeat = 0; repeat < 50; ++repeat) {
+      std::set<uint32_t> lhs_set;
+      std::set<uint32_t> rhs_set;
+      auto const lhs_size = distribution(generator) % 30;
+      auto const rhs_size = distribution(generator) % 30;
+      while (lhs_set.size() < std::min(lhs_size, range)) {
+        lhs_set.insert(distribution(generator));
+      }
+      while (rhs_set.size() < std::min(rhs_size, range)) {
+        rhs_set.insert(distribution(generator));
+      }
+      std::vector<uint32_t> const lhs(lhs_set.begin(), lhs_set.end());
+      std::vector<uint32_t> const rhs(rhs_set.begin(), rhs_set.end());
+      std::vector<uint32_t> expected;
+      std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                            std::back_inserter(expected));
+
+      std::vector<uint32_t> common;
+      auto const count =
+          intersect_sorted(lhs, rhs, [&common](uint32_t value) {
+            common.push_back(value);
+          });
+      std::sort(common.begin(), common.end());
+      ASSERT_EQ(common, expected);
+      ASSERT_EQ(count, expected.size());
+      ASSERT_EQ(intersect_sorted(rhs, lhs), expected.size());
+    }
+  }
+}
+
+// clang-format off
+TEST(TriangleCountingTest, MatchesBruteForce) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // dense enough for many triangles, with parallel edges and self loops
+  constexpr int64_t kNodes{120};
+  std::mt19937_64 generator{13};
+  std::uniform_int_distribution<int64_t> distribution{0, kNodes - 1};
+  Graph graph;
+  for (int64_t edge = 0; edge < 1500; ++edge) {
+    auto head = distribution(generator);
+    auto tail = edge % 50 == 0 ? head : distribution(generator);
+    graph.add_edge(head, "", tail, "");
+    if (edge % 7 == 0) {
+      graph.add_edge(tail, "", head, "");
+    }
+  }
+  auto const csr_graph = freeze(graph);
+  auto const number_of_nodes = csr_graph.number_of_nodes();
+
+  std::vector<std::set<LocalIndex>> adjacency(number_of_nodes);
+  for (LocalIndex local = 0; local < number_of_nodes; ++local) {
+    for (auto neighbor : csr_graph.neighbors(local)) {
+      if (neighbor != local) {
+        adjacency[local].insert(neighbor);
+      }
+    }
+  }
+  uint64_t expected_triangles{0};
+  std::vector<uint64_t> expected_node_triangles(number_of_nodes, 0);
+  for (LocalIndex first = 0; first < number_of_nodes; ++first) {
+    for (auto second : adjacency[first]) {
+      for (auto third : adjacency[second]) {
+        if (first < second && second < third &&
+            adjacency[first].contains(third)) {
+          ++expected_triangles;
+          ++expected_node_triangles[first];
+          ++expected_node_triangles[second];
+          ++expected_node_triangles[third];
+        }
+      }
+    }
+  }
+  ASSERT_GT(expected_triangles, 100U);
+
+  for (std::size_t num_threads : {1U, 2U, 4U}) {
+    WorkerPool pool(num_threads);
+    ASSERT_EQ(count_triangles(csr_graph, pool), expected_triangles);
+    ASSERT_EQ(count_triangles(graph, pool), expected_triangles);
+    auto const clustering = clustering_coefficients(csr_graph, pool);
+    ASSERT_EQ(clustering.triangles, expected_triangles);
+    ASSERT_EQ(clustering.node_triangles, expected_node_triangles);
+
+    double triples{0.0};
+    double local_sum{0.0};
+    for (LocalIndex local = 0; local < number_of_nodes; ++local) {
+      auto const degree = static_cast<double>(adjacency[local].size());
+      auto const node_triples = degree * (degree - 1.0) / 2.0;
+      auto const expected_local =
+          node_triples > 0.0
+              ? static_cast<double>(expected_node_triangles[local]) /
+                    node_triples
+              : 0.0;
+      ASSERT_DOUBLE_EQ(clustering.local[local], expected_local);
+      triples += node_triples;
+      local_sum += expected_local;
+    }
+    ASSERT_DOUBLE_EQ(clustering.global,
+                     3.0 * static_cast<double>(expected_triangles) / triples);
+    ASSERT_DOUBLE_EQ(clustering.average,
+                     local_sum / static_cast<double>(number_of_nodes));
+  }
+}
+
+// clang-format off
+TEST(TriangleCountingTest, SmallGraphs) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ASSERT_EQ(count_triangles(CsrGraph{}), 0U);
+  ASSERT_EQ(clustering_coefficients(CsrGraph{}).global, 0.0);
+
+  // K4 plus a pendant node
+  Graph graph;
+  for (int64_t head = 0; head < 4; ++head) {
+    for (int64_t tail = head + 1; tail < 4; ++tail) {
+      graph.add_edge(head, "", tail, "");
+    }
+  }
+  graph.add_edge(3, "", 4, "");
+  auto const clustering = clustering_coefficients(freeze(graph));
+  ASSERT_EQ(clustering.triangles, 4U);
+  ASSERT_EQ(clustering.node_triangles,
+            (std::vector<uint64_t>{3, 3, 3, 3, 0}));
+  ASSERT_DOUBLE_EQ(clustering.local[0], 1.0);
+  ASSERT_DOUBLE_EQ(clustering.local[3], 0.5);
+  ASSERT_DOUBLE_EQ(clustering.local[4], 0.0);
+  // 12 triangle corners over 3 + 3 + 3 + 6 connected triples
+  ASSERT_DOUBLE_EQ(clustering.global, 12.0 / 15.0);
+}
+
+}  // namespace
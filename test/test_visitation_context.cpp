@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "graph_factories.h"
+#include "modern_cpp_template/csr_graph.h"
+#include "modern_cpp_template/undirected_graph.h"
+#include "modern_cpp_template/visitation_context.h"
+
+namespace {
+
+using Graph =
+    modern_cpp_template::algorithms::undirected_graph::UndirectedGraph<
+        std::string, int64_t>;
+using Node = Graph::Node;
+using NodeIndex = Graph::NodeIndex;
+using modern_cpp_template::algorithms::VisitationContext;
+using modern_cpp_template::algorithms::undirected_graph::freeze;
+using modern_cpp_template::tests::make_city_graph;
+
+std::vector<NodeIndex> const kExpectedOrder{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+// clang-format off
+TEST(VisitationContextTest, ResetIsEpochBased) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  // an 8-bit epoch wraps quickly, which exercises the real clear
+  VisitationContext<int64_t, uint8_t> context(4);
+  for (int traversal = 0; traversal < 600; ++traversal) {
+    ASSERT_FALSE(context.is_visited(2));
+    ASSERT_TRUE(context.visit(2));
+    ASSERT_FALSE(context.visit(2));
+    ASSERT_TRUE(context.is_visited(2));
+    context.reset(4);
+  }
+  context.push(3);
+  context.push(1);
+  ASSERT_EQ(context.pop(), 3);
+  ASSERT_EQ(context.pop(), 1);
+  ASSERT_TRUE(context.empty());
+
+  context.reset(16);
+  ASSERT_EQ(context.size(), 16U);
+  ASSERT_FALSE(context.is_visited(15));
+  ASSERT_EXIT(context.visit(16), testing::KilledBySignal(SIGABRT), "");
+}
+
+// clang-format off
+TEST(VisitationContextTest, ReentrantSearchOnConstGraph) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_city_graph();
+  Graph::VisitationContext context;
+  for (int run = 0; run < 3; ++run) {
+    std::vector<NodeIndex> order;
+    graph.breadth_first_search(0, context, [&order](Node const& node) {
+      order.push_back(node.id);
+      return false;
+    });
+    ASSERT_EQ(order, kExpectedOrder);
+  }
+  for (auto const& [node_index, node] : graph.node_map()) {
+    ASSERT_FALSE(node.is_visited);
+  }
+
+  std::vector<NodeIndex> order;
+  graph.breadth_first_search(7, context, [&order](Node const& node) {
+    order.push_back(node.id);
+    return node.id == 0;
+  });
+  ASSERT_EQ(order, (std::vector<NodeIndex>{7, 3, 0}));
+}
+
+// clang-format off
+TEST(VisitationContextTest, ConcurrentSearches) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  auto const graph = make_city_graph();
+  auto const csr_graph = freeze(graph);
+  static constexpr int kNumThreads{4};
+  static constexpr int kNumSearches{200};
+  std::vector<int> failures(kNumThreads, 0);
+  {
+    std::vector<std::jthread> threads;
+    for (int thread = 0; thread < kNumThreads; ++thread) {
+      threads.emplace_back([&, thread] {
+        Graph::VisitationContext context;
+        decltype(csr_graph)::VisitationContext csr_context;
+        for (int search = 0; search < kNumSearches; ++search) {
+          std::vector<NodeIndex> order;
+          std::vector<NodeIndex> csr_order;
+          auto record = [](std::vector<NodeIndex>& into) {
+            return [&into](Node const& node) {
+              into.push_back(node.id);
+              return false;
+            };
+          };
+          graph.breadth_first_search(0, context, record(order));
+          csr_graph.breadth_first_search(0, csr_context, record(csr_order));
+          if (order != kExpectedOrder || csr_order != kExpectedOrder) {
+            ++failures[static_cast<std::size_t>(thread)];
+          }
+        }
+      });
+    }
+  }
+  ASSERT_EQ(failures, std::vector<int>(kNumThreads, 0));
+}
+
+}  // namespace
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <barrier>
+#include <stdexcept>
+#include <vector>
+
+#include "modern_cpp_template/worker_pool.h"
+
+namespace {
+
+using modern_cpp_template::algorithms::BarrierJobException;
+using modern_cpp_template::algorithms::parallel_for;
+using modern_cpp_template::algorithms::partition_range;
+using modern_cpp_template::algorithms::WorkerPool;
+
+// clang-format off
+TEST(WorkerPoolTest, RunsJobOnEveryThread) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  WorkerPool pool(4);
+  ASSERT_EQ(pool.size(), 4U);
+  for (int run = 0; run < 3; ++run) {
+    std::vector<std::atomic<int>> calls(pool.size());
+    pool.run([&calls](std::size_t thread_index) { ++calls[thread_index]; });
+    for (auto const& call : calls) {
+      ASSERT_EQ(call.load(), 1);
+    }
+  }
+}
+
+// clang-format off
+TEST(WorkerPoolTest, RethrowsFirstException) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  WorkerPool pool(3);
+  ASSERT_THROW(pool.run([](std::size_t thread_index) {
+    if (thread_index == 2) {
+      throw std::runtime_error("worker failed");
+    }
+  }),
+               std::runtime_error);
+  // the pool is still usable afterwards
+  std::atomic<std::size_t> calls{0};
+  pool.run([&calls](std::size_t) { ++calls; });
+  ASSERT_EQ(calls.load(), 3U);
+}
+
+// clang-format off
+TEST(WorkerPoolTest, BarrierJobException) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  WorkerPool pool(4);
+  BarrierJobException job_exception;
+  int phases{0};
+  bool is_finished{false};
+  std::barrier phase_barrier(
+      static_cast<std::ptrdiff_t>(pool.size()), [&]() noexcept {
+        is_finished = job_exception.has_exception() || phases == 9;
+        phases += is_finished ? 0 : 1;
+      });
+  pool.run([&](std::size_t thread_index) {
+    while (!is_finished) {
+      job_exception.capture([&] {
+        if (phases == 3 && thread_index == 1) {
+          throw std::runtime_error("phase failed");
+        }
+      });
+      phase_barrier.arrive_and_wait();
+    }
+  });
+  ASSERT_EQ(phases, 3);
+  ASSERT_THROW(job_exception.rethrow_if_any(), std::runtime_error);
+  ASSERT_NO_THROW(job_exception.rethrow_if_any());
+}
+
+// clang-format off
+TEST(WorkerPoolTest, ParallelForVisitsEveryIndexOnce) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  WorkerPool pool(3);
+  for (std::size_t size : {0U, 1U, 7U, 64U, 1000U}) {
+    std::vector<std::atomic<int>> calls(size);
+    std::atomic<bool> is_thread_index_valid{true};
+    parallel_for(pool, size, 7,
+                 [&](std::size_t index, std::size_t thread_index) {
+                   if (thread_index >= pool.size()) {
+                     is_thread_index_valid = false;
+                   }
+                   ++calls[index];
+                 });
+    ASSERT_TRUE(is_thread_index_valid);
+    for (auto const& call : calls) {
+      ASSERT_EQ(call.load(), 1);
+    }
+  }
+}
+
+// clang-format off
+TEST(WorkerPoolTest, PartitionRange) {  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  // clang-format on
+  ASSERT_EQ(partition_range(10, 0, 3), (std::pair<std::size_t, std::size_t>{0, 4}));
+  ASSERT_EQ(partition_range(10, 1, 3), (std::pair<std::size_t, std::size_t>{4, 7}));
+  ASSERT_EQ(partition_range(10, 2, 3), (std::pair<std::size_t, std::size_t>{7, 10}));
+  ASSERT_EQ(partition_range(2, 3, 4), (std::pair<std::size_t, std::size_t>{2, 2}));
+}
+
+}  // namespace